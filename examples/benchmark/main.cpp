@@ -1,7 +1,12 @@
+#include <QElapsedTimer>
 #include <QGuiApplication>
 #include <QQmlApplicationEngine>
 #include <QQmlContext>
 
+#ifndef GIZMO3D_QML_COMPILATION
+#define GIZMO3D_QML_COMPILATION "aot"
+#endif
+
 int main(int argc, char *argv[])
 {
     QGuiApplication app(argc, argv);
@@ -16,10 +21,18 @@ int main(int argc, char *argv[])
         Qt::QueuedConnection
     );
 
+    // Startup cost: loading, compiling (JIT builds) and instantiating the scene
+    QElapsedTimer startupTimer;
+    startupTimer.start();
     engine.load(url);
+    const double startupMs = startupTimer.nsecsElapsed() / 1.0e6;
 
     if (engine.rootObjects().isEmpty())
         return -1;
 
+    QObject *root = engine.rootObjects().constFirst();
+    root->setProperty("startupMs", startupMs);
+    root->setProperty("qmlCompilation", QStringLiteral(GIZMO3D_QML_COMPILATION));
+
     return app.exec();
 }
@@ -16,9 +16,15 @@ Window {
     property int warmupFrames: 30
     property int measureFrames: 300
 
-    // Phase tracking: 0 = scene-only, 1 = scene+gizmo
+    // Set by main.cpp once the scene is loaded: time spent in engine.load() and
+    // whether the Gizmo3D module was compiled ahead of time ("aot") or left to the JIT
+    property real startupMs: 0
+    property string qmlCompilation: ""
+
+    // Phase tracking: 0 = scene-only, 1 = scene+gizmo, 2 = quad view (4 View3Ds)+gizmos
     property int phase: 0
-    property var phaseNames: ["scene_only", "scene_with_gizmo"]
+    property var phaseNames: ["scene_only", "scene_with_gizmo", "quad_view_gizmo"]
+    readonly property int phaseCount: phaseNames.length
 
     // Deterministic hash from index for pseudo-random distribution
     function hash(n) {
@@ -39,10 +45,15 @@ Window {
 
     // Whether gizmos are active this phase
     property bool gizmoActive: phase === 1
+    property bool quadActive: phase === 2
+
+    // Camera orbit angle - advanced each frame to force geometry recalc in every view
+    property real orbitAngle: 0
 
     View3D {
         id: view3d
         anchors.fill: parent
+        visible: !quadActive
         camera: camera
 
         environment: SceneEnvironment {
@@ -55,6 +66,7 @@ Window {
         // Camera orbit parent - rotated each frame to force geometry recalc
         Node {
             id: cameraOrbit
+            eulerRotation.y: mainWindow.orbitAngle
 
             PerspectiveCamera {
                 id: camera
@@ -65,79 +77,84 @@ Window {
             }
         }
 
-        DirectionalLight {
-            eulerRotation.x: -30
-            eulerRotation.y: -70
-            brightness: 1.0
-            ambientColor: Qt.rgba(0.3, 0.3, 0.3, 1.0)
-        }
-
-        DirectionalLight {
-            eulerRotation.x: 30
-            eulerRotation.y: 110
-            brightness: 0.5
-        }
+        // Shared scene, also imported by the quad views
+        Node {
+            id: sceneRoot
 
-        // Ground plane
-        Model {
-            source: "#Rectangle"
-            position: Qt.vector3d(0, -10, 0)
-            eulerRotation.x: -90
-            scale: Qt.vector3d(100, 100, 1)
-            materials: PrincipledMaterial {
-                baseColor: "#2a2a3e"
-                metalness: 0.0
-                roughness: 0.9
+            DirectionalLight {
+                eulerRotation.x: -30
+                eulerRotation.y: -70
+                brightness: 1.0
+                ambientColor: Qt.rgba(0.3, 0.3, 0.3, 1.0)
             }
-        }
 
-        // Benchmark target node
-        Model {
-            id: benchmarkTarget
-            source: "#Cube"
-            position: Qt.vector3d(0, 50, 0)
-            scale: Qt.vector3d(0.5, 0.5, 0.5)
-            materials: PrincipledMaterial {
-                baseColor: "#ffffff"
-                metalness: 0.5
-                roughness: 0.3
+            DirectionalLight {
+                eulerRotation.x: 30
+                eulerRotation.y: 110
+                brightness: 0.5
             }
-        }
-
-        // Stress test objects
-        Repeater3D {
-            model: mainWindow.objectCount
 
+            // Ground plane
             Model {
-                required property int index
-
-                property real gridSize: Math.ceil(Math.cbrt(mainWindow.objectCount))
-                property real spacing: 30
-                property real ix: index % gridSize
-                property real iy: Math.floor(index / gridSize) % gridSize
-                property real iz: Math.floor(index / (gridSize * gridSize))
-
-                source: mainWindow.meshTypes[index % 5]
-
-                position: Qt.vector3d(
-                    (ix - gridSize / 2) * spacing + (hash(index * 3) - 0.5) * spacing * 0.5,
-                    iy * spacing + 10 + (hash(index * 5) - 0.5) * spacing * 0.3,
-                    (iz - gridSize / 2) * spacing + (hash(index * 7) - 0.5) * spacing * 0.5
-                )
-
-                eulerRotation: Qt.vector3d(
-                    hash(index * 13) * 360,
-                    hash(index * 17) * 360,
-                    hash(index * 23) * 360
-                )
-
-                property real s: 0.1 + hash(index * 31) * 0.4
-                scale: Qt.vector3d(s, s, s)
+                source: "#Rectangle"
+                position: Qt.vector3d(0, -10, 0)
+                eulerRotation.x: -90
+                scale: Qt.vector3d(100, 100, 1)
+                materials: PrincipledMaterial {
+                    baseColor: "#2a2a3e"
+                    metalness: 0.0
+                    roughness: 0.9
+                }
+            }
 
+            // Benchmark target node
+            Model {
+                id: benchmarkTarget
+                source: "#Cube"
+                position: Qt.vector3d(0, 50, 0)
+                scale: Qt.vector3d(0.5, 0.5, 0.5)
                 materials: PrincipledMaterial {
-                    baseColor: mainWindow.colorFromIndex(index)
-                    metalness: 0.3
-                    roughness: 0.5
+                    baseColor: "#ffffff"
+                    metalness: 0.5
+                    roughness: 0.3
+                }
+            }
+
+            // Stress test objects
+            Repeater3D {
+                model: mainWindow.objectCount
+
+                Model {
+                    required property int index
+
+                    property real gridSize: Math.ceil(Math.cbrt(mainWindow.objectCount))
+                    property real spacing: 30
+                    property real ix: index % gridSize
+                    property real iy: Math.floor(index / gridSize) % gridSize
+                    property real iz: Math.floor(index / (gridSize * gridSize))
+
+                    source: mainWindow.meshTypes[index % 5]
+
+                    position: Qt.vector3d(
+                        (ix - gridSize / 2) * spacing + (hash(index * 3) - 0.5) * spacing * 0.5,
+                        iy * spacing + 10 + (hash(index * 5) - 0.5) * spacing * 0.3,
+                        (iz - gridSize / 2) * spacing + (hash(index * 7) - 0.5) * spacing * 0.5
+                    )
+
+                    eulerRotation: Qt.vector3d(
+                        hash(index * 13) * 360,
+                        hash(index * 17) * 360,
+                        hash(index * 23) * 360
+                    )
+
+                    property real s: 0.1 + hash(index * 31) * 0.4
+                    scale: Qt.vector3d(s, s, s)
+
+                    materials: PrincipledMaterial {
+                        baseColor: mainWindow.colorFromIndex(index)
+                        metalness: 0.3
+                        roughness: 0.5
+                    }
                 }
             }
         }
@@ -187,6 +204,116 @@ Window {
         z: 1  // Rotation on top, matching GlobalGizmo
     }
 
+    // Quad view - four View3Ds sharing the scene, each with its own gizmo set.
+    // Exercises the per-view projector cache: every frame alternates between views.
+    readonly property var quadCameras: [
+        { name: "perspective", ortho: false, position: Qt.vector3d(0, 500, 800), rotation: Qt.vector3d(-30, 0, 0) },
+        { name: "top", ortho: true, position: Qt.vector3d(0, 2000, 0), rotation: Qt.vector3d(-90, 0, 0) },
+        { name: "front", ortho: true, position: Qt.vector3d(0, 100, 2000), rotation: Qt.vector3d(0, 0, 0) },
+        { name: "side", ortho: true, position: Qt.vector3d(2000, 100, 0), rotation: Qt.vector3d(0, 90, 0) }
+    ]
+
+    Grid {
+        id: quadGrid
+        anchors.fill: parent
+        columns: 2
+        visible: quadActive
+
+        Repeater {
+            id: quadViews
+            model: mainWindow.quadCameras
+
+            Item {
+                id: quadCell
+                required property var modelData
+
+                property alias view: quadView
+                property alias scaleGizmo: quadScaleGizmo
+                property alias translationGizmo: quadTranslationGizmo
+                property alias rotationGizmo: quadRotationGizmo
+
+                width: quadGrid.width / 2
+                height: quadGrid.height / 2
+                clip: true
+
+                View3D {
+                    id: quadView
+                    anchors.fill: parent
+                    importScene: sceneRoot
+                    camera: quadCell.modelData.ortho ? quadOrthoCamera : quadPerspectiveCamera
+
+                    environment: SceneEnvironment {
+                        clearColor: "#1a1a2e"
+                        backgroundMode: SceneEnvironment.Color
+                    }
+
+                    Node {
+                        eulerRotation.y: mainWindow.orbitAngle
+
+                        PerspectiveCamera {
+                            id: quadPerspectiveCamera
+                            position: quadCell.modelData.position
+                            eulerRotation: quadCell.modelData.rotation
+                            clipFar: 50000
+                            clipNear: 1
+                        }
+
+                        OrthographicCamera {
+                            id: quadOrthoCamera
+                            position: quadCell.modelData.position
+                            eulerRotation: quadCell.modelData.rotation
+                            horizontalMagnification: 0.6
+                            verticalMagnification: 0.6
+                            clipFar: 50000
+                            clipNear: 1
+                        }
+                    }
+                }
+
+                ScaleGizmo {
+                    id: quadScaleGizmo
+                    anchors.fill: parent
+                    visible: quadActive
+                    managedByParent: true
+                    view3d: quadView
+                    targetNode: benchmarkTarget
+                    transformMode: GizmoEnums.TransformMode.World
+                    shapeAntialiasing: true
+                    gizmoSize: 80
+                    arrowStartRatio: 0.0
+                    arrowEndRatio: 0.5
+                }
+
+                TranslationGizmo {
+                    id: quadTranslationGizmo
+                    anchors.fill: parent
+                    visible: quadActive
+                    managedByParent: true
+                    view3d: quadView
+                    targetNode: benchmarkTarget
+                    transformMode: GizmoEnums.TransformMode.World
+                    shapeAntialiasing: true
+                    gizmoSize: 104
+                    arrowStartRatio: 0.5
+                    arrowEndRatio: 1.0
+                }
+
+                RotationGizmo {
+                    id: quadRotationGizmo
+                    anchors.fill: parent
+                    visible: quadActive
+                    managedByParent: true
+                    view3d: quadView
+                    targetNode: benchmarkTarget
+                    transformMode: GizmoEnums.TransformMode.World
+                    shapeAntialiasing: true
+                    gizmoSize: 80
+                    z: 1
+                }
+            }
+        }
+    }
+
     // Benchmark state
     property int frameCount: 0
     property real lastTimestamp: 0
@@ -270,6 +397,7 @@ Window {
     function printAllResults() {
         var sceneOnly = results[0]
         var withGizmo = results[1]
+        var quadView = results[2]
 
         console.log("[BENCHMARK] Gizmo3D Performance Benchmark")
         console.log("[BENCHMARK] Scene: " + objectCount + " objects, Mode: All, Transform: World")
@@ -277,6 +405,10 @@ Window {
                     ", Warmup: " + warmupFrames + ", Measured: " + measureFrames + " frames per phase")
         console.log("BENCHMARK_RESULTS_START")
 
+        // Build configuration, for comparing GIZMO3D_QML_AOT=ON and OFF runs
+        console.log("qml_compilation=" + qmlCompilation)
+        console.log("startup_ms=" + startupMs.toFixed(2))
+
         // Phase 1: scene only
         printPhase(sceneOnly, "scene_only.")
 
@@ -289,6 +421,11 @@ Window {
         console.log("gizmo_overhead_avg_ms=" + ftDelta.toFixed(2))
         console.log("gizmo_overhead_fps=" + fpsDelta.toFixed(2))
 
+        // Phase 3: four views, one gizmo set per view
+        printPhase(quadView, "quad_view_gizmo.")
+        var quadGeoPerView = quadView.geometryTime.avg / quadCameras.length
+        console.log("quad_view_geometry_per_view_avg_ms=" + quadGeoPerView.toFixed(2))
+
         console.log("BENCHMARK_RESULTS_END")
     }
 
@@ -301,23 +438,38 @@ Window {
             var now = Date.now()
 
             // Advance camera orbit: full 360 over measured frames
-            cameraOrbit.eulerRotation.y = (frameCount / measureFrames) * 360
+            orbitAngle = (frameCount / measureFrames) * 360
 
-            // Only run geometry updates during gizmo phase
+            // Only run geometry updates during gizmo phases
             var geoTime = 0
             if (gizmoActive) {
-                var projector = View3DProjectionAdapter.createProjector(view3d)
                 var geoStart = Date.now()
-                scaleGizmo.updateGeometry(projector)
-                translationGizmo.updateGeometry(projector)
-                rotationGizmo.updateGeometry(projector)
+                var projector = View3DProjectionAdapter.createProjector(view3d)
+                // One frame context for the three gizmos, as GlobalGizmo does
+                var context = GizmoFrameContext.create(projector, benchmarkTarget.scenePosition,
+                                                       translationGizmo.currentAxes)
+                scaleGizmo.updateGeometry(projector, context)
+                translationGizmo.updateGeometry(projector, context)
+                rotationGizmo.updateGeometry(projector, context)
                 geoTime = Date.now() - geoStart
+            } else if (quadActive) {
+                var quadStart = Date.now()
+                for (var v = 0; v < quadViews.count; v++) {
+                    var cell = quadViews.itemAt(v)
+                    var viewProjector = View3DProjectionAdapter.createProjector(cell.view)
+                    var viewContext = GizmoFrameContext.create(viewProjector, benchmarkTarget.scenePosition,
+                                                               cell.translationGizmo.currentAxes)
+                    cell.scaleGizmo.updateGeometry(viewProjector, viewContext)
+                    cell.translationGizmo.updateGeometry(viewProjector, viewContext)
+                    cell.rotationGizmo.updateGeometry(viewProjector, viewContext)
+                }
+                geoTime = Date.now() - quadStart
             }
 
             // Record measurements after warmup
             if (frameCount >= warmupFrames && lastTimestamp > 0) {
                 frameTimes.push(now - lastTimestamp)
-                if (gizmoActive)
+                if (gizmoActive || quadActive)
                     geometryTimes.push(geoTime)
             }
 
@@ -328,7 +480,7 @@ Window {
             if (frameCount >= warmupFrames + measureFrames) {
                 capturePhaseResults()
 
-                if (phase < 1) {
+                if (phase < phaseCount - 1) {
                     // Reset for next phase
                     phase++
                     frameCount = 0
@@ -359,8 +511,8 @@ Window {
             id: hudText
             anchors.centerIn: parent
             text: {
-                var phaseName = gizmoActive ? "Scene + Gizmo" : "Scene Only"
-                var phaseNum = (phase + 1) + "/2"
+                var phaseName = quadActive ? "Quad View + Gizmos" : gizmoActive ? "Scene + Gizmo" : "Scene Only"
+                var phaseNum = (phase + 1) + "/" + phaseCount
                 if (frameCount < warmupFrames)
                     return "Phase " + phaseNum + " [" + phaseName + "] Warmup: " + frameCount + "/" + warmupFrames
                 else
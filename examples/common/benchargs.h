@@ -0,0 +1,18 @@
+#ifndef GIZMO3D_EXAMPLES_BENCHARGS_H
+#define GIZMO3D_EXAMPLES_BENCHARGS_H
+
+#include <cstring>
+
+// Command-line flags that must be known before QGuiApplication exists (such as
+// --software-gl for OffscreenRenderer::configureProcess()), so they are read from argv
+// directly
+inline bool hasFlag(int argc, char *argv[], const char *flag)
+{
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], flag) == 0)
+            return true;
+    }
+    return false;
+}
+
+#endif // GIZMO3D_EXAMPLES_BENCHARGS_H
@@ -0,0 +1,74 @@
+#ifndef GIZMO3D_EXAMPLES_BENCHSTATS_H
+#define GIZMO3D_EXAMPLES_BENCHSTATS_H
+
+#include <QFile>
+#include <QJsonObject>
+#include <QtGlobal>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#ifdef Q_OS_UNIX
+#include <time.h>
+#include <unistd.h>
+#endif
+
+// Summary statistics for nanosecond samples, reported in milliseconds. Percentiles use
+// the nearest-rank method, as in examples/benchmark/main.qml.
+
+inline double percentileMs(const std::vector<qint64> &sorted, double p)
+{
+    const auto rank = qint64(std::ceil(p / 100.0 * double(sorted.size()))) - 1;
+    return sorted[size_t(std::max<qint64>(0, rank))] / 1.0e6;
+}
+
+inline QJsonObject stageStats(std::vector<qint64> samples)
+{
+    if (samples.empty())
+        return {};
+    std::sort(samples.begin(), samples.end());
+    qint64 total = 0;
+    for (qint64 ns : samples)
+        total += ns;
+    return {
+        {QStringLiteral("count"), qint64(samples.size())},
+        {QStringLiteral("avg_ms"), total / 1.0e6 / double(samples.size())},
+        {QStringLiteral("min_ms"), samples.front() / 1.0e6},
+        {QStringLiteral("max_ms"), samples.back() / 1.0e6},
+        {QStringLiteral("p50_ms"), percentileMs(samples, 50)},
+        {QStringLiteral("p95_ms"), percentileMs(samples, 95)},
+        {QStringLiteral("p99_ms"), percentileMs(samples, 99)},
+    };
+}
+
+// Resident set size in KiB, or -1 where /proc is unavailable
+inline long residentKiB()
+{
+#ifdef Q_OS_UNIX
+    QFile statm(QStringLiteral("/proc/self/statm"));
+    if (!statm.open(QIODevice::ReadOnly))
+        return -1;
+    const QList<QByteArray> fields = statm.readAll().split(' ');
+    if (fields.size() < 2)
+        return -1;
+    return fields.at(1).toLong() * (sysconf(_SC_PAGESIZE) / 1024);
+#else
+    return -1;
+#endif
+}
+
+// CPU time consumed by all threads of this process in ns, or -1 where unavailable
+inline qint64 processCpuNs()
+{
+#ifdef Q_OS_UNIX
+    timespec ts{};
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) != 0)
+        return -1;
+    return qint64(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#else
+    return -1;
+#endif
+}
+
+#endif // GIZMO3D_EXAMPLES_BENCHSTATS_H
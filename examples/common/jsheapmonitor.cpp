@@ -0,0 +1,106 @@
+#include "jsheapmonitor.h"
+
+#include "benchstats.h"
+
+#include <QJSEngine>
+
+#ifdef GIZMO3D_HAVE_QV4_STATS
+#include <private/qv4engine_p.h>
+#include <private/qv4mm_p.h>
+#endif
+
+#include <algorithm>
+
+namespace {
+
+struct HeapCounters
+{
+    qint64 used = 0;
+    qint64 allocated = 0;
+    qint64 largeItems = 0;
+};
+
+HeapCounters heapCounters(QJSEngine *engine)
+{
+#ifdef GIZMO3D_HAVE_QV4_STATS
+    const QV4::MemoryManager *mm = engine->handle()->memoryManager;
+    return {qint64(mm->getUsedMem()), qint64(mm->getAllocatedMem()), qint64(mm->getLargeItemsMem())};
+#else
+    Q_UNUSED(engine);
+    return {};
+#endif
+}
+
+QJsonObject byteStats(std::vector<qint64> samples)
+{
+    if (samples.empty())
+        return {};
+    std::sort(samples.begin(), samples.end());
+    qint64 total = 0;
+    for (qint64 bytes : samples)
+        total += bytes;
+    const auto at = [&samples](double p) {
+        const auto rank = qint64(std::ceil(p / 100.0 * double(samples.size()))) - 1;
+        return samples[size_t(std::max<qint64>(0, rank))];
+    };
+    return {
+        {QStringLiteral("avg"), double(total) / double(samples.size())},
+        {QStringLiteral("p50"), at(50)},
+        {QStringLiteral("p95"), at(95)},
+        {QStringLiteral("max"), samples.back()},
+    };
+}
+
+} // namespace
+
+JsHeapMonitor::JsHeapMonitor(QJSEngine *engine)
+    : m_engine(engine)
+{
+}
+
+bool JsHeapMonitor::isAvailable()
+{
+#ifdef GIZMO3D_HAVE_QV4_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void JsHeapMonitor::begin()
+{
+    if (isAvailable())
+        m_usedBefore = heapCounters(m_engine).used;
+}
+
+void JsHeapMonitor::end(qint64 stageNs)
+{
+    if (!isAvailable())
+        return;
+    const qint64 delta = heapCounters(m_engine).used - m_usedBefore;
+    if (delta < 0) {
+        m_gcStageNs.push_back(stageNs);
+    } else {
+        m_allocatedBytes.push_back(delta);
+        m_otherStageNs.push_back(stageNs);
+    }
+}
+
+QJsonObject JsHeapMonitor::report() const
+{
+    if (!isAvailable())
+        return {{QStringLiteral("available"), false}};
+
+    const HeapCounters heap = heapCounters(m_engine);
+    return {
+        {QStringLiteral("available"), true},
+        {QStringLiteral("stages"), qint64(m_gcStageNs.size() + m_otherStageNs.size())},
+        {QStringLiteral("gc_stages"), qint64(m_gcStageNs.size())},
+        {QStringLiteral("allocated_bytes"), byteStats(m_allocatedBytes)},
+        {QStringLiteral("gc_stage"), stageStats(m_gcStageNs)},
+        {QStringLiteral("other_stage"), stageStats(m_otherStageNs)},
+        {QStringLiteral("heap_used_bytes"), heap.used},
+        {QStringLiteral("heap_allocated_bytes"), heap.allocated},
+        {QStringLiteral("large_items_bytes"), heap.largeItems},
+    };
+}
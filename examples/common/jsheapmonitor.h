@@ -0,0 +1,50 @@
+#ifndef GIZMO3D_EXAMPLES_JSHEAPMONITOR_H
+#define GIZMO3D_EXAMPLES_JSHEAPMONITOR_H
+
+#include <QJsonObject>
+#include <QtGlobal>
+
+#include <vector>
+
+class QJSEngine;
+
+/**
+ * JsHeapMonitor - Samples the QML engine's JavaScript heap around a measured stage
+ *
+ * Reads the QV4 memory manager counters (the ones the QML profiler's memory view is
+ * built on) through Qt's private QML API, so it is only functional when the benchmarks
+ * are built against Qt6::QmlPrivate; otherwise isAvailable() is false and report()
+ * says so.
+ *
+ * Used heap that grows across a stage is what the stage allocated. Used heap that
+ * shrinks means the garbage collector ran inside the stage; those stages are timed
+ * separately so GC pauses show up as their own distribution instead of as spikes in
+ * the stage percentiles. Sampling walks the heap, so begin() and end() belong outside
+ * the timed region.
+ */
+class JsHeapMonitor
+{
+public:
+    explicit JsHeapMonitor(QJSEngine *engine);
+
+    static bool isAvailable();
+
+    void begin();
+    void end(qint64 stageNs);
+
+    /**
+     * @returns {available, stages, gc_stages, allocated_bytes: {avg, p50, p95, max},
+     *           gc_stage: {stage stats}, other_stage: {stage stats},
+     *           heap_used_bytes, heap_allocated_bytes, large_items_bytes}
+     */
+    QJsonObject report() const;
+
+private:
+    QJSEngine *m_engine;
+    qint64 m_usedBefore = 0;
+    std::vector<qint64> m_allocatedBytes;
+    std::vector<qint64> m_gcStageNs;
+    std::vector<qint64> m_otherStageNs;
+};
+
+#endif // GIZMO3D_EXAMPLES_JSHEAPMONITOR_H
@@ -0,0 +1,101 @@
+#include "offscreenrenderer.h"
+
+#include <QCoreApplication>
+#include <QOpenGLFunctions>
+#include <QQuickGraphicsDevice>
+#include <QQuickRenderControl>
+#include <QQuickRenderTarget>
+#include <QQuickWindow>
+#include <QtQuick3D/qquick3d.h>
+
+void OffscreenRenderer::configureProcess(bool softwareGl)
+{
+    if (softwareGl) {
+        QCoreApplication::setAttribute(Qt::AA_UseSoftwareOpenGL);
+        qputenv("LIBGL_ALWAYS_SOFTWARE", "1");
+    }
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QQuickWindow::setGraphicsApi(QSGRendererInterface::OpenGL);
+    QSurfaceFormat::setDefaultFormat(QQuick3D::idealSurfaceFormat());
+}
+
+OffscreenRenderer::OffscreenRenderer() = default;
+
+OffscreenRenderer::~OffscreenRenderer()
+{
+    // The window and render control release their GL resources with the context current
+    if (m_context.isValid())
+        m_context.makeCurrent(&m_surface);
+    m_window.reset();
+    m_renderControl.reset();
+    if (m_texture)
+        m_context.functions()->glDeleteTextures(1, &m_texture);
+}
+
+bool OffscreenRenderer::initialize(const QSize &size, QString *error)
+{
+    if (!m_context.create()) {
+        *error = QStringLiteral("Failed to create an OpenGL context (try --software-gl)");
+        return false;
+    }
+    m_surface.setFormat(m_context.format());
+    m_surface.create();
+    if (!m_context.makeCurrent(&m_surface)) {
+        *error = QStringLiteral("Failed to make the OpenGL context current");
+        return false;
+    }
+
+    m_renderControl = std::make_unique<QQuickRenderControl>();
+    m_window = std::make_unique<QQuickWindow>(m_renderControl.get());
+    m_window->setGeometry(0, 0, size.width(), size.height());
+    m_window->setGraphicsDevice(QQuickGraphicsDevice::fromOpenGLContext(&m_context));
+    if (!m_renderControl->initialize()) {
+        *error = QStringLiteral("Failed to initialize QQuickRenderControl");
+        return false;
+    }
+
+    QOpenGLFunctions *f = gl();
+    f->glGenTextures(1, &m_texture);
+    f->glBindTexture(GL_TEXTURE_2D, m_texture);
+    f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    f->glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size.width(), size.height(), 0, GL_RGBA,
+                    GL_UNSIGNED_BYTE, nullptr);
+    m_window->setRenderTarget(QQuickRenderTarget::fromOpenGLTexture(m_texture, size));
+    return true;
+}
+
+QOpenGLFunctions *OffscreenRenderer::gl() const
+{
+    return m_context.functions();
+}
+
+void OffscreenRenderer::polish()
+{
+    m_renderControl->polishItems();
+}
+
+void OffscreenRenderer::sync()
+{
+    m_renderControl->beginFrame();
+    m_renderControl->sync();
+}
+
+void OffscreenRenderer::render()
+{
+    m_renderControl->render();
+    m_renderControl->endFrame();
+    gl()->glFinish();
+}
+
+QString OffscreenRenderer::glRenderer() const
+{
+    return QString::fromLatin1(reinterpret_cast<const char *>(gl()->glGetString(GL_RENDERER)));
+}
+
+QString OffscreenRenderer::glVersion() const
+{
+    return QString::fromLatin1(reinterpret_cast<const char *>(gl()->glGetString(GL_VERSION)));
+}
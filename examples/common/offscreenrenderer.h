@@ -0,0 +1,70 @@
+#ifndef GIZMO3D_EXAMPLES_OFFSCREENRENDERER_H
+#define GIZMO3D_EXAMPLES_OFFSCREENRENDERER_H
+
+#include <QOffscreenSurface>
+#include <QOpenGLContext>
+#include <QSize>
+#include <QString>
+#include <qopengl.h>
+
+#include <memory>
+
+class QOpenGLFunctions;
+class QQuickRenderControl;
+class QQuickWindow;
+
+/**
+ * OffscreenRenderer - Drives a QQuickWindow through QQuickRenderControl into an
+ * offscreen OpenGL texture, one explicitly requested frame at a time
+ *
+ * Shared by the headless benchmarks: no native window, no vsync, and each frame
+ * stage (polish, sync, render) can be timed on its own. Input is delivered with
+ * QCoreApplication::sendEvent(window(), &event).
+ */
+class OffscreenRenderer
+{
+public:
+    /**
+     * Process-wide setup, to be called before QGuiApplication is constructed: offscreen
+     * QPA unless QT_QPA_PLATFORM is set, OpenGL scene graph, Qt Quick 3D surface format
+     * @param softwareGl - Use the software OpenGL rasterizer (no GPU)
+     */
+    static void configureProcess(bool softwareGl);
+
+    OffscreenRenderer();
+    ~OffscreenRenderer();
+
+    /**
+     * Creates the GL context, render target and window
+     * @returns false with error set if OpenGL or the render control is unavailable
+     */
+    bool initialize(const QSize &size, QString *error);
+
+    QQuickWindow *window() const { return m_window.get(); }
+    // renderRequested/sceneChanged tell an event-driven loop when a frame is wanted
+    QQuickRenderControl *renderControl() const { return m_renderControl.get(); }
+    QOpenGLFunctions *gl() const;
+
+    void polish();
+    void sync();    // beginFrame() + scene-graph sync
+    void render();  // render + endFrame(), then glFinish so GPU work is included
+
+    void renderFrame()
+    {
+        polish();
+        sync();
+        render();
+    }
+
+    QString glRenderer() const;
+    QString glVersion() const;
+
+private:
+    QOpenGLContext m_context;
+    QOffscreenSurface m_surface;
+    std::unique_ptr<QQuickRenderControl> m_renderControl;
+    std::unique_ptr<QQuickWindow> m_window;
+    GLuint m_texture = 0;
+};
+
+#endif // GIZMO3D_EXAMPLES_OFFSCREENRENDERER_H
@@ -0,0 +1,203 @@
+import QtQuick
+import QtQuick3D
+import Gizmo3D
+
+// Deterministic scene for the drag replay benchmark (main.cpp): a fixed camera, one
+// target and a GlobalGizmo whose deltas are applied to the target like a controller
+// would. The runner calls prepare(), updateGeometry() and synthesizeTrace(); pointer
+// events arrive through the window as synthesized QMouseEvents.
+Item {
+    id: root
+
+    // Signal counters since the last prepare()
+    property int startedCount: 0
+    property int deltaCount: 0
+    property int endedCount: 0
+
+    Component.onCompleted: GizmoLatency.enabled = true
+
+    /**
+     * Resets the target and the counters for the next drag
+     * @param mode - GizmoEnums.Mode for the gizmo
+     * @param snap - Whether snapping is enabled
+     */
+    function prepare(mode: int, snap: bool): void {
+        targetModel.position = Qt.vector3d(0, 0, 0)
+        targetModel.rotation = Qt.quaternion(1, 0, 0, 0)
+        targetModel.scale = Qt.vector3d(1, 1, 1)
+        gizmo.mode = mode
+        gizmo.snapEnabled = snap
+        startedCount = 0
+        deltaCount = 0
+        endedCount = 0
+        GizmoLatency.reset()
+    }
+
+    // Input-to-present latency of the drags since the last prepare() (see GizmoLatency)
+    function latencyReport(): var {
+        return GizmoLatency.report()
+    }
+
+    // One frame's gizmo work, as GlobalGizmo's FrameAnimation would do it
+    function updateGeometry(): void {
+        gizmo.frameUpdate()
+    }
+
+    /**
+     * Builds a press, move..., release trace that grabs a handle of the current geometry
+     * @param kind - "axis", "plane", "ring" or "uniform"
+     * @param steps - Number of move events
+     * @param intervalMs - Time between events
+     * @returns Array of {t, type: "press"|"move"|"release", x, y}, empty if the handle
+     *          is not on screen
+     */
+    function synthesizeTrace(kind: string, steps: int, intervalMs: real): var {
+        var start = null
+        var stepFor = null
+
+        if (kind === "axis" || kind === "plane") {
+            var tg = gizmo.translationGizmo ? gizmo.translationGizmo.geometry : null
+            if (!tg) return []
+            if (kind === "axis") {
+                // 70% along the X arrow, then along its screen direction
+                var ax = tg.xEnd.x - tg.xStart.x
+                var ay = tg.xEnd.y - tg.xStart.y
+                var len = Math.max(Math.sqrt(ax * ax + ay * ay), 1e-6)
+                start = Qt.point(tg.xStart.x + ax * 0.7, tg.xStart.y + ay * 0.7)
+                stepFor = i => Qt.point(start.x + ax / len * 2 * i, start.y + ay / len * 2 * i)
+            } else {
+                var corners = tg.planes.xy
+                start = Qt.point((corners[0].x + corners[1].x + corners[2].x + corners[3].x) / 4,
+                                 (corners[0].y + corners[1].y + corners[2].y + corners[3].y) / 4)
+                stepFor = i => Qt.point(start.x + 1.5 * i, start.y - 1.0 * i)
+            }
+        } else if (kind === "ring") {
+            var rg = gizmo.rotationGizmo ? gizmo.rotationGizmo.geometry : null
+            if (!rg) return []
+            // First point of the Z ring that hit-tests as the Z ring (visible arc)
+            var ring = rg.circles.xy
+            for (var p = 0; p < ring.length && !start; p++) {
+                if (gizmo.rotationGizmo.getHitAxis(ring[p].x, ring[p].y) === GizmoEnums.Axis.Z)
+                    start = Qt.point(ring[p].x, ring[p].y)
+            }
+            if (!start) return []
+            var cx = rg.center.x
+            var cy = rg.center.y
+            var radius = Math.sqrt((start.x - cx) * (start.x - cx) + (start.y - cy) * (start.y - cy))
+            var angle0 = Math.atan2(start.y - cy, start.x - cx)
+            stepFor = i => Qt.point(cx + Math.cos(angle0 + i * Math.PI / 120) * radius,
+                                    cy + Math.sin(angle0 + i * Math.PI / 120) * radius)
+        } else if (kind === "uniform") {
+            var sg = gizmo.scaleGizmo ? gizmo.scaleGizmo.geometry : null
+            if (!sg) return []
+            start = Qt.point(sg.center.x, sg.center.y)
+            stepFor = i => Qt.point(start.x + 2 * i, start.y - 2 * i)
+        } else {
+            return []
+        }
+
+        var trace = [{ t: 0, type: "press", x: start.x, y: start.y }]
+        for (var i = 1; i <= steps; i++) {
+            var point = stepFor(i)
+            trace.push({ t: i * intervalMs, type: "move", x: point.x, y: point.y })
+        }
+        var last = stepFor(steps)
+        trace.push({ t: (steps + 1) * intervalMs, type: "release", x: last.x, y: last.y })
+        return trace
+    }
+
+    View3D {
+        id: view3d
+        anchors.fill: parent
+
+        environment: SceneEnvironment {
+            clearColor: "#1a1a2e"
+            backgroundMode: SceneEnvironment.Color
+        }
+
+        PerspectiveCamera {
+            position: Qt.vector3d(0, 200, 400)
+            eulerRotation.x: -25
+            clipNear: 1
+            clipFar: 10000
+        }
+
+        DirectionalLight {
+            eulerRotation.x: -30
+            eulerRotation.y: -70
+        }
+
+        Model {
+            id: targetModel
+            source: "#Cube"
+            materials: PrincipledMaterial {
+                baseColor: "#ffffff"
+            }
+        }
+    }
+
+    GlobalGizmo {
+        id: gizmo
+        anchors.fill: parent
+        managedByParent: true
+        view3d: view3d
+        targetNode: targetModel
+        snapIncrement: 10
+        snapAngle: 15
+        scaleSnapIncrement: 0.25
+    }
+
+    // Controller: applies every delta to the target, so the drag also pays for the
+    // target update and the geometry refresh it triggers
+    Connections {
+        target: gizmo
+
+        property vector3d startPosition
+        property quaternion startRotation
+        property vector3d startScale
+
+        function begin(): void {
+            startPosition = targetModel.position
+            startRotation = targetModel.rotation
+            startScale = targetModel.scale
+            root.startedCount++
+        }
+
+        function onAxisTranslationStarted(axis: int) { begin() }
+        function onPlaneTranslationStarted(plane: int) { begin() }
+        function onRotationStarted(axis: int) { begin() }
+        function onScaleStarted(axis: int) { begin() }
+
+        function onAxisTranslationDelta(axis: int, transformMode: int, delta: real, snapActive: bool) {
+            var dir = axis === GizmoEnums.Axis.X ? Qt.vector3d(1, 0, 0)
+                    : axis === GizmoEnums.Axis.Y ? Qt.vector3d(0, 1, 0) : Qt.vector3d(0, 0, 1)
+            targetModel.position = startPosition.plus(dir.times(delta))
+            root.deltaCount++
+        }
+
+        function onPlaneTranslationDelta(plane: int, transformMode: int, delta: vector3d, snapActive: bool) {
+            targetModel.position = startPosition.plus(delta)
+            root.deltaCount++
+        }
+
+        function onRotationDelta(axis: int, transformMode: int, angleDegrees: real, snapActive: bool) {
+            var dir = axis === GizmoEnums.Axis.X ? Qt.vector3d(1, 0, 0)
+                    : axis === GizmoEnums.Axis.Y ? Qt.vector3d(0, 1, 0) : Qt.vector3d(0, 0, 1)
+            targetModel.rotation = GizmoMath.quaternionFromAxisAngle(dir, angleDegrees).times(startRotation)
+            root.deltaCount++
+        }
+
+        function onScaleDelta(axis: int, transformMode: int, scaleFactor: real, snapActive: bool) {
+            targetModel.scale = axis === GizmoEnums.Axis.Uniform ? startScale.times(scaleFactor)
+                         : axis === GizmoEnums.Axis.X ? Qt.vector3d(startScale.x * scaleFactor, startScale.y, startScale.z)
+                         : axis === GizmoEnums.Axis.Y ? Qt.vector3d(startScale.x, startScale.y * scaleFactor, startScale.z)
+                         : Qt.vector3d(startScale.x, startScale.y, startScale.z * scaleFactor)
+            root.deltaCount++
+        }
+
+        function onAxisTranslationEnded(axis: int) { root.endedCount++ }
+        function onPlaneTranslationEnded(plane: int) { root.endedCount++ }
+        function onRotationEnded(axis: int) { root.endedCount++ }
+        function onScaleEnded(axis: int) { root.endedCount++ }
+    }
+}
@@ -0,0 +1,370 @@
+// Drag replay benchmark
+//
+// Replays pointer traces into a GlobalGizmo as synthesized QMouseEvents, rendered
+// offscreen through QQuickRenderControl, and measures what a user feels while
+// dragging: the time the gizmo takes to process each press/move/release (hit test,
+// ray math, signal emission, the controller's target update) and the following frame.
+// GizmoLatency is enabled, so each trace also reports its input-to-present latency.
+//
+// Without --trace, five traces are synthesized from the gizmo's own geometry, so every
+// run drags the same handles along the same paths:
+//   axis       X arrow of the translation gizmo
+//   plane      XY plane handle
+//   ring       Z rotation ring (tangential drag)
+//   uniform    scale gizmo center handle
+//   axis_snap  X arrow with snapping enabled
+//
+// A recorded trace is a text file with one event per line, "<t_ms> <press|move|release>
+// <x> <y>", '#' starting a comment; --mode and --snap configure the gizmo for it.
+//
+// --js-heap adds a "js_heap" block per trace: JavaScript bytes allocated per move event
+// and the move events in which the garbage collector ran (see JsHeapMonitor).
+//
+// Usage: gizmo3d_drag_replay [--steps N] [--trace file [--mode translate|rotate|scale] [--snap]]
+//                            [--size WxH] [--software-gl] [--js-heap] [--output report.json]
+
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QGuiApplication>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJSValue>
+#include <QMouseEvent>
+#include <QQmlComponent>
+#include <QQmlEngine>
+#include <QQuickItem>
+#include <QQuickWindow>
+#include <QTextStream>
+
+#include "benchargs.h"
+#include "benchstats.h"
+#include "jsheapmonitor.h"
+#include "offscreenrenderer.h"
+
+#include <cstdio>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// GizmoEnums.Mode values
+constexpr int kModeTranslate = 0;
+constexpr int kModeRotate = 1;
+constexpr int kModeScale = 2;
+
+constexpr double kEventIntervalMs = 8.0;  // 125 Hz pointer
+
+struct TraceEvent
+{
+    double t = 0.0;
+    QEvent::Type type = QEvent::MouseMove;
+    QPointF pos;
+};
+
+struct Scenario
+{
+    QString name;
+    QString kind;  // synthesized trace kind, empty for a recorded trace
+    int mode = kModeTranslate;
+    bool snap = false;
+    std::vector<TraceEvent> trace;
+};
+
+QEvent::Type eventType(const QString &name)
+{
+    if (name == QLatin1StringView("press"))
+        return QEvent::MouseButtonPress;
+    if (name == QLatin1StringView("release"))
+        return QEvent::MouseButtonRelease;
+    return QEvent::MouseMove;
+}
+
+bool loadTrace(const QString &path, std::vector<TraceEvent> &trace, QString *error)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        *error = QStringLiteral("Cannot read %1").arg(path);
+        return false;
+    }
+    QTextStream in(&file);
+    int lineNumber = 0;
+    while (!in.atEnd()) {
+        const QString line = in.readLine().section(QLatin1Char('#'), 0, 0).trimmed();
+        ++lineNumber;
+        if (line.isEmpty())
+            continue;
+        const QStringList fields = line.split(QLatin1Char(' '), Qt::SkipEmptyParts);
+        if (fields.size() != 4) {
+            *error = QStringLiteral("%1:%2: expected \"<t_ms> <type> <x> <y>\"").arg(path).arg(lineNumber);
+            return false;
+        }
+        trace.push_back({fields[0].toDouble(), eventType(fields[1]),
+                         QPointF(fields[2].toDouble(), fields[3].toDouble())});
+    }
+    return !trace.empty();
+}
+
+std::vector<TraceEvent> toTrace(const QVariantList &events)
+{
+    std::vector<TraceEvent> trace;
+    trace.reserve(size_t(events.size()));
+    for (const QVariant &value : events) {
+        const QVariantMap event = value.toMap();
+        trace.push_back({event.value(QStringLiteral("t")).toDouble(),
+                         eventType(event.value(QStringLiteral("type")).toString()),
+                         QPointF(event.value(QStringLiteral("x")).toDouble(),
+                                 event.value(QStringLiteral("y")).toDouble())});
+    }
+    return trace;
+}
+
+// Values returned by JavaScript functions arrive wrapped in a QJSValue
+QVariant plainVariant(const QVariant &value)
+{
+    if (value.metaType() == QMetaType::fromType<QJSValue>())
+        return value.value<QJSValue>().toVariant();
+    return value;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const bool softwareGl = hasFlag(argc, argv, "--software-gl");
+    OffscreenRenderer::configureProcess(softwareGl);
+
+    QGuiApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Gizmo3D drag replay benchmark"));
+    parser.addHelpOption();
+    const QCommandLineOption stepsOption(QStringLiteral("steps"),
+                                         QStringLiteral("Move events per synthesized drag."),
+                                         QStringLiteral("count"), QStringLiteral("240"));
+    const QCommandLineOption traceOption(QStringLiteral("trace"),
+                                         QStringLiteral("Recorded trace to replay instead."),
+                                         QStringLiteral("file"));
+    const QCommandLineOption modeOption(QStringLiteral("mode"),
+                                        QStringLiteral("Gizmo mode for --trace: translate, rotate or scale."),
+                                        QStringLiteral("mode"), QStringLiteral("translate"));
+    const QCommandLineOption snapOption(QStringLiteral("snap"),
+                                        QStringLiteral("Enable snapping for --trace."));
+    const QCommandLineOption sizeOption(QStringLiteral("size"),
+                                        QStringLiteral("Render target size."),
+                                        QStringLiteral("WxH"), QStringLiteral("1280x800"));
+    const QCommandLineOption softwareOption(QStringLiteral("software-gl"),
+                                            QStringLiteral("Use software OpenGL (no GPU)."));
+    const QCommandLineOption jsHeapOption(QStringLiteral("js-heap"),
+                                          QStringLiteral("Report JS allocations and GC pauses of move events."));
+    const QCommandLineOption outputOption(QStringLiteral("output"),
+                                          QStringLiteral("JSON report path (default: stdout)."),
+                                          QStringLiteral("file"));
+    parser.addOptions({stepsOption, traceOption, modeOption, snapOption, sizeOption,
+                       softwareOption, jsHeapOption, outputOption});
+    parser.process(app);
+
+    const int steps = qMax(1, parser.value(stepsOption).toInt());
+    const bool sampleJsHeap = parser.isSet(jsHeapOption);
+    const QStringList sizeParts = parser.value(sizeOption).split(QLatin1Char('x'));
+    const QSize size(sizeParts.value(0).toInt(), sizeParts.value(1).toInt());
+    if (size.isEmpty()) {
+        std::fprintf(stderr, "Invalid --size\n");
+        return 2;
+    }
+
+    std::vector<Scenario> scenarios;
+    if (parser.isSet(traceOption)) {
+        const QString modeName = parser.value(modeOption);
+        Scenario recorded;
+        recorded.name = QFileInfo(parser.value(traceOption)).baseName();
+        recorded.mode = modeName == QLatin1StringView("rotate") ? kModeRotate
+                      : modeName == QLatin1StringView("scale") ? kModeScale : kModeTranslate;
+        recorded.snap = parser.isSet(snapOption);
+        QString error;
+        if (!loadTrace(parser.value(traceOption), recorded.trace, &error)) {
+            std::fprintf(stderr, "%s\n", qPrintable(error.isEmpty() ? QStringLiteral("Empty trace") : error));
+            return 2;
+        }
+        scenarios.push_back(std::move(recorded));
+    } else {
+        scenarios = {
+            {QStringLiteral("axis"), QStringLiteral("axis"), kModeTranslate, false, {}},
+            {QStringLiteral("plane"), QStringLiteral("plane"), kModeTranslate, false, {}},
+            {QStringLiteral("ring"), QStringLiteral("ring"), kModeRotate, false, {}},
+            {QStringLiteral("uniform"), QStringLiteral("uniform"), kModeScale, false, {}},
+            {QStringLiteral("axis_snap"), QStringLiteral("axis"), kModeTranslate, true, {}},
+        };
+    }
+
+    OffscreenRenderer renderer;
+    QString error;
+    if (!renderer.initialize(size, &error)) {
+        std::fprintf(stderr, "%s\n", qPrintable(error));
+        return 1;
+    }
+    QQuickWindow *window = renderer.window();
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, QUrl(QStringLiteral("qrc:/qt/qml/DragReplay/Scene.qml")));
+    std::unique_ptr<QQuickItem> scene(qobject_cast<QQuickItem *>(component.create()));
+    if (!scene) {
+        std::fprintf(stderr, "%s\n", qPrintable(component.errorString()));
+        return 1;
+    }
+    scene->setParentItem(window->contentItem());
+    scene->setSize(size);
+
+    const auto frame = [&]() {
+        QMetaObject::invokeMethod(scene.get(), "updateGeometry");
+        renderer.renderFrame();
+    };
+
+    std::fprintf(stderr, "[BENCHMARK] Gizmo3D drag replay\n");
+    std::fprintf(stderr, "[BENCHMARK] Target: %dx%d, Scenarios: %d\n", size.width(), size.height(),
+                 int(scenarios.size()));
+
+    QJsonObject results;
+    QElapsedTimer timer;
+
+    for (Scenario &scenario : scenarios) {
+        QMetaObject::invokeMethod(scene.get(), "prepare", Q_ARG(int, scenario.mode),
+                                  Q_ARG(bool, scenario.snap));
+        // Two frames: the first creates the child gizmo and its camera, the second its geometry
+        frame();
+        frame();
+
+        if (!scenario.kind.isEmpty()) {
+            QVariant events;
+            QMetaObject::invokeMethod(scene.get(), "synthesizeTrace", Q_RETURN_ARG(QVariant, events),
+                                      Q_ARG(QString, scenario.kind), Q_ARG(int, steps),
+                                      Q_ARG(double, kEventIntervalMs));
+            scenario.trace = toTrace(plainVariant(events).toList());
+        }
+        if (scenario.trace.empty()) {
+            std::fprintf(stderr, "[BENCHMARK] %s: handle not on screen, skipped\n",
+                         qPrintable(scenario.name));
+            continue;
+        }
+
+        std::vector<qint64> pressNs;
+        std::vector<qint64> moveNs;
+        std::vector<qint64> releaseNs;
+        std::vector<qint64> frameNs;
+        JsHeapMonitor jsHeap(&engine);
+        moveNs.reserve(scenario.trace.size());
+        frameNs.reserve(scenario.trace.size());
+
+        Qt::MouseButtons buttons = Qt::NoButton;
+        for (const TraceEvent &traceEvent : scenario.trace) {
+            if (traceEvent.type == QEvent::MouseButtonPress)
+                buttons = Qt::LeftButton;
+            else if (traceEvent.type == QEvent::MouseButtonRelease)
+                buttons = Qt::NoButton;
+            const Qt::MouseButton button = traceEvent.type == QEvent::MouseMove ? Qt::NoButton
+                                                                                : Qt::LeftButton;
+            QMouseEvent event(traceEvent.type, traceEvent.pos, traceEvent.pos, button, buttons,
+                              Qt::NoModifier);
+            event.setTimestamp(quint64(traceEvent.t));
+            const bool sampleHeap = sampleJsHeap && traceEvent.type == QEvent::MouseMove;
+            if (sampleHeap)
+                jsHeap.begin();
+
+            timer.start();
+            QCoreApplication::sendEvent(window, &event);
+            const qint64 eventNs = timer.nsecsElapsed();
+
+            if (sampleHeap)
+                jsHeap.end(eventNs);
+
+            if (traceEvent.type == QEvent::MouseButtonPress)
+                pressNs.push_back(eventNs);
+            else if (traceEvent.type == QEvent::MouseButtonRelease)
+                releaseNs.push_back(eventNs);
+            else
+                moveNs.push_back(eventNs);
+
+            timer.start();
+            frame();
+            frameNs.push_back(timer.nsecsElapsed());
+        }
+
+        const QQuickItem *root = scene.get();
+        const int started = root->property("startedCount").toInt();
+        const int deltas = root->property("deltaCount").toInt();
+        const int ended = root->property("endedCount").toInt();
+        const double traceSeconds = (scenario.trace.back().t - scenario.trace.front().t) / 1000.0;
+
+        QVariant latency;
+        QMetaObject::invokeMethod(scene.get(), "latencyReport", Q_RETURN_ARG(QVariant, latency));
+
+        qint64 moveTotalNs = 0;
+        for (qint64 ns : moveNs)
+            moveTotalNs += ns;
+
+        QJsonObject result{
+            {QStringLiteral("mode"), scenario.mode},
+            {QStringLiteral("snap"), scenario.snap},
+            {QStringLiteral("events"), qint64(scenario.trace.size())},
+            {QStringLiteral("grabbed"), started > 0},
+            {QStringLiteral("press"), stageStats(pressNs)},
+            {QStringLiteral("move"), stageStats(moveNs)},
+            {QStringLiteral("release"), stageStats(releaseNs)},
+            {QStringLiteral("frame"), stageStats(frameNs)},
+            {QStringLiteral("started_signals"), started},
+            {QStringLiteral("delta_signals"), deltas},
+            {QStringLiteral("ended_signals"), ended},
+            {QStringLiteral("deltas_per_move"), moveNs.empty() ? 0.0 : double(deltas) / double(moveNs.size())},
+            {QStringLiteral("deltas_per_trace_second"), traceSeconds > 0.0 ? deltas / traceSeconds : 0.0},
+            {QStringLiteral("moves_per_cpu_second"),
+             moveTotalNs > 0 ? double(moveNs.size()) * 1.0e9 / double(moveTotalNs) : 0.0},
+            {QStringLiteral("latency"), QJsonObject::fromVariantMap(plainVariant(latency).toMap())},
+        };
+        if (sampleJsHeap)
+            result.insert(QStringLiteral("js_heap"), jsHeap.report());
+        results.insert(scenario.name, result);
+
+        if (started == 0) {
+            std::fprintf(stderr, "[BENCHMARK] %s: press did not grab a handle\n",
+                         qPrintable(scenario.name));
+        }
+    }
+
+    const QJsonObject report{
+        {QStringLiteral("benchmark"), QStringLiteral("gizmo3d_drag_replay")},
+        {QStringLiteral("config"), QJsonObject{
+            {QStringLiteral("steps"), steps},
+            {QStringLiteral("event_interval_ms"), kEventIntervalMs},
+            {QStringLiteral("trace"), parser.value(traceOption)},
+            {QStringLiteral("width"), size.width()},
+            {QStringLiteral("height"), size.height()},
+        }},
+        {QStringLiteral("environment"), QJsonObject{
+            {QStringLiteral("qt_version"), QLatin1StringView(qVersion())},
+            {QStringLiteral("qpa_platform"), QGuiApplication::platformName()},
+            {QStringLiteral("software_gl"), softwareGl},
+            {QStringLiteral("gl_renderer"), renderer.glRenderer()},
+        }},
+        {QStringLiteral("scenarios"), results},
+    };
+
+    scene.reset();
+
+    const QByteArray json = QJsonDocument(report).toJson(QJsonDocument::Indented);
+    const QString outputPath = parser.value(outputOption);
+    if (outputPath.isEmpty()) {
+        std::fwrite(json.constData(), 1, size_t(json.size()), stdout);
+        return 0;
+    }
+
+    QFile output(outputPath);
+    if (!output.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        std::fprintf(stderr, "Cannot write %s\n", qPrintable(outputPath));
+        return 1;
+    }
+    output.write(json);
+    std::fprintf(stderr, "[BENCHMARK] Report written to %s\n", qPrintable(outputPath));
+    return 0;
+}
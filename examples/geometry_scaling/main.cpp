@@ -0,0 +1,158 @@
+// Many-gizmo geometry scaling benchmark
+//
+// Computes the screen-space geometry of N gizmos (translation arrows, scale handles and
+// rotation circles in equal parts) for an orbiting camera, the same work
+// GizmoFrameCoordinator fans out each frame, at 1, 2, 4, ... threads up to the ideal
+// thread count. Reports time per frame, speedup and parallel efficiency per thread count.
+//
+// Usage: gizmo3d_geometry_scaling [gizmoCount] [frames]
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QMatrix4x4>
+#include <QThread>
+#include <QThreadPool>
+#include <QtMath>
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "core/camerasnapshot.h"
+#include "core/gizmogeometry.h"
+#include "gizmoparallel.h"
+
+using namespace gizmo3d::core;
+
+namespace {
+
+constexpr float kViewportWidth = 1920.0f;
+constexpr float kViewportHeight = 1080.0f;
+constexpr int kWarmupFrames = 20;
+constexpr int kChunkSize = 16;
+
+struct Gizmo
+{
+    ArrowParams arrow;
+    CircleParams circle;
+    ArrowGeometry arrowGeometry;
+    CircleGeometry circleGeometry;
+    int kind = 0;  // 0 = arrow, 1 = handle, 2 = circle
+};
+
+CameraSnapshot orbitCamera(int frame)
+{
+    const float angle = qDegreesToRadians(float(frame) * 0.5f);
+    QMatrix4x4 transform;
+    transform.rotate(qRadiansToDegrees(angle), 0.0f, 1.0f, 0.0f);
+    transform.rotate(-20.0f, 1.0f, 0.0f, 0.0f);
+    transform.translate(0.0f, 0.0f, 1500.0f);
+
+    QMatrix4x4 projection;
+    projection.perspective(60.0f, kViewportWidth / kViewportHeight, 10.0f, 10000.0f);
+    const QMatrix4x4 viewProjection = projection * transform.inverted();
+
+    CameraSnapshot snapshot;
+    std::memcpy(snapshot.viewProjection.m, viewProjection.constData(), sizeof(snapshot.viewProjection.m));
+    const QVector3D position = transform.column(3).toVector3D();
+    const QVector3D forward = -transform.column(2).toVector3D().normalized();
+    snapshot.position = {position.x(), position.y(), position.z()};
+    snapshot.forward = {forward.x(), forward.y(), forward.z()};
+    snapshot.viewportWidth = kViewportWidth;
+    snapshot.viewportHeight = kViewportHeight;
+    snapshot.clipNear = 10.0f;
+    return snapshot;
+}
+
+std::vector<Gizmo> makeGizmos(int count)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> spread(-500.0f, 500.0f);
+
+    std::vector<Gizmo> gizmos(size_t(count));
+    for (int i = 0; i < count; ++i) {
+        Gizmo &g = gizmos[size_t(i)];
+        g.kind = i % 3;
+        const Vec3 position{spread(rng), spread(rng), spread(rng)};
+        g.arrow.targetPosition = position;
+        g.circle.targetPosition = position;
+    }
+    return gizmos;
+}
+
+void computeGizmo(const CameraSnapshot &camera, Gizmo &g)
+{
+    switch (g.kind) {
+    case 0:
+        computeArrowGeometry(camera, g.arrow, g.arrowGeometry);
+        break;
+    case 1:
+        computeHandleGeometry(camera, g.arrow, g.arrowGeometry);
+        break;
+    default:
+        computeCircleGeometry(camera, g.circle, g.circleGeometry);
+        g.circle.previousRadii = g.circleGeometry.radii;
+        g.circle.hasPreviousRadii = true;
+        break;
+    }
+}
+
+// Average ms per frame with the calling thread plus (threads - 1) pool workers
+double measure(std::vector<Gizmo> &gizmos, int threads, int frames)
+{
+    QThreadPool pool;
+    pool.setMaxThreadCount(qMax(1, threads - 1));
+    QThreadPool *workers = threads > 1 ? &pool : nullptr;
+
+    auto runFrame = [&](int frame) {
+        const CameraSnapshot camera = orbitCamera(frame);
+        gizmo3d::forEachChunk(workers, int(gizmos.size()), kChunkSize, [&](int begin, int end) {
+            for (int i = begin; i < end; ++i)
+                computeGizmo(camera, gizmos[size_t(i)]);
+        });
+    };
+
+    for (int frame = 0; frame < kWarmupFrames; ++frame)
+        runFrame(frame);
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int frame = 0; frame < frames; ++frame)
+        runFrame(kWarmupFrames + frame);
+    return timer.nsecsElapsed() / 1.0e6 / frames;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    const QStringList args = app.arguments();
+    const int gizmoCount = args.size() > 1 ? qMax(1, args.at(1).toInt()) : 1000;
+    const int frames = args.size() > 2 ? qMax(1, args.at(2).toInt()) : 200;
+    const int maxThreads = qMax(1, QThread::idealThreadCount());
+
+    std::vector<Gizmo> gizmos = makeGizmos(gizmoCount);
+
+    std::printf("[BENCHMARK] Gizmo3D geometry scaling\n");
+    std::printf("[BENCHMARK] Gizmos: %d (arrows/handles/circles), Frames: %d, Ideal threads: %d\n",
+                gizmoCount, frames, maxThreads);
+    std::printf("BENCHMARK_RESULTS_START\n");
+
+    double serialMs = 0.0;
+    for (int threads = 1; ; threads = qMin(threads * 2, maxThreads)) {
+        const double ms = measure(gizmos, threads, frames);
+        if (threads == 1)
+            serialMs = ms;
+        const double speedup = ms > 0.0 ? serialMs / ms : 0.0;
+        std::printf("threads_%d.frame_avg_ms=%.3f\n", threads, ms);
+        std::printf("threads_%d.speedup=%.2f\n", threads, speedup);
+        std::printf("threads_%d.efficiency=%.2f\n", threads, speedup / threads);
+        if (threads == maxThreads)
+            break;
+    }
+
+    std::printf("BENCHMARK_RESULTS_END\n");
+    return 0;
+}
@@ -0,0 +1,143 @@
+import QtQuick
+import QtQuick3D
+import Gizmo3D
+
+// Scene driven frame by frame by the headless benchmark runner (main.cpp).
+// Nothing here animates on its own: the runner calls advance(), updateGeometry()
+// and hitTest() explicitly so each stage can be timed separately.
+Item {
+    id: root
+
+    // Set by main.cpp from the command line
+    property int objectCount: 10000
+    property int gizmoMode: GizmoEnums.Mode.All
+    property int transformMode: GizmoEnums.TransformMode.World
+
+    // Camera orbit angle in degrees, set by advance()
+    property real orbitAngle: 0
+
+    // Screen position of the gizmo center, refreshed by advance() for the hit test
+    property point _center: Qt.point(width / 2, height / 2)
+
+    // Deterministic hash from index for pseudo-random distribution
+    function hash(n: real): real {
+        var x = Math.sin(n * 127.1 + 311.7) * 43758.5453
+        return x - Math.floor(x)
+    }
+
+    readonly property var meshTypes: ["#Cube", "#Sphere", "#Cylinder", "#Cone", "#Cube"]
+
+    /**
+     * Moves the camera to the given frame of a full orbit
+     * @param frame - Frame index
+     * @param frameCount - Frames per full 360° orbit
+     */
+    function advance(frame: int, frameCount: int): void {
+        orbitAngle = (frame / Math.max(1, frameCount)) * 360
+        var screen = view3d.mapFrom3DScene(benchmarkTarget.scenePosition)
+        _center = Qt.point(screen.x, screen.y)
+    }
+
+    // Geometry stage: what GlobalGizmo's FrameAnimation does every frame
+    function updateGeometry(): void {
+        gizmo.frameUpdate()
+    }
+
+    /**
+     * Hit-test stage: probes a ring of points around the gizmo center with every
+     * visible child gizmo, like hovering does
+     * @returns Number of probes that hit a handle
+     */
+    function hitTest(): int {
+        var hits = 0
+        for (var ring = 1; ring <= 4; ring++) {
+            var radius = ring * 25
+            for (var i = 0; i < 8; i++) {
+                var angle = i * Math.PI / 4
+                var x = _center.x + Math.cos(angle) * radius
+                var y = _center.y + Math.sin(angle) * radius
+                if (gizmo.translationGizmo && gizmo.translationGizmo.visible &&
+                    gizmo.translationGizmo.getHitRegion(x, y).type !== "none") hits++
+                if (gizmo.scaleGizmo && gizmo.scaleGizmo.visible &&
+                    gizmo.scaleGizmo.getHitRegion(x, y).type !== "none") hits++
+                if (gizmo.rotationGizmo && gizmo.rotationGizmo.visible &&
+                    gizmo.rotationGizmo.getHitAxis(x, y) !== GizmoEnums.Axis.None) hits++
+            }
+        }
+        return hits
+    }
+
+    View3D {
+        id: view3d
+        anchors.fill: parent
+        camera: camera
+
+        environment: SceneEnvironment {
+            clearColor: "#1a1a2e"
+            backgroundMode: SceneEnvironment.Color
+        }
+
+        Node {
+            eulerRotation.y: root.orbitAngle
+
+            PerspectiveCamera {
+                id: camera
+                position: Qt.vector3d(0, 500, 800)
+                eulerRotation.x: -30
+                clipFar: 50000
+                clipNear: 1
+            }
+        }
+
+        DirectionalLight {
+            eulerRotation.x: -30
+            eulerRotation.y: -70
+            ambientColor: Qt.rgba(0.3, 0.3, 0.3, 1.0)
+        }
+
+        // Rotated so Local and World transform modes draw different axes
+        Model {
+            id: benchmarkTarget
+            source: "#Cube"
+            position: Qt.vector3d(0, 50, 0)
+            eulerRotation: Qt.vector3d(20, 35, 10)
+            scale: Qt.vector3d(0.5, 0.5, 0.5)
+            materials: PrincipledMaterial {
+                baseColor: "#ffffff"
+            }
+        }
+
+        Repeater3D {
+            model: root.objectCount
+
+            Model {
+                required property int index
+
+                property real gridSize: Math.ceil(Math.cbrt(root.objectCount))
+                property real spacing: 30
+
+                source: root.meshTypes[index % 5]
+                position: Qt.vector3d(
+                    (index % gridSize - gridSize / 2) * spacing,
+                    Math.floor(index / gridSize) % gridSize * spacing + 10,
+                    (Math.floor(index / (gridSize * gridSize)) - gridSize / 2) * spacing
+                )
+                eulerRotation: Qt.vector3d(root.hash(index * 13) * 360, root.hash(index * 17) * 360, 0)
+                scale: Qt.vector3d(0.2, 0.2, 0.2)
+                materials: PrincipledMaterial {
+                    baseColor: Qt.hsla(root.hash(index * 7 + 13), 0.6, 0.5, 1.0)
+                }
+            }
+        }
+    }
+
+    GlobalGizmo {
+        id: gizmo
+        anchors.fill: parent
+        managedByParent: true
+        view3d: view3d
+        targetNode: benchmarkTarget
+        mode: root.gizmoMode
+        transformMode: root.transformMode
+    }
+}
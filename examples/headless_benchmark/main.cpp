@@ -0,0 +1,263 @@
+// Headless Gizmo3D benchmark
+//
+// Renders Scene.qml offscreen through QQuickRenderControl (no window, no vsync) and
+// times every frame stage separately with QElapsedTimer: gizmo geometry, hit testing,
+// polish, scene-graph sync and render (GPU work included via glFinish). The report is
+// written as JSON with min/avg/max and p50/p95/p99 per stage.
+//
+// Runs under the offscreen QPA unless QT_QPA_PLATFORM is set. --software-gl selects
+// the software OpenGL rasterizer (llvmpipe on Mesa) for machines without a GPU.
+//
+// --js-heap samples the JavaScript heap around the geometry stage and adds a "js_heap"
+// block: bytes allocated per frame and, separately, the frames in which the garbage
+// collector ran (see JsHeapMonitor).
+//
+// Usage: gizmo3d_headless_benchmark [--objects N] [--mode translate|rotate|scale|both|all]
+//                                   [--transform world|local] [--warmup N] [--frames N]
+//                                   [--size WxH] [--software-gl] [--js-heap]
+//                                   [--output report.json]
+
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QGuiApplication>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QQmlComponent>
+#include <QQmlEngine>
+#include <QQuickItem>
+#include <QQuickWindow>
+
+#include "benchargs.h"
+#include "benchstats.h"
+#include "jsheapmonitor.h"
+#include "offscreenrenderer.h"
+
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#ifndef GIZMO3D_QML_COMPILATION
+#define GIZMO3D_QML_COMPILATION "aot"
+#endif
+
+namespace {
+
+enum Stage { Geometry, HitTest, Polish, Sync, Render, Frame, StageCount };
+
+constexpr std::array<const char *, StageCount> kStageNames{
+    "geometry", "hit_test", "polish", "sync", "render", "frame"};
+
+// GizmoEnums.Mode and GizmoEnums.TransformMode values by command-line name
+constexpr std::array<std::pair<const char *, int>, 5> kModes{{
+    {"translate", 0}, {"rotate", 1}, {"scale", 2}, {"both", 3}, {"all", 4}}};
+constexpr std::array<std::pair<const char *, int>, 2> kTransformModes{{
+    {"world", 0}, {"local", 1}}};
+
+template <size_t N>
+int lookup(const std::array<std::pair<const char *, int>, N> &table, const QString &name)
+{
+    for (const auto &[key, value] : table) {
+        if (name == QLatin1StringView(key))
+            return value;
+    }
+    return -1;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const bool softwareGl = hasFlag(argc, argv, "--software-gl");
+    OffscreenRenderer::configureProcess(softwareGl);
+
+    QGuiApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Offscreen Gizmo3D frame-stage benchmark"));
+    parser.addHelpOption();
+    const QCommandLineOption objectsOption(QStringLiteral("objects"),
+                                           QStringLiteral("Scene object count."),
+                                           QStringLiteral("count"), QStringLiteral("10000"));
+    const QCommandLineOption modeOption(QStringLiteral("mode"),
+                                        QStringLiteral("Gizmo mode: translate, rotate, scale, both or all."),
+                                        QStringLiteral("mode"), QStringLiteral("all"));
+    const QCommandLineOption transformOption(QStringLiteral("transform"),
+                                             QStringLiteral("Transform mode: world or local."),
+                                             QStringLiteral("mode"), QStringLiteral("world"));
+    const QCommandLineOption warmupOption(QStringLiteral("warmup"),
+                                          QStringLiteral("Frames rendered before measuring."),
+                                          QStringLiteral("frames"), QStringLiteral("30"));
+    const QCommandLineOption framesOption(QStringLiteral("frames"),
+                                          QStringLiteral("Measured frames (one full camera orbit)."),
+                                          QStringLiteral("frames"), QStringLiteral("300"));
+    const QCommandLineOption sizeOption(QStringLiteral("size"),
+                                        QStringLiteral("Render target size."),
+                                        QStringLiteral("WxH"), QStringLiteral("1600x1000"));
+    const QCommandLineOption softwareOption(QStringLiteral("software-gl"),
+                                            QStringLiteral("Use software OpenGL (no GPU)."));
+    const QCommandLineOption jsHeapOption(QStringLiteral("js-heap"),
+                                          QStringLiteral("Report JS allocations and GC frames of the geometry stage."));
+    const QCommandLineOption outputOption(QStringLiteral("output"),
+                                          QStringLiteral("JSON report path (default: stdout)."),
+                                          QStringLiteral("file"));
+    parser.addOptions({objectsOption, modeOption, transformOption, warmupOption, framesOption,
+                       sizeOption, softwareOption, jsHeapOption, outputOption});
+    parser.process(app);
+
+    const int objectCount = qMax(0, parser.value(objectsOption).toInt());
+    const int warmupFrames = qMax(0, parser.value(warmupOption).toInt());
+    const int measureFrames = qMax(1, parser.value(framesOption).toInt());
+    const QString modeName = parser.value(modeOption);
+    const QString transformName = parser.value(transformOption);
+    const int mode = lookup(kModes, modeName);
+    const int transformMode = lookup(kTransformModes, transformName);
+    const QStringList sizeParts = parser.value(sizeOption).split(QLatin1Char('x'));
+    const QSize size(sizeParts.value(0).toInt(), sizeParts.value(1).toInt());
+    const bool sampleJsHeap = parser.isSet(jsHeapOption);
+
+    if (mode < 0 || transformMode < 0 || size.isEmpty()) {
+        std::fprintf(stderr, "Invalid --mode, --transform or --size\n");
+        return 2;
+    }
+
+    OffscreenRenderer renderer;
+    QString error;
+    if (!renderer.initialize(size, &error)) {
+        std::fprintf(stderr, "%s\n", qPrintable(error));
+        return 1;
+    }
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, QUrl(QStringLiteral("qrc:/qt/qml/HeadlessBenchmark/Scene.qml")));
+    QElapsedTimer startupTimer;
+    startupTimer.start();
+    std::unique_ptr<QQuickItem> scene(qobject_cast<QQuickItem *>(component.createWithInitialProperties({
+        {QStringLiteral("objectCount"), objectCount},
+        {QStringLiteral("gizmoMode"), mode},
+        {QStringLiteral("transformMode"), transformMode},
+    })));
+    const double startupMs = startupTimer.nsecsElapsed() / 1.0e6;
+    if (!scene) {
+        std::fprintf(stderr, "%s\n", qPrintable(component.errorString()));
+        return 1;
+    }
+    scene->setParentItem(renderer.window()->contentItem());
+    scene->setSize(size);
+
+    std::fprintf(stderr, "[BENCHMARK] Gizmo3D headless benchmark\n");
+    std::fprintf(stderr, "[BENCHMARK] Scene: %d objects, Mode: %s, Transform: %s\n", objectCount,
+                 qPrintable(modeName), qPrintable(transformName));
+    std::fprintf(stderr, "[BENCHMARK] Target: %dx%d, Warmup: %d, Measured: %d frames\n",
+                 size.width(), size.height(), warmupFrames, measureFrames);
+
+    std::array<std::vector<qint64>, StageCount> samples;
+    for (std::vector<qint64> &stage : samples)
+        stage.reserve(size_t(measureFrames));
+
+    JsHeapMonitor jsHeap(&engine);
+
+    QElapsedTimer frameTimer;
+    QElapsedTimer stageTimer;
+    std::array<qint64, StageCount> frame{};
+    int hits = 0;
+
+    for (int i = 0; i < warmupFrames + measureFrames; ++i) {
+        QMetaObject::invokeMethod(scene.get(), "advance", Q_ARG(int, i), Q_ARG(int, measureFrames));
+
+        const bool sampleHeap = sampleJsHeap && i >= warmupFrames;
+        if (sampleHeap)
+            jsHeap.begin();
+
+        frameTimer.start();
+
+        stageTimer.start();
+        QMetaObject::invokeMethod(scene.get(), "updateGeometry");
+        frame[Geometry] = stageTimer.nsecsElapsed();
+
+        // Sampling walks the heap, so its time is taken out of the frame
+        qint64 samplingNs = 0;
+        if (sampleHeap) {
+            stageTimer.start();
+            jsHeap.end(frame[Geometry]);
+            samplingNs = stageTimer.nsecsElapsed();
+        }
+
+        stageTimer.start();
+        QMetaObject::invokeMethod(scene.get(), "hitTest", Q_RETURN_ARG(int, hits));
+        frame[HitTest] = stageTimer.nsecsElapsed();
+
+        stageTimer.start();
+        renderer.polish();
+        frame[Polish] = stageTimer.nsecsElapsed();
+
+        stageTimer.start();
+        renderer.sync();
+        frame[Sync] = stageTimer.nsecsElapsed();
+
+        stageTimer.start();
+        renderer.render();
+        frame[Render] = stageTimer.nsecsElapsed();
+
+        frame[Frame] = frameTimer.nsecsElapsed() - samplingNs;
+
+        if (i >= warmupFrames) {
+            for (int stage = 0; stage < StageCount; ++stage)
+                samples[size_t(stage)].push_back(frame[size_t(stage)]);
+        }
+
+        // Deferred deletes and queued connections, outside the measured frame
+        QCoreApplication::processEvents();
+    }
+
+    QJsonObject stages;
+    for (int stage = 0; stage < StageCount; ++stage)
+        stages.insert(QLatin1StringView(kStageNames[size_t(stage)]), stageStats(samples[size_t(stage)]));
+
+    QJsonObject report{
+        {QStringLiteral("benchmark"), QStringLiteral("gizmo3d_headless")},
+        {QStringLiteral("config"), QJsonObject{
+            {QStringLiteral("objects"), objectCount},
+            {QStringLiteral("mode"), modeName},
+            {QStringLiteral("transform"), transformName},
+            {QStringLiteral("warmup_frames"), warmupFrames},
+            {QStringLiteral("measured_frames"), measureFrames},
+            {QStringLiteral("width"), size.width()},
+            {QStringLiteral("height"), size.height()},
+        }},
+        {QStringLiteral("environment"), QJsonObject{
+            {QStringLiteral("qt_version"), QLatin1StringView(qVersion())},
+            {QStringLiteral("qpa_platform"), QGuiApplication::platformName()},
+            {QStringLiteral("software_gl"), softwareGl},
+            {QStringLiteral("gl_renderer"), renderer.glRenderer()},
+            {QStringLiteral("gl_version"), renderer.glVersion()},
+            {QStringLiteral("qml_compilation"), QStringLiteral(GIZMO3D_QML_COMPILATION)},
+        }},
+        {QStringLiteral("startup_ms"), startupMs},
+        {QStringLiteral("hit_test_hits"), hits},
+        {QStringLiteral("stages"), stages},
+    };
+    if (sampleJsHeap)
+        report.insert(QStringLiteral("js_heap"), jsHeap.report());
+
+    // Release the scene while its window and GL context still exist
+    scene.reset();
+
+    const QByteArray json = QJsonDocument(report).toJson(QJsonDocument::Indented);
+    const QString outputPath = parser.value(outputOption);
+    if (outputPath.isEmpty()) {
+        std::fwrite(json.constData(), 1, size_t(json.size()), stdout);
+        return 0;
+    }
+
+    QFile output(outputPath);
+    if (!output.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        std::fprintf(stderr, "Cannot write %s\n", qPrintable(outputPath));
+        return 1;
+    }
+    output.write(json);
+    std::fprintf(stderr, "[BENCHMARK] Report written to %s\n", qPrintable(outputPath));
+    return 0;
+}
@@ -0,0 +1,82 @@
+import QtQuick
+import QtQuick3D
+import Gizmo3D
+
+// Scene for the idle benchmark (main.cpp): a still camera and target with a standalone
+// GlobalGizmo in gizmoMode, left to its own FrameAnimation. Nothing moves, so every
+// frame and geometry update it causes is idle cost. With showGizmo false the scene is
+// the baseline without a gizmo.
+Item {
+    id: root
+
+    // Set by main.cpp
+    property int gizmoMode: GizmoEnums.Mode.Translate
+    property bool showGizmo: true
+
+    readonly property GlobalGizmo gizmo: gizmoLoader.item as GlobalGizmo
+
+    // Child gizmo geometry assignments since the last resetCounters()
+    property int geometryUpdates: 0
+
+    function resetCounters(): void {
+        geometryUpdates = 0
+    }
+
+    View3D {
+        id: view3d
+        anchors.fill: parent
+
+        environment: SceneEnvironment {
+            clearColor: "#1a1a2e"
+            backgroundMode: SceneEnvironment.Color
+        }
+
+        PerspectiveCamera {
+            position: Qt.vector3d(0, 200, 400)
+            eulerRotation.x: -25
+            clipNear: 1
+            clipFar: 10000
+        }
+
+        DirectionalLight {
+            eulerRotation.x: -30
+            eulerRotation.y: -70
+        }
+
+        Model {
+            id: targetModel
+            source: "#Cube"
+            eulerRotation: Qt.vector3d(20, 35, 10)
+            materials: PrincipledMaterial {
+                baseColor: "#ffffff"
+            }
+        }
+    }
+
+    Loader {
+        id: gizmoLoader
+        anchors.fill: parent
+        active: root.showGizmo
+
+        sourceComponent: GlobalGizmo {
+            view3d: view3d
+            targetNode: targetModel
+            mode: root.gizmoMode
+        }
+    }
+
+    Connections {
+        target: root.gizmo ? root.gizmo.translationGizmo : null
+        function onGeometryChanged() { root.geometryUpdates++ }
+    }
+
+    Connections {
+        target: root.gizmo ? root.gizmo.rotationGizmo : null
+        function onGeometryChanged() { root.geometryUpdates++ }
+    }
+
+    Connections {
+        target: root.gizmo ? root.gizmo.scaleGizmo : null
+        function onGeometryChanged() { root.geometryUpdates++ }
+    }
+}
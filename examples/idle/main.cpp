@@ -0,0 +1,314 @@
+// Idle benchmark
+//
+// Leaves a still scene with a standalone GlobalGizmo alone for N seconds in each mode
+// and reports what it costs while nothing moves: process CPU time, frames rendered,
+// animation ticks, running FrameAnimations and child geometry updates. A run without
+// a gizmo ("none") is the baseline. Idle should cost what the baseline costs.
+//
+// Frames are paced the way Qt's threaded render loop paces them: while any animation
+// runs, animations are advanced and a frame is rendered every vsync interval; otherwise
+// a frame is rendered only when the render control asks for one. The offscreen target
+// has no real vsync, so a timer at --interval ms stands in for it.
+//
+// --max-cpu-percent and --max-fps turn the report into a check: the exit code is 3 if
+// any gizmo mode exceeds them, so zero-cost idle can be enforced in CI.
+//
+// Usage: gizmo3d_idle_benchmark [--seconds N] [--settle MS] [--interval MS] [--size WxH]
+//                               [--max-cpu-percent P] [--max-fps F] [--software-gl]
+//                               [--output report.json]
+
+#include <QAnimationDriver>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QFile>
+#include <QGuiApplication>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QQmlComponent>
+#include <QQmlEngine>
+#include <QQuickItem>
+#include <QQuickRenderControl>
+#include <QQuickWindow>
+#include <QTimer>
+
+#include "benchargs.h"
+#include "benchstats.h"
+#include "offscreenrenderer.h"
+
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <utility>
+
+namespace {
+
+// GizmoEnums.Mode values by report name; "none" has no gizmo
+constexpr std::array<std::pair<const char *, int>, 5> kModes{{
+    {"none", -1}, {"translate", 0}, {"rotate", 1}, {"scale", 2}, {"all", 4}}};
+
+// Animation driver advanced by VsyncLoop instead of the default 16 ms timer
+class SteppedAnimationDriver : public QAnimationDriver
+{
+public:
+    using QAnimationDriver::QAnimationDriver;
+    void step() { advance(); }
+};
+
+/**
+ * Event-driven render loop over an OffscreenRenderer: renders on request and keeps
+ * ticking while animations run, at most once per interval
+ */
+class VsyncLoop : public QObject
+{
+public:
+    VsyncLoop(OffscreenRenderer *renderer, SteppedAnimationDriver *driver, int intervalMs)
+        : m_renderer(renderer)
+        , m_driver(driver)
+        , m_intervalMs(intervalMs)
+    {
+        m_timer.setSingleShot(true);
+        m_timer.setTimerType(Qt::PreciseTimer);
+        connect(&m_timer, &QTimer::timeout, this, &VsyncLoop::tick);
+        connect(renderer->renderControl(), &QQuickRenderControl::renderRequested, this,
+                &VsyncLoop::request);
+        connect(renderer->renderControl(), &QQuickRenderControl::sceneChanged, this,
+                &VsyncLoop::request);
+        connect(driver, &QAnimationDriver::started, this, &VsyncLoop::schedule);
+        m_sinceFrame.start();
+    }
+
+    void resetCounters()
+    {
+        frames = 0;
+        requests = 0;
+        animationTicks = 0;
+    }
+
+    int frames = 0;
+    int requests = 0;
+    int animationTicks = 0;
+
+private:
+    void request()
+    {
+        // Changes made while polishing belong to the frame being rendered
+        if (m_rendering)
+            return;
+        ++requests;
+        m_frameRequested = true;
+        schedule();
+    }
+
+    void schedule()
+    {
+        if (m_timer.isActive())
+            return;
+        m_timer.start(int(qMax<qint64>(0, m_intervalMs - m_sinceFrame.elapsed())));
+    }
+
+    void tick()
+    {
+        const bool animating = m_driver->isRunning();
+        if (animating) {
+            m_driver->step();
+            ++animationTicks;
+        }
+        if (animating || m_frameRequested) {
+            m_frameRequested = false;
+            m_rendering = true;
+            m_renderer->renderFrame();
+            m_rendering = false;
+            ++frames;
+            m_sinceFrame.restart();
+        }
+        if (m_driver->isRunning() || m_frameRequested)
+            schedule();
+    }
+
+    OffscreenRenderer *m_renderer;
+    SteppedAnimationDriver *m_driver;
+    int m_intervalMs;
+    QTimer m_timer;
+    QElapsedTimer m_sinceFrame;
+    bool m_frameRequested = true;
+    bool m_rendering = false;
+};
+
+void runEventLoop(int ms)
+{
+    QEventLoop loop;
+    QTimer::singleShot(ms, &loop, &QEventLoop::quit);
+    loop.exec();
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const bool softwareGl = hasFlag(argc, argv, "--software-gl");
+    OffscreenRenderer::configureProcess(softwareGl);
+
+    QGuiApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Offscreen Gizmo3D idle cost benchmark"));
+    parser.addHelpOption();
+    const QCommandLineOption secondsOption(QStringLiteral("seconds"),
+                                           QStringLiteral("Idle time measured per mode."),
+                                           QStringLiteral("seconds"), QStringLiteral("5"));
+    const QCommandLineOption settleOption(QStringLiteral("settle"),
+                                          QStringLiteral("Time before measuring, for lazy creation and first frames."),
+                                          QStringLiteral("ms"), QStringLiteral("1000"));
+    const QCommandLineOption intervalOption(QStringLiteral("interval"),
+                                            QStringLiteral("Simulated vsync interval."),
+                                            QStringLiteral("ms"), QStringLiteral("16"));
+    const QCommandLineOption sizeOption(QStringLiteral("size"),
+                                        QStringLiteral("Render target size."),
+                                        QStringLiteral("WxH"), QStringLiteral("1600x1000"));
+    const QCommandLineOption maxCpuOption(QStringLiteral("max-cpu-percent"),
+                                          QStringLiteral("Fail if a gizmo mode uses more CPU while idle."),
+                                          QStringLiteral("percent"));
+    const QCommandLineOption maxFpsOption(QStringLiteral("max-fps"),
+                                          QStringLiteral("Fail if a gizmo mode renders more frames per second while idle."),
+                                          QStringLiteral("fps"));
+    const QCommandLineOption softwareOption(QStringLiteral("software-gl"),
+                                            QStringLiteral("Use software OpenGL (no GPU)."));
+    const QCommandLineOption outputOption(QStringLiteral("output"),
+                                          QStringLiteral("JSON report path (default: stdout)."),
+                                          QStringLiteral("file"));
+    parser.addOptions({secondsOption, settleOption, intervalOption, sizeOption, maxCpuOption,
+                       maxFpsOption, softwareOption, outputOption});
+    parser.process(app);
+
+    const double seconds = qMax(0.1, parser.value(secondsOption).toDouble());
+    const int settleMs = qMax(0, parser.value(settleOption).toInt());
+    const int intervalMs = qMax(1, parser.value(intervalOption).toInt());
+    const QStringList sizeParts = parser.value(sizeOption).split(QLatin1Char('x'));
+    const QSize size(sizeParts.value(0).toInt(), sizeParts.value(1).toInt());
+    if (size.isEmpty()) {
+        std::fprintf(stderr, "Invalid --size\n");
+        return 2;
+    }
+
+    OffscreenRenderer renderer;
+    QString error;
+    if (!renderer.initialize(size, &error)) {
+        std::fprintf(stderr, "%s\n", qPrintable(error));
+        return 1;
+    }
+
+    SteppedAnimationDriver driver;
+    driver.install();
+    VsyncLoop loop(&renderer, &driver, intervalMs);
+
+    std::fprintf(stderr, "[BENCHMARK] Gizmo3D idle benchmark\n");
+    std::fprintf(stderr, "[BENCHMARK] Idle: %.1f s per mode, Settle: %d ms, Vsync: %d ms\n",
+                 seconds, settleMs, intervalMs);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, QUrl(QStringLiteral("qrc:/qt/qml/IdleBenchmark/Scene.qml")));
+
+    QJsonObject modes;
+    QStringList violations;
+    for (const auto &[name, mode] : kModes) {
+        std::unique_ptr<QQuickItem> scene(qobject_cast<QQuickItem *>(component.createWithInitialProperties({
+            {QStringLiteral("gizmoMode"), qMax(0, mode)},
+            {QStringLiteral("showGizmo"), mode >= 0},
+        })));
+        if (!scene) {
+            std::fprintf(stderr, "%s\n", qPrintable(component.errorString()));
+            return 1;
+        }
+        scene->setParentItem(renderer.window()->contentItem());
+        scene->setSize(size);
+
+        runEventLoop(settleMs);
+
+        // FrameAnimations that wake up every tick, including lazily created children
+        int runningFrameAnimations = 0;
+        for (QObject *object : scene->findChildren<QObject *>()) {
+            if (qstrcmp(object->metaObject()->className(), "QQuickFrameAnimation") == 0
+                && object->property("running").toBool()) {
+                ++runningFrameAnimations;
+            }
+        }
+
+        loop.resetCounters();
+        QMetaObject::invokeMethod(scene.get(), "resetCounters");
+        const qint64 cpuBefore = processCpuNs();
+        QElapsedTimer wall;
+        wall.start();
+
+        runEventLoop(int(seconds * 1000));
+
+        const double wallS = wall.nsecsElapsed() / 1.0e9;
+        const qint64 cpuNs = processCpuNs() - cpuBefore;
+        const int geometryUpdates = scene->property("geometryUpdates").toInt();
+
+        const double cpuPercent = cpuNs * 100.0 / (wallS * 1.0e9);
+        const double fps = loop.frames / wallS;
+        const QJsonObject result{
+            {QStringLiteral("wall_s"), wallS},
+            {QStringLiteral("cpu_ms"), cpuNs / 1.0e6},
+            {QStringLiteral("cpu_percent"), cpuPercent},
+            {QStringLiteral("frames_rendered"), loop.frames},
+            {QStringLiteral("frames_per_second"), fps},
+            {QStringLiteral("render_requests"), loop.requests},
+            {QStringLiteral("animation_ticks"), loop.animationTicks},
+            {QStringLiteral("running_frame_animations"), runningFrameAnimations},
+            {QStringLiteral("geometry_updates"), geometryUpdates},
+            {QStringLiteral("geometry_updates_per_second"), geometryUpdates / wallS},
+        };
+        modes.insert(QLatin1StringView(name), result);
+
+        std::fprintf(stderr, "[BENCHMARK] %-9s cpu %5.1f%%  %5.1f fps  %d geometry updates\n",
+                     name, cpuPercent, fps, geometryUpdates);
+
+        if (mode >= 0 && parser.isSet(maxCpuOption) && cpuPercent > parser.value(maxCpuOption).toDouble())
+            violations << QStringLiteral("%1: cpu %2%").arg(QLatin1StringView(name)).arg(cpuPercent, 0, 'f', 1);
+        if (mode >= 0 && parser.isSet(maxFpsOption) && fps > parser.value(maxFpsOption).toDouble())
+            violations << QStringLiteral("%1: %2 fps").arg(QLatin1StringView(name)).arg(fps, 0, 'f', 1);
+
+        // Release the scene while its window and GL context still exist
+        scene.reset();
+        runEventLoop(intervalMs * 2);
+    }
+
+    const QJsonObject report{
+        {QStringLiteral("benchmark"), QStringLiteral("gizmo3d_idle")},
+        {QStringLiteral("config"), QJsonObject{
+            {QStringLiteral("seconds"), seconds},
+            {QStringLiteral("settle_ms"), settleMs},
+            {QStringLiteral("vsync_interval_ms"), intervalMs},
+            {QStringLiteral("width"), size.width()},
+            {QStringLiteral("height"), size.height()},
+        }},
+        {QStringLiteral("environment"), QJsonObject{
+            {QStringLiteral("qt_version"), QLatin1StringView(qVersion())},
+            {QStringLiteral("qpa_platform"), QGuiApplication::platformName()},
+            {QStringLiteral("software_gl"), softwareGl},
+            {QStringLiteral("gl_renderer"), renderer.glRenderer()},
+            {QStringLiteral("gl_version"), renderer.glVersion()},
+        }},
+        {QStringLiteral("modes"), modes},
+    };
+
+    const QByteArray json = QJsonDocument(report).toJson(QJsonDocument::Indented);
+    const QString outputPath = parser.value(outputOption);
+    if (outputPath.isEmpty()) {
+        std::fwrite(json.constData(), 1, size_t(json.size()), stdout);
+    } else {
+        QFile output(outputPath);
+        if (!output.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            std::fprintf(stderr, "Cannot write %s\n", qPrintable(outputPath));
+            return 1;
+        }
+        output.write(json);
+        std::fprintf(stderr, "[BENCHMARK] Report written to %s\n", qPrintable(outputPath));
+    }
+
+    for (const QString &violation : violations)
+        std::fprintf(stderr, "[BENCHMARK] Idle budget exceeded: %s\n", qPrintable(violation));
+    return violations.isEmpty() ? 0 : 3;
+}
@@ -0,0 +1,122 @@
+// GlobalGizmo instantiation benchmark
+//
+// Creates N GlobalGizmos (no View3D, so no per-frame work) for each mode and reports
+// creation time, destruction time and resident memory growth. Child gizmos are created
+// on first use, so single-mode gizmos should cost roughly a third of "preloaded", which
+// creates all three children up front like GlobalGizmo did before lazy instantiation.
+//
+// Usage: gizmo3d_instantiation [gizmoCount]
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QGuiApplication>
+#include <QQmlComponent>
+#include <QQmlEngine>
+#include <QQuickItem>
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#ifdef Q_OS_UNIX
+#include <unistd.h>
+#endif
+
+namespace {
+
+struct Variant
+{
+    const char *name;
+    const char *mode;
+    bool preload;
+};
+
+constexpr Variant kVariants[] = {
+    {"translate", "Translate", false},
+    {"rotate", "Rotate", false},
+    {"scale", "Scale", false},
+    {"all", "All", false},
+    {"preloaded", "Translate", true},
+};
+
+// Resident set size in KiB, or -1 where /proc is unavailable
+long residentKiB()
+{
+#ifdef Q_OS_UNIX
+    QFile statm(QStringLiteral("/proc/self/statm"));
+    if (!statm.open(QIODevice::ReadOnly))
+        return -1;
+    const QList<QByteArray> fields = statm.readAll().split(' ');
+    if (fields.size() < 2)
+        return -1;
+    return fields.at(1).toLong() * (sysconf(_SC_PAGESIZE) / 1024);
+#else
+    return -1;
+#endif
+}
+
+QByteArray gizmoSource(const Variant &variant)
+{
+    return QByteArrayLiteral("import Gizmo3D\nGlobalGizmo { mode: GizmoEnums.Mode.")
+        + variant.mode + QByteArrayLiteral("; preloadSubGizmos: ")
+        + (variant.preload ? "true" : "false") + QByteArrayLiteral(" }\n");
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QGuiApplication app(argc, argv);
+    const QStringList args = app.arguments();
+    const int gizmoCount = args.size() > 1 ? qMax(1, args.at(1).toInt()) : 1000;
+
+    QQmlEngine engine;
+    QQuickItem container;
+
+    std::printf("[BENCHMARK] Gizmo3D GlobalGizmo instantiation\n");
+    std::printf("[BENCHMARK] Gizmos: %d per variant\n", gizmoCount);
+    std::printf("BENCHMARK_RESULTS_START\n");
+
+    for (const Variant &variant : kVariants) {
+        QQmlComponent component(&engine);
+        component.setData(gizmoSource(variant), QUrl(QStringLiteral("qrc:/instantiation.qml")));
+        if (component.isError()) {
+            std::fprintf(stderr, "%s\n", qPrintable(component.errorString()));
+            return 1;
+        }
+
+        // Warm up: type loading and compilation are not part of the per-gizmo cost
+        delete component.create();
+
+        std::vector<std::unique_ptr<QObject>> gizmos;
+        gizmos.reserve(size_t(gizmoCount));
+        const long rssBefore = residentKiB();
+
+        QElapsedTimer timer;
+        timer.start();
+        for (int i = 0; i < gizmoCount; ++i) {
+            QObject *gizmo = component.create();
+            if (auto *item = qobject_cast<QQuickItem *>(gizmo))
+                item->setParentItem(&container);
+            gizmos.emplace_back(gizmo);
+        }
+        const double createMs = timer.nsecsElapsed() / 1.0e6;
+        const long rssAfter = residentKiB();
+
+        timer.restart();
+        gizmos.clear();
+        const double destroyMs = timer.nsecsElapsed() / 1.0e6;
+
+        std::printf("%s.create_ms=%.2f\n", variant.name, createMs);
+        std::printf("%s.create_per_gizmo_us=%.2f\n", variant.name, createMs * 1000.0 / gizmoCount);
+        std::printf("%s.destroy_ms=%.2f\n", variant.name, destroyMs);
+        if (rssBefore >= 0 && rssAfter >= 0) {
+            std::printf("%s.rss_delta_kib=%ld\n", variant.name, rssAfter - rssBefore);
+            std::printf("%s.rss_per_gizmo_kib=%.2f\n", variant.name,
+                        double(rssAfter - rssBefore) / gizmoCount);
+        }
+    }
+
+    std::printf("BENCHMARK_RESULTS_END\n");
+    return 0;
+}
@@ -757,6 +757,40 @@ Window {
                 }
             }
 
+            Row {
+                spacing: 10
+
+                CheckBox {
+                    id: latencyCheckbox
+                    text: "Measure Input Latency"
+                    checked: GizmoLatency.enabled
+                    onToggled: {
+                        GizmoLatency.enabled = checked
+                        GizmoLatency.reset()
+                    }
+
+                    contentItem: Text {
+                        text: latencyCheckbox.text
+                        color: "white"
+                        leftPadding: latencyCheckbox.indicator.width + latencyCheckbox.spacing
+                        verticalAlignment: Text.AlignVCenter
+                    }
+                }
+            }
+
+            // Live input-to-frame latency while dragging any gizmo
+            Text {
+                visible: GizmoLatency.enabled
+                color: "white"
+                font.pixelSize: 12
+                text: GizmoLatency.sampleCount > 0
+                      ? "Input to frame (" + GizmoLatency.stats.count + " moves):\n" +
+                        "  p50 " + GizmoLatency.stats.p50_ms.toFixed(1) + " ms, p95 " +
+                        GizmoLatency.stats.p95_ms.toFixed(1) + " ms, p99 " +
+                        GizmoLatency.stats.p99_ms.toFixed(1) + " ms"
+                      : "Drag a handle to measure"
+            }
+
             Text {
                 text: "Quick Mode Switch:"
                 color: "white"
@@ -0,0 +1,106 @@
+import QtQuick
+import QtQuick3D
+import Gizmo3D
+
+// Scene for the many-gizmo scaling benchmark (main.cpp): targetCount targets on a grid,
+// each with its own GlobalGizmo in gizmoMode, and an orbiting camera. With showGizmos
+// false only the targets are rendered, which is the baseline the gizmo cost is measured
+// against. The runner calls advance() and updateGeometry(); nothing animates on its own.
+Item {
+    id: root
+
+    // Set by main.cpp from the command line
+    property int targetCount: 1
+    property int gizmoMode: GizmoEnums.Mode.Translate
+    property bool showGizmos: true
+
+    // Camera orbit angle in degrees, set by advance()
+    property real orbitAngle: 0
+
+    /**
+     * Moves the camera to the given frame of a full orbit
+     * @param frame - Frame index
+     * @param frameCount - Frames per full 360° orbit
+     */
+    function advance(frame: int, frameCount: int): void {
+        orbitAngle = (frame / Math.max(1, frameCount)) * 360
+    }
+
+    /**
+     * Geometry stage: what each gizmo's FrameAnimation does every frame
+     * @returns Number of gizmos updated
+     */
+    function updateGeometry(): int {
+        for (var i = 0; i < gizmos.count; i++)
+            gizmos.itemAt(i).frameUpdate()
+        return gizmos.count
+    }
+
+    View3D {
+        id: view3d
+        anchors.fill: parent
+        camera: camera
+
+        environment: SceneEnvironment {
+            clearColor: "#1a1a2e"
+            backgroundMode: SceneEnvironment.Color
+        }
+
+        Node {
+            eulerRotation.y: root.orbitAngle
+
+            PerspectiveCamera {
+                id: camera
+                position: Qt.vector3d(0, 900, 1600)
+                eulerRotation.x: -30
+                clipFar: 50000
+                clipNear: 1
+            }
+        }
+
+        DirectionalLight {
+            eulerRotation.x: -30
+            eulerRotation.y: -70
+            ambientColor: Qt.rgba(0.3, 0.3, 0.3, 1.0)
+        }
+
+        // Square grid in the XZ plane, so every target is distinct and on screen
+        Repeater3D {
+            id: targets
+            model: root.targetCount
+
+            Model {
+                required property int index
+
+                property int columns: Math.ceil(Math.sqrt(root.targetCount))
+                property real spacing: 1200 / Math.max(1, columns)
+
+                source: "#Cube"
+                position: Qt.vector3d((index % columns - (columns - 1) / 2) * spacing, 0,
+                                      (Math.floor(index / columns) - (columns - 1) / 2) * spacing)
+                eulerRotation: Qt.vector3d(0, index * 7 % 90, 0)
+                scale: Qt.vector3d(0.2, 0.2, 0.2)
+                materials: PrincipledMaterial {
+                    baseColor: "#ffffff"
+                }
+            }
+        }
+    }
+
+    // Instantiated once the targets exist, so objectAt() resolves
+    Repeater {
+        id: gizmos
+        model: root.showGizmos ? targets.count : 0
+
+        GlobalGizmo {
+            required property int index
+
+            anchors.fill: parent
+            managedByParent: true
+            view3d: view3d
+            targetNode: targets.objectAt(index) as Node
+            mode: root.gizmoMode
+            gizmoSize: 40
+        }
+    }
+}
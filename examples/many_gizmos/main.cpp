@@ -0,0 +1,375 @@
+// Many-gizmo scaling benchmark
+//
+// Renders Scene.qml offscreen with 1, 10, 100 and 1000 targets, each carrying its own
+// GlobalGizmo of one type (translate, rotate, scale), while the camera orbits. Every
+// count is also run with the targets alone, and the difference divided by the count
+// gives the per-gizmo geometry, render and resident memory cost. The report is JSON
+// with one curve per gizmo type, so scheduling, batching and culling changes show up
+// as a change of slope rather than of a single number.
+//
+// Each (type, count) configuration runs in a child process (--run), so the memory
+// of one configuration is not reused by the next and the RSS deltas stay honest.
+//
+// Usage: gizmo3d_many_gizmos [--types translate,rotate,scale] [--counts 1,10,100,1000]
+//                            [--warmup N] [--frames N] [--size WxH] [--software-gl]
+//                            [--output report.json]
+
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QGuiApplication>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QProcess>
+#include <QQmlComponent>
+#include <QQmlEngine>
+#include <QQuickItem>
+#include <QQuickWindow>
+
+#include "benchargs.h"
+#include "benchstats.h"
+#include "offscreenrenderer.h"
+
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace {
+
+enum Stage { Geometry, Render, Frame, StageCount };
+
+constexpr std::array<const char *, StageCount> kStageNames{"geometry", "render", "frame"};
+
+// GizmoEnums.Mode values by command-line name; "none" renders the targets only
+constexpr std::array<std::pair<const char *, int>, 4> kTypes{{
+    {"none", -1}, {"translate", 0}, {"rotate", 1}, {"scale", 2}}};
+
+bool lookupType(const QString &name, int *mode)
+{
+    for (const auto &[key, value] : kTypes) {
+        if (name == QLatin1StringView(key)) {
+            *mode = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+struct RunConfig
+{
+    QString type;
+    int count = 0;
+    int warmupFrames = 0;
+    int measureFrames = 0;
+    QSize size;
+};
+
+/**
+ * Runs one configuration in this process
+ * @returns {gizmos, startup_ms, rss_delta_kib, stages: {geometry, render, frame}, gl_*},
+ *          or an empty object on failure
+ */
+QJsonObject runConfiguration(const RunConfig &config)
+{
+    int mode = 0;
+    if (!lookupType(config.type, &mode)) {
+        std::fprintf(stderr, "Unknown gizmo type %s\n", qPrintable(config.type));
+        return {};
+    }
+
+    OffscreenRenderer renderer;
+    QString error;
+    if (!renderer.initialize(config.size, &error)) {
+        std::fprintf(stderr, "%s\n", qPrintable(error));
+        return {};
+    }
+    // The first frame allocates the scene graph and GL state every configuration shares
+    renderer.renderFrame();
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, QUrl(QStringLiteral("qrc:/qt/qml/ManyGizmos/Scene.qml")));
+    const long rssBefore = residentKiB();
+    QElapsedTimer startupTimer;
+    startupTimer.start();
+    std::unique_ptr<QQuickItem> scene(qobject_cast<QQuickItem *>(component.createWithInitialProperties({
+        {QStringLiteral("targetCount"), config.count},
+        {QStringLiteral("gizmoMode"), qMax(0, mode)},
+        {QStringLiteral("showGizmos"), mode >= 0},
+    })));
+    const double startupMs = startupTimer.nsecsElapsed() / 1.0e6;
+    if (!scene) {
+        std::fprintf(stderr, "%s\n", qPrintable(component.errorString()));
+        return {};
+    }
+    scene->setParentItem(renderer.window()->contentItem());
+    scene->setSize(config.size);
+
+    std::array<std::vector<qint64>, StageCount> samples;
+    for (std::vector<qint64> &stage : samples)
+        stage.reserve(size_t(config.measureFrames));
+
+    QElapsedTimer frameTimer;
+    QElapsedTimer stageTimer;
+    std::array<qint64, StageCount> frame{};
+    int gizmos = 0;
+    long rssAfter = -1;
+
+    for (int i = 0; i < config.warmupFrames + config.measureFrames; ++i) {
+        // Memory once everything, scene-graph nodes included, has been created
+        if (i == config.warmupFrames)
+            rssAfter = residentKiB();
+
+        QMetaObject::invokeMethod(scene.get(), "advance", Q_ARG(int, i),
+                                  Q_ARG(int, config.measureFrames));
+
+        frameTimer.start();
+
+        stageTimer.start();
+        QMetaObject::invokeMethod(scene.get(), "updateGeometry", Q_RETURN_ARG(int, gizmos));
+        frame[Geometry] = stageTimer.nsecsElapsed();
+
+        stageTimer.start();
+        renderer.renderFrame();
+        frame[Render] = stageTimer.nsecsElapsed();
+
+        frame[Frame] = frameTimer.nsecsElapsed();
+
+        if (i >= config.warmupFrames) {
+            for (int stage = 0; stage < StageCount; ++stage)
+                samples[size_t(stage)].push_back(frame[size_t(stage)]);
+        }
+
+        // Deferred deletes and queued connections, outside the measured frame
+        QCoreApplication::processEvents();
+    }
+
+    QJsonObject stages;
+    for (int stage = 0; stage < StageCount; ++stage)
+        stages.insert(QLatin1StringView(kStageNames[size_t(stage)]), stageStats(samples[size_t(stage)]));
+
+    QJsonObject result{
+        {QStringLiteral("gizmos"), gizmos},
+        {QStringLiteral("startup_ms"), startupMs},
+        {QStringLiteral("stages"), stages},
+        {QStringLiteral("gl_renderer"), renderer.glRenderer()},
+        {QStringLiteral("gl_version"), renderer.glVersion()},
+    };
+    if (rssBefore >= 0 && rssAfter >= 0)
+        result.insert(QStringLiteral("rss_delta_kib"), qint64(rssAfter - rssBefore));
+
+    // Release the scene while its window and GL context still exist
+    scene.reset();
+    return result;
+}
+
+/**
+ * Runs one configuration in a child process of this executable
+ * @returns The child's result, or an empty object if it failed
+ */
+QJsonObject runChild(const RunConfig &config, bool softwareGl)
+{
+    QStringList arguments{
+        QStringLiteral("--run"), config.type + QLatin1Char(':') + QString::number(config.count),
+        QStringLiteral("--warmup"), QString::number(config.warmupFrames),
+        QStringLiteral("--frames"), QString::number(config.measureFrames),
+        QStringLiteral("--size"),
+        QString::number(config.size.width()) + QLatin1Char('x') + QString::number(config.size.height()),
+    };
+    if (softwareGl)
+        arguments << QStringLiteral("--software-gl");
+
+    QProcess child;
+    child.setProcessChannelMode(QProcess::ForwardedErrorChannel);
+    child.start(QCoreApplication::applicationFilePath(), arguments);
+    if (!child.waitForFinished(-1) || child.exitStatus() != QProcess::NormalExit
+        || child.exitCode() != 0) {
+        std::fprintf(stderr, "[BENCHMARK] %s x%d failed\n", qPrintable(config.type), config.count);
+        return {};
+    }
+    return QJsonDocument::fromJson(child.readAllStandardOutput()).object();
+}
+
+double stageAvgMs(const QJsonObject &result, const char *stage)
+{
+    return result.value(QStringLiteral("stages")).toObject()
+        .value(QLatin1StringView(stage)).toObject()
+        .value(QStringLiteral("avg_ms")).toDouble();
+}
+
+// Cost of the gizmos alone: the difference to the targets-only baseline, per gizmo
+QJsonObject perGizmo(const QJsonObject &result, const QJsonObject &baseline, int count)
+{
+    QJsonObject costs;
+    for (const char *stage : kStageNames) {
+        const double us = (stageAvgMs(result, stage) - stageAvgMs(baseline, stage)) * 1000.0 / count;
+        costs.insert(QString::fromLatin1(stage) + QStringLiteral("_us"), us);
+    }
+    const QJsonValue rss = result.value(QStringLiteral("rss_delta_kib"));
+    const QJsonValue baselineRss = baseline.value(QStringLiteral("rss_delta_kib"));
+    if (!rss.isUndefined() && !baselineRss.isUndefined())
+        costs.insert(QStringLiteral("rss_kib"), (rss.toDouble() - baselineRss.toDouble()) / count);
+    return costs;
+}
+
+void writeJson(const QJsonObject &object, const QString &path)
+{
+    const QByteArray json = QJsonDocument(object).toJson(QJsonDocument::Indented);
+    if (path.isEmpty()) {
+        std::fwrite(json.constData(), 1, size_t(json.size()), stdout);
+        return;
+    }
+    QFile output(path);
+    if (!output.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        std::fprintf(stderr, "Cannot write %s\n", qPrintable(path));
+        return;
+    }
+    output.write(json);
+    std::fprintf(stderr, "[BENCHMARK] Report written to %s\n", qPrintable(path));
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const bool softwareGl = hasFlag(argc, argv, "--software-gl");
+    OffscreenRenderer::configureProcess(softwareGl);
+
+    QGuiApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Offscreen Gizmo3D many-gizmo scaling benchmark"));
+    parser.addHelpOption();
+    const QCommandLineOption typesOption(QStringLiteral("types"),
+                                         QStringLiteral("Gizmo types: translate, rotate, scale."),
+                                         QStringLiteral("list"),
+                                         QStringLiteral("translate,rotate,scale"));
+    const QCommandLineOption countsOption(QStringLiteral("counts"),
+                                          QStringLiteral("Gizmo counts per type."),
+                                          QStringLiteral("list"), QStringLiteral("1,10,100,1000"));
+    const QCommandLineOption warmupOption(QStringLiteral("warmup"),
+                                          QStringLiteral("Frames rendered before measuring."),
+                                          QStringLiteral("frames"), QStringLiteral("20"));
+    const QCommandLineOption framesOption(QStringLiteral("frames"),
+                                          QStringLiteral("Measured frames (one full camera orbit)."),
+                                          QStringLiteral("frames"), QStringLiteral("120"));
+    const QCommandLineOption sizeOption(QStringLiteral("size"),
+                                        QStringLiteral("Render target size."),
+                                        QStringLiteral("WxH"), QStringLiteral("1600x1000"));
+    const QCommandLineOption softwareOption(QStringLiteral("software-gl"),
+                                            QStringLiteral("Use software OpenGL (no GPU)."));
+    const QCommandLineOption outputOption(QStringLiteral("output"),
+                                          QStringLiteral("JSON report path (default: stdout)."),
+                                          QStringLiteral("file"));
+    QCommandLineOption runOption(QStringLiteral("run"),
+                                 QStringLiteral("Run a single configuration (internal)."),
+                                 QStringLiteral("type:count"));
+    runOption.setFlags(QCommandLineOption::HiddenFromHelp);
+    parser.addOptions({typesOption, countsOption, warmupOption, framesOption, sizeOption,
+                       softwareOption, outputOption, runOption});
+    parser.process(app);
+
+    const int warmupFrames = qMax(0, parser.value(warmupOption).toInt());
+    const int measureFrames = qMax(1, parser.value(framesOption).toInt());
+    const QStringList sizeParts = parser.value(sizeOption).split(QLatin1Char('x'));
+    const QSize size(sizeParts.value(0).toInt(), sizeParts.value(1).toInt());
+    if (size.isEmpty()) {
+        std::fprintf(stderr, "Invalid --size\n");
+        return 2;
+    }
+
+    if (parser.isSet(runOption)) {
+        const QStringList run = parser.value(runOption).split(QLatin1Char(':'));
+        const QJsonObject result = runConfiguration(
+            {run.value(0), qMax(0, run.value(1).toInt()), warmupFrames, measureFrames, size});
+        if (result.isEmpty())
+            return 1;
+        writeJson(result, QString());
+        return 0;
+    }
+
+    const QStringList types = parser.value(typesOption).split(QLatin1Char(','), Qt::SkipEmptyParts);
+    std::vector<int> counts;
+    for (const QString &count : parser.value(countsOption).split(QLatin1Char(','), Qt::SkipEmptyParts))
+        counts.push_back(qMax(1, count.toInt()));
+    int mode = 0;
+    for (const QString &type : types) {
+        if (!lookupType(type, &mode) || mode < 0) {
+            std::fprintf(stderr, "Invalid --types\n");
+            return 2;
+        }
+    }
+    if (types.isEmpty() || counts.empty()) {
+        std::fprintf(stderr, "Invalid --types or --counts\n");
+        return 2;
+    }
+
+    std::fprintf(stderr, "[BENCHMARK] Gizmo3D many-gizmo scaling\n");
+    std::fprintf(stderr, "[BENCHMARK] Types: %s, Counts: %s\n", qPrintable(types.join(QLatin1Char(','))),
+                 qPrintable(parser.value(countsOption)));
+    std::fprintf(stderr, "[BENCHMARK] Target: %dx%d, Warmup: %d, Measured: %d frames\n",
+                 size.width(), size.height(), warmupFrames, measureFrames);
+
+    QJsonArray baselines;
+    QJsonObject curves;
+    QJsonObject environment;
+    for (int count : counts) {
+        const QJsonObject baseline = runChild({QStringLiteral("none"), count, warmupFrames,
+                                               measureFrames, size}, softwareGl);
+        if (baseline.isEmpty())
+            return 1;
+        if (environment.isEmpty()) {
+            environment = {
+                {QStringLiteral("qt_version"), QLatin1StringView(qVersion())},
+                {QStringLiteral("qpa_platform"), QGuiApplication::platformName()},
+                {QStringLiteral("software_gl"), softwareGl},
+                {QStringLiteral("gl_renderer"), baseline.value(QStringLiteral("gl_renderer"))},
+                {QStringLiteral("gl_version"), baseline.value(QStringLiteral("gl_version"))},
+            };
+        }
+        QJsonObject baselinePoint = baseline;
+        baselinePoint.remove(QStringLiteral("gl_renderer"));
+        baselinePoint.remove(QStringLiteral("gl_version"));
+        baselinePoint.insert(QStringLiteral("targets"), count);
+        baselines.append(baselinePoint);
+
+        for (const QString &type : types) {
+            QJsonObject point = runChild({type, count, warmupFrames, measureFrames, size}, softwareGl);
+            if (point.isEmpty())
+                return 1;
+            point.remove(QStringLiteral("gl_renderer"));
+            point.remove(QStringLiteral("gl_version"));
+            point.insert(QStringLiteral("per_gizmo"), perGizmo(point, baseline, count));
+
+            QJsonArray curve = curves.value(type).toArray();
+            curve.append(point);
+            curves.insert(type, curve);
+
+            std::fprintf(stderr, "[BENCHMARK] %-9s x%-5d frame %.3f ms\n", qPrintable(type), count,
+                         stageAvgMs(point, "frame"));
+        }
+    }
+
+    QJsonArray countsJson;
+    for (int count : counts)
+        countsJson.append(count);
+
+    const QJsonObject report{
+        {QStringLiteral("benchmark"), QStringLiteral("gizmo3d_many_gizmos")},
+        {QStringLiteral("config"), QJsonObject{
+            {QStringLiteral("types"), QJsonArray::fromStringList(types)},
+            {QStringLiteral("counts"), countsJson},
+            {QStringLiteral("warmup_frames"), warmupFrames},
+            {QStringLiteral("measured_frames"), measureFrames},
+            {QStringLiteral("width"), size.width()},
+            {QStringLiteral("height"), size.height()},
+        }},
+        {QStringLiteral("environment"), environment},
+        {QStringLiteral("baseline"), baselines},
+        {QStringLiteral("curves"), curves},
+    };
+    writeJson(report, parser.value(outputOption));
+    return 0;
+}
@@ -0,0 +1,68 @@
+import QtQuick
+import QtQuick3D
+import Gizmo3D
+
+// Scene for the session replay tool (main.cpp): a grid of nodes moved as one selection
+// by a GizmoTransformController that takes a GizmoSessionPlayer as its gizmo. Nothing
+// is rendered; the replay measures the controller path and checks where the nodes end.
+Node {
+    id: root
+
+    property int nodeCount: 1
+    property alias player: sessionPlayer
+    property alias controller: transformController
+    property alias camera: sceneCamera
+
+    /**
+     * Puts every node back on the grid and selects them all
+     * @param pivotMode - GizmoSelection.PivotMode for the group
+     */
+    function prepare(pivotMode: int): void {
+        var nodes = []
+        for (var i = 0; i < repeater.count; i++) {
+            var node = repeater.objectAt(i)
+            node.position = gridPosition(i)
+            node.rotation = Qt.quaternion(1, 0, 0, 0)
+            node.scale = Qt.vector3d(1, 1, 1)
+            nodes.push(node)
+        }
+        selection.pivotMode = pivotMode
+        selection.nodes = nodes
+        sceneCamera.position = Qt.vector3d(0, 200, 400)
+        sceneCamera.eulerRotation = Qt.vector3d(-25, 0, 0)
+    }
+
+    function gridPosition(index: int): vector3d {
+        return Qt.vector3d((index % 32) * 20, Math.floor(index / 32) % 32 * 20,
+                           Math.floor(index / 1024) * 20)
+    }
+
+    function nodeAt(index: int): var {
+        return repeater.objectAt(index)
+    }
+
+    PerspectiveCamera {
+        id: sceneCamera
+    }
+
+    Repeater3D {
+        id: repeater
+        model: root.nodeCount
+        delegate: Node {}
+    }
+
+    GizmoSelection {
+        id: selection
+    }
+
+    GizmoSessionPlayer {
+        id: sessionPlayer
+        camera: sceneCamera
+    }
+
+    GizmoTransformController {
+        id: transformController
+        gizmo: sessionPlayer
+        selection: selection
+    }
+}
@@ -0,0 +1,247 @@
+// Session replay tool
+//
+// Replays a session log written by GizmoSessionRecorder into a scene of --nodes nodes,
+// selected as one group and moved by a GizmoTransformController that takes a
+// GizmoSessionPlayer as its gizmo. Records are replayed back to back (replayAll()), so
+// a run measures the controller path alone: no pointer, hit test or rendering.
+//
+// Every run starts from the same grid and replays the same records, so the final
+// transforms are identical from run to run and from build to build of the same code.
+// The report gives their checksum; a different checksum for the same log and node count
+// means the controller's results changed. Use it to reproduce a user's drag, or as a
+// regression benchmark of the controller.
+//
+// --dump prints the log as CSV instead (one record per line), for offline analysis.
+//
+// Usage: gizmo3d_session_replay <session.g3ds> [--nodes N] [--pivot centroid|individual]
+//                               [--runs N] [--output report.json]
+//        gizmo3d_session_replay <session.g3ds> --dump
+
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QGuiApplication>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QQmlComponent>
+#include <QQmlEngine>
+#include <QQuaternion>
+#include <QVector3D>
+
+#include "benchstats.h"
+#include "core/sessionlog.h"
+#include "gizmosessionplayer.h"
+#include "gizmotransformcontroller.h"
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+
+// GizmoSelection.PivotMode values
+constexpr int kPivotCentroid = 0;
+constexpr int kPivotIndividualOrigins = 3;
+
+const char *typeName(gizmo3d::core::SessionRecordType type)
+{
+    switch (type) {
+    case gizmo3d::core::SessionRecordType::Begin: return "begin";
+    case gizmo3d::core::SessionRecordType::Started: return "started";
+    case gizmo3d::core::SessionRecordType::Delta: return "delta";
+    case gizmo3d::core::SessionRecordType::Ended: return "ended";
+    case gizmo3d::core::SessionRecordType::Camera: return "camera";
+    }
+    return "unknown";
+}
+
+const char *signalName(gizmo3d::core::SessionSignal signal)
+{
+    switch (signal) {
+    case gizmo3d::core::SessionSignal::AxisTranslation: return "axis_translation";
+    case gizmo3d::core::SessionSignal::PlaneTranslation: return "plane_translation";
+    case gizmo3d::core::SessionSignal::Rotation: return "rotation";
+    case gizmo3d::core::SessionSignal::Scale: return "scale";
+    }
+    return "unknown";
+}
+
+int dump(const QString &path)
+{
+    QFile file(path);
+    const uchar *data = file.open(QIODevice::ReadOnly) ? file.map(0, file.size()) : nullptr;
+    gizmo3d::core::SessionReader reader;
+    if (!data || !reader.open(data, size_t(file.size()))) {
+        std::fprintf(stderr, "%s is not a session log\n", qPrintable(path));
+        return 2;
+    }
+
+    std::printf("index,time_ms,type,signal,handle,flags,v0,v1,v2,v3,v4,v5,v6,v7\n");
+    for (size_t i = 0; i < reader.size(); ++i) {
+        const gizmo3d::core::SessionRecord r = reader.record(i);
+        const bool gizmoSignal = r.type != gizmo3d::core::SessionRecordType::Begin
+                && r.type != gizmo3d::core::SessionRecordType::Camera;
+        std::printf("%zu,%.3f,%s,%s,%d,%d,%g,%g,%g,%g,%g,%g,%g,%g\n", i, double(r.time) / 1.0e6,
+                    typeName(r.type), gizmoSignal ? signalName(r.signal) : "", int(r.handle),
+                    int(r.flags), r.values[0], r.values[1], r.values[2], r.values[3], r.values[4],
+                    r.values[5], r.values[6], r.values[7]);
+    }
+    return 0;
+}
+
+// FNV-1a over the nodes' local transforms, as stored floats
+quint64 transformChecksum(QObject *scene, int nodeCount)
+{
+    quint64 hash = 14695981039346656037ull;
+    const auto mix = [&hash](float value) {
+        unsigned char bytes[sizeof(float)];
+        std::memcpy(bytes, &value, sizeof(value));
+        for (unsigned char byte : bytes) {
+            hash ^= byte;
+            hash *= 1099511628211ull;
+        }
+    };
+    for (int i = 0; i < nodeCount; ++i) {
+        QVariant value;
+        QMetaObject::invokeMethod(scene, "nodeAt", Q_RETURN_ARG(QVariant, value), Q_ARG(int, i));
+        const QObject *node = value.value<QObject *>();
+        if (!node)
+            continue;
+        const QVector3D p = node->property("position").value<QVector3D>();
+        const QQuaternion q = node->property("rotation").value<QQuaternion>();
+        const QVector3D s = node->property("scale").value<QVector3D>();
+        for (float value : {p.x(), p.y(), p.z(), q.scalar(), q.x(), q.y(), q.z(), s.x(), s.y(), s.z()})
+            mix(value);
+    }
+    return hash;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QGuiApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Gizmo3D session replay"));
+    parser.addHelpOption();
+    parser.addPositionalArgument(QStringLiteral("log"), QStringLiteral("Session log to replay."));
+    const QCommandLineOption nodesOption(QStringLiteral("nodes"),
+                                         QStringLiteral("Nodes in the replayed selection."),
+                                         QStringLiteral("count"), QStringLiteral("1"));
+    const QCommandLineOption pivotOption(QStringLiteral("pivot"),
+                                         QStringLiteral("Group pivot: centroid or individual."),
+                                         QStringLiteral("mode"), QStringLiteral("centroid"));
+    const QCommandLineOption runsOption(QStringLiteral("runs"),
+                                        QStringLiteral("Replays of the whole log."),
+                                        QStringLiteral("count"), QStringLiteral("5"));
+    const QCommandLineOption dumpOption(QStringLiteral("dump"),
+                                        QStringLiteral("Print the log as CSV and exit."));
+    const QCommandLineOption outputOption(QStringLiteral("output"),
+                                          QStringLiteral("JSON report path (default: stdout)."),
+                                          QStringLiteral("file"));
+    parser.addOptions({nodesOption, pivotOption, runsOption, dumpOption, outputOption});
+    parser.process(app);
+
+    if (parser.positionalArguments().size() != 1)
+        parser.showHelp(2);
+    const QString logPath = parser.positionalArguments().constFirst();
+    if (parser.isSet(dumpOption))
+        return dump(logPath);
+
+    const int nodeCount = qMax(1, parser.value(nodesOption).toInt());
+    const int runs = qMax(1, parser.value(runsOption).toInt());
+    const bool individual = parser.value(pivotOption) == QLatin1StringView("individual");
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, QUrl(QStringLiteral("qrc:/qt/qml/SessionReplay/Scene.qml")));
+    std::unique_ptr<QObject> scene(component.createWithInitialProperties(
+            {{QStringLiteral("nodeCount"), nodeCount}}));
+    if (!scene) {
+        std::fprintf(stderr, "%s\n", qPrintable(component.errorString()));
+        return 1;
+    }
+
+    auto *player = scene->property("player").value<GizmoSessionPlayer *>();
+    auto *controller = scene->property("controller").value<GizmoTransformController *>();
+    player->setPath(logPath);
+    if (!player->error().isEmpty()) {
+        std::fprintf(stderr, "%s\n", qPrintable(player->error()));
+        return 2;
+    }
+    const int recordCount = player->count();
+
+    // Per-delta solve and write-back time, as the controller measures it
+    std::vector<qint64> applyNs;
+    QObject::connect(controller, &GizmoTransformController::applied, controller, [&]() {
+        applyNs.push_back(qint64(controller->lastApplyTime() * 1.0e6));
+    });
+
+    std::fprintf(stderr, "[BENCHMARK] Gizmo3D session replay\n");
+    std::fprintf(stderr, "[BENCHMARK] Log: %s, Records: %d, Nodes: %d, Runs: %d\n",
+                 qPrintable(logPath), recordCount, nodeCount, runs);
+
+    std::vector<qint64> runNs;
+    quint64 checksum = 0;
+    bool deterministic = true;
+    QElapsedTimer timer;
+
+    for (int run = 0; run < runs; ++run) {
+        QMetaObject::invokeMethod(scene.get(), "prepare",
+                                  Q_ARG(int, individual ? kPivotIndividualOrigins : kPivotCentroid));
+        player->stop();
+
+        timer.start();
+        player->replayAll();
+        runNs.push_back(timer.nsecsElapsed());
+
+        const quint64 runChecksum = transformChecksum(scene.get(), nodeCount);
+        if (run > 0 && runChecksum != checksum)
+            deterministic = false;
+        checksum = runChecksum;
+    }
+
+    const QJsonObject replayStats = stageStats(runNs);
+    const double medianMs = replayStats.value(QStringLiteral("p50_ms")).toDouble();
+
+    const QJsonObject report{
+        {QStringLiteral("benchmark"), QStringLiteral("gizmo3d_session_replay")},
+        {QStringLiteral("config"), QJsonObject{
+            {QStringLiteral("log"), logPath},
+            {QStringLiteral("records"), recordCount},
+            {QStringLiteral("nodes"), nodeCount},
+            {QStringLiteral("pivot"), individual ? QStringLiteral("individual") : QStringLiteral("centroid")},
+            {QStringLiteral("runs"), runs},
+        }},
+        {QStringLiteral("environment"), QJsonObject{
+            {QStringLiteral("qt_version"), QLatin1StringView(qVersion())},
+        }},
+        {QStringLiteral("replay"), replayStats},
+        {QStringLiteral("apply"), stageStats(applyNs)},
+        {QStringLiteral("records_per_second"), medianMs > 0.0 ? recordCount * 1000.0 / medianMs : 0.0},
+        {QStringLiteral("checksum"), QString::number(checksum, 16).rightJustified(16, QLatin1Char('0'))},
+        {QStringLiteral("deterministic"), deterministic},
+    };
+
+    if (!deterministic)
+        std::fprintf(stderr, "[BENCHMARK] Runs ended with different transforms\n");
+
+    scene.reset();
+
+    const QByteArray json = QJsonDocument(report).toJson(QJsonDocument::Indented);
+    const QString outputPath = parser.value(outputOption);
+    if (outputPath.isEmpty()) {
+        std::fwrite(json.constData(), 1, size_t(json.size()), stdout);
+        return deterministic ? 0 : 1;
+    }
+
+    QFile output(outputPath);
+    if (!output.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        std::fprintf(stderr, "Cannot write %s\n", qPrintable(outputPath));
+        return 1;
+    }
+    output.write(json);
+    std::fprintf(stderr, "[BENCHMARK] Report written to %s\n", qPrintable(outputPath));
+    return deterministic ? 0 : 1;
+}
@@ -246,6 +246,14 @@ Window {
         }
     }
 
+    // Gizmo pipeline stats (run with GIZMO3D_PROFILE=1)
+    GizmoStatsOverlay {
+        anchors.bottom: parent.bottom
+        anchors.left: parent.left
+        anchors.margins: 10
+        visible: GizmoProfiler.enabled
+    }
+
     // Controls panel
     Rectangle {
         anchors.top: parent.top
@@ -0,0 +1,188 @@
+import QtQuick
+import QtQuick3D
+import Gizmo3D
+
+/**
+ * GizmoDirtyState - What changed since a gizmo last built its geometry
+ *
+ * Records the camera, viewport and target state of the last geometry update and
+ * classifies the current frame as a GizmoEnums.GeometryChange. Each gizmo owns one and
+ * binds its view, target and transform mode; MultiViewGizmo owns one without a view
+ * to classify the shared target once for all views. refresh() is the gizmos'
+ * per-frame driver.
+ */
+QtObject {
+    property View3D view3d: null
+    property Node target: null
+    property int transformMode: GizmoEnums.TransformMode.World
+
+    // Owner's GizmoEnums.Mode: tags profiler samples, and a change invalidates the
+    // geometry (GlobalGizmo's mode switches)
+    property int mode: -1
+
+    // False while the owner has no cached geometry to keep or offset
+    property bool cacheValid: true
+
+    property vector3d _lastCameraPos: Qt.vector3d(0, 0, 0)
+    property quaternion _lastCameraRot: Qt.quaternion(1, 0, 0, 0)
+    property vector3d _lastProjectionParams: Qt.vector3d(0, 0, 0)
+    property size _lastViewportSize: Qt.size(0, 0)
+    property vector3d _lastTargetPos: Qt.vector3d(0, 0, 0)
+    property quaternion _lastTargetRot: Qt.quaternion(1, 0, 0, 0)
+    property int _lastTransformMode: -1
+    property int _lastMode: -1
+    property bool _recorded: false
+
+    // Classify camera changes: moving the camera is a Translation, anything that alters
+    // the projection itself (orientation, lens, viewport size) is Full
+    function cameraChange(): int {
+        if (!view3d || !view3d.camera) return GizmoEnums.GeometryChange.Full
+        var cam = view3d.camera
+
+        if (!GizmoMath.quaternionEquals(cam.sceneRotation, _lastCameraRot) ||
+            !GizmoMath.vectorEquals(View3DProjectionAdapter.projectionParams(cam), _lastProjectionParams) ||
+            view3d.width !== _lastViewportSize.width ||
+            view3d.height !== _lastViewportSize.height) {
+            return GizmoEnums.GeometryChange.Full
+        }
+
+        return GizmoMath.vectorEquals(cam.scenePosition, _lastCameraPos)
+            ? GizmoEnums.GeometryChange.None
+            : GizmoEnums.GeometryChange.Translation
+    }
+
+    // Classify target changes: moving the target is a Translation, rotating it (local axes)
+    // or switching the transform mode is Full
+    function targetChange(): int {
+        if (!target || !_recorded) return GizmoEnums.GeometryChange.Full
+
+        if (!GizmoMath.quaternionEquals(target.sceneRotation, _lastTargetRot) ||
+            _lastTransformMode !== transformMode) {
+            return GizmoEnums.GeometryChange.Full
+        }
+
+        return GizmoMath.vectorEquals(target.scenePosition, _lastTargetPos)
+            ? GizmoEnums.GeometryChange.None
+            : GizmoEnums.GeometryChange.Translation
+    }
+
+    // Classifies what changed since the last update() (GizmoEnums.GeometryChange)
+    function geometryChange(): int {
+        return sharedGeometryChange(targetChange())
+    }
+
+    /**
+     * geometryChange() with the target already classified, when a parent made that
+     * classification once for several views (it is view-independent)
+     * @param sharedTargetChange - GizmoEnums.GeometryChange of the target
+     */
+    function sharedGeometryChange(sharedTargetChange: int): int {
+        if (!view3d || !view3d.camera || !target || !cacheValid || !_recorded ||
+            _lastMode !== mode) {
+            return GizmoEnums.GeometryChange.Full
+        }
+
+        var change = Math.max(cameraChange(), sharedTargetChange)
+        if (change === GizmoEnums.GeometryChange.Translation &&
+            !View3DProjectionAdapter.isOrthographic(view3d.camera)) {
+            return GizmoEnums.GeometryChange.Full
+        }
+        return change
+    }
+
+    // Record the current state after a geometry update
+    function update(): void {
+        if (view3d && view3d.camera) {
+            var cam = view3d.camera
+            _lastCameraPos = cam.scenePosition
+            _lastCameraRot = cam.sceneRotation
+            _lastProjectionParams = View3DProjectionAdapter.projectionParams(cam)
+            _lastViewportSize = Qt.size(view3d.width, view3d.height)
+        }
+        if (target) {
+            _lastTargetPos = target.scenePosition
+            _lastTargetRot = target.sceneRotation
+        }
+        _lastTransformMode = transformMode
+        _lastMode = mode
+        _recorded = true
+    }
+
+    /**
+     * Per-frame driver: unless nothing changed, offsets or rebuilds the owner's geometry
+     * with a fresh projector and records the state.
+     * @param owner - Gizmo implementing updateGeometry(projector, context) and
+     *                offsetGeometry(projector)
+     */
+    function refresh(owner: var): void {
+        _refresh(owner, _classifyTarget)
+    }
+
+    /**
+     * refresh() with the target already classified, as for sharedGeometryChange()
+     * @param owner - Gizmo implementing updateGeometry(projector, context) and
+     *                offsetGeometry(projector)
+     * @param sharedTargetChange - GizmoEnums.GeometryChange of the target
+     */
+    function sharedRefresh(owner: var, sharedTargetChange: int): void {
+        _refresh(owner, sharedTargetChange)
+    }
+
+    // _refresh() argument: classify the target in the dirty check
+    readonly property int _classifyTarget: -1
+
+    function _refresh(owner: var, sharedTargetChange: int): void {
+        if (GizmoProfiler.enabled) {
+            _profiledRefresh(owner, sharedTargetChange)
+            return
+        }
+
+        var change = _geometryChange(sharedTargetChange)
+        if (change === GizmoEnums.GeometryChange.None) return
+
+        var projector = View3DProjectionAdapter.createProjector(view3d)
+        if (projector) _rebuild(owner, projector, change)
+    }
+
+    // _refresh() with every stage timed and counted by GizmoProfiler
+    function _profiledRefresh(owner: var, sharedTargetChange: int): void {
+        var t = GizmoProfiler.begin(GizmoProfiler.DirtyCheck, owner, mode)
+        var change = _geometryChange(sharedTargetChange)
+        GizmoProfiler.end(GizmoProfiler.DirtyCheck, t)
+        if (change === GizmoEnums.GeometryChange.None) {
+            GizmoProfiler.count(GizmoProfiler.SkippedUpdates)
+            return
+        }
+
+        t = GizmoProfiler.begin(GizmoProfiler.Projection, owner, mode)
+        var projector = View3DProjectionAdapter.createProjector(view3d)
+        GizmoProfiler.end(GizmoProfiler.Projection, t)
+        GizmoProfiler.count(GizmoProfiler.Projections)
+        if (!projector) return
+
+        t = GizmoProfiler.begin(GizmoProfiler.GeometryBuild, owner, mode)
+        _rebuild(owner, projector, change)
+        GizmoProfiler.end(GizmoProfiler.GeometryBuild, t)
+        GizmoProfiler.count(GizmoProfiler.GeometryUpdates)
+    }
+
+    function _geometryChange(sharedTargetChange: int): int {
+        return sharedTargetChange === _classifyTarget ? geometryChange()
+                                                       : sharedGeometryChange(sharedTargetChange)
+    }
+
+    function _rebuild(owner: var, projector: var, change: int): void {
+        if (change === GizmoEnums.GeometryChange.Translation) {
+            owner.offsetGeometry(projector)
+        } else {
+            owner.updateGeometry(projector, null)
+        }
+        update()
+        if (GizmoLatency.enabled) GizmoLatency.mark(GizmoLatency.Geometry)
+    }
+
+    // Force a Full change on the next frame (e.g. after frames were skipped while hidden)
+    function invalidate(): void {
+        _recorded = false
+    }
+}
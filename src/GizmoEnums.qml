@@ -33,4 +33,15 @@ QtObject {
         Both = 3,      // Translation + Rotation
         All = 4        // Translation + Rotation + Scale (composite mode)
     }
+
+    // Geometry invalidation level reported by the gizmos' per-frame dirty checks.
+    // Under an orthographic camera screen-space offsets do not depend on depth, so a
+    // pure camera or target pan moves the gizmo on screen without changing its shape:
+    // the cached geometry is shifted instead of rebuilt. With perspective any move
+    // changes the projected shape, so the same change is Full
+    enum GeometryChange {
+        None = 0,         // Nothing moved: keep the cached geometry
+        Translation = 1,  // Pure pan under an orthographic camera: offset the cached geometry
+        Full = 2          // Orientation, lens or viewport changed: recompute the geometry
+    }
 }
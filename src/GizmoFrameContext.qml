@@ -0,0 +1,95 @@
+// GizmoFrameContext.qml - Per-frame, per-target projection state shared by the calculators
+// One context is built per frame and view, then read by the translation, scale and rotation
+// geometry calculators so composite modes project the target and its axes only once.
+
+pragma Singleton
+import QtQuick
+import Gizmo3D
+
+QtObject {
+    readonly property vector3d _worldX: Qt.vector3d(1, 0, 0)
+    readonly property vector3d _worldY: Qt.vector3d(0, 1, 0)
+    readonly property vector3d _worldZ: Qt.vector3d(0, 0, 1)
+
+    /**
+     * Builds the frame context for one target seen through one projector.
+     * The projector is validated here once, so calculators reading the context call it
+     * directly instead of going through the GizmoProjection wrappers.
+     * @param projector - Projector object implementing the GizmoProjection interface
+     * @param targetPosition - vector3d gizmo center in world space
+     * @param axes - {x, y, z} axis directions (world or local)
+     * @returns Context object, or null if the projector is invalid:
+     *   {
+     *     projector: the validated projector
+     *     targetPosition: vector3d
+     *     axes: {x, y, z}
+     *     center: vector3d - Projected target (x, y in pixels, z depth)
+     *     axisDirs: {x, y, z} - point screen offset of targetPosition + axis from center
+     *     axisLengths: {x, y, z} - real pixels per world unit along each axis
+     *     worldAxisLengths: {x, y, z} - real pixels per world unit along the world axes
+     *     orthographic: bool
+     *     toCamera: vector3d - From the target towards the viewer (reversed view
+     *                          direction for orthographic cameras)
+     *   }
+     */
+    function create(projector: var, targetPosition: vector3d, axes: var): var {
+        if (!projector || typeof projector.projectWorldToScreen !== 'function' || !axes) {
+            console.error("GizmoFrameContext: Invalid projector or axes")
+            return null
+        }
+
+        var center = projector.projectWorldToScreen(targetPosition)
+
+        function probe(axis) {
+            var screen = projector.projectWorldToScreen(Qt.vector3d(
+                targetPosition.x + axis.x, targetPosition.y + axis.y, targetPosition.z + axis.z))
+            return Qt.point(screen.x - center.x, screen.y - center.y)
+        }
+
+        function length(dir) {
+            return Math.sqrt(dir.x * dir.x + dir.y * dir.y)
+        }
+
+        var axisDirs = { x: probe(axes.x), y: probe(axes.y), z: probe(axes.z) }
+        var axisLengths = {
+            x: length(axisDirs.x),
+            y: length(axisDirs.y),
+            z: length(axisDirs.z)
+        }
+
+        // World-space probes (rotation circle radii): the same as the axis probes in world mode
+        var worldAxisLengths = axisLengths
+        if (!GizmoMath.vectorEquals(axes.x, _worldX) || !GizmoMath.vectorEquals(axes.y, _worldY) ||
+            !GizmoMath.vectorEquals(axes.z, _worldZ)) {
+            worldAxisLengths = {
+                x: length(probe(_worldX)),
+                y: length(probe(_worldY)),
+                z: length(probe(_worldZ))
+            }
+        }
+
+        var orthographic = GizmoProjection.isOrthographic(projector)
+        var toCamera
+        if (orthographic) {
+            var forward = GizmoProjection.getCameraForward(projector)
+            toCamera = Qt.vector3d(-forward.x, -forward.y, -forward.z)
+        } else {
+            var cameraPos = GizmoProjection.getCameraPosition(projector)
+            toCamera = Qt.vector3d(cameraPos.x - targetPosition.x,
+                                   cameraPos.y - targetPosition.y,
+                                   cameraPos.z - targetPosition.z)
+        }
+
+        return {
+            projector: projector,
+            targetPosition: targetPosition,
+            axes: axes,
+            center: center,
+            axisDirs: axisDirs,
+            axisLengths: axisLengths,
+            worldAxisLengths: worldAxisLengths,
+            orthographic: orthographic,
+            toCamera: toCamera
+        }
+    }
+}
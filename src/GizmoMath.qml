@@ -1,18 +1,19 @@
 pragma Singleton
 
 import QtQuick
+import QtQuick3D
 
 QtObject {
     // ========================================
     // Coordinate Space Conversion Functions
     // ========================================
 
-    function worldToScreen(view3d, position) {
-        if (!view3d) return Qt.point(0, 0)
+    function worldToScreen(view3d: View3D, position: vector3d): vector3d {
+        if (!view3d) return Qt.vector3d(0, 0, 0)
         return view3d.mapFrom3DScene(position)
     }
 
-    function screenToWorld(view3d, screenPos) {
+    function screenToWorld(view3d: View3D, screenPos: vector3d): vector3d {
         if (!view3d) return Qt.vector3d(0, 0, 0)
         return view3d.mapTo3DScene(screenPos)
     }
@@ -21,11 +22,11 @@ QtObject {
     // Vector Math Helper Functions
     // ========================================
 
-    function dotProduct(a, b) {
+    function dotProduct(a: vector3d, b: vector3d): real {
         return a.x * b.x + a.y * b.y + a.z * b.z
     }
 
-    function crossProduct(a, b) {
+    function crossProduct(a: vector3d, b: vector3d): vector3d {
         return Qt.vector3d(
             a.y * b.z - a.z * b.y,
             a.z * b.x - a.x * b.z,
@@ -33,51 +34,72 @@ QtObject {
         )
     }
 
-    function normalize(v) {
+    function normalize(v: vector3d): vector3d {
         var len = Math.sqrt(v.x * v.x + v.y * v.y + v.z * v.z)
         if (len < 0.0001) return Qt.vector3d(0, 0, 1)
         return Qt.vector3d(v.x / len, v.y / len, v.z / len)
     }
 
-    function vectorSubtract(a, b) {
+    function vectorSubtract(a: vector3d, b: vector3d): vector3d {
         return Qt.vector3d(a.x - b.x, a.y - b.y, a.z - b.z)
     }
 
-    function vectorAdd(a, b) {
+    function vectorAdd(a: vector3d, b: vector3d): vector3d {
         return Qt.vector3d(a.x + b.x, a.y + b.y, a.z + b.z)
     }
 
-    function vectorScale(v, s) {
+    function vectorScale(v: vector3d, s: real): vector3d {
         return Qt.vector3d(v.x * s, v.y * s, v.z * s)
     }
 
-    function vectorLength(v) {
+    function vectorLength(v: vector3d): real {
         return Math.sqrt(v.x * v.x + v.y * v.y + v.z * v.z)
     }
 
+    // Tolerance of vectorEquals() and quaternionEquals()
+    readonly property real defaultEpsilon: 0.0001
+
+    /**
+     * Compare two vector3d values for equality within defaultEpsilon
+     * @param a - First vector
+     * @param b - Second vector
+     * @returns true if vectors are equal within defaultEpsilon
+     */
+    function vectorEquals(a: vector3d, b: vector3d): bool {
+        return vectorEqualsWithin(a, b, defaultEpsilon)
+    }
+
     /**
      * Compare two vector3d values for equality within epsilon
      * @param a - First vector
      * @param b - Second vector
-     * @param epsilon - Comparison tolerance (default 0.0001)
+     * @param epsilon - Comparison tolerance
      * @returns true if vectors are equal within epsilon
      */
-    function vectorEquals(a, b, epsilon) {
-        if (!epsilon) epsilon = 0.0001
+    function vectorEqualsWithin(a: vector3d, b: vector3d, epsilon: real): bool {
         return Math.abs(a.x - b.x) < epsilon
             && Math.abs(a.y - b.y) < epsilon
             && Math.abs(a.z - b.z) < epsilon
     }
 
+    /**
+     * Compare two quaternion values for equality within defaultEpsilon
+     * @param a - First quaternion
+     * @param b - Second quaternion
+     * @returns true if quaternions are equal within defaultEpsilon
+     */
+    function quaternionEquals(a: quaternion, b: quaternion): bool {
+        return quaternionEqualsWithin(a, b, defaultEpsilon)
+    }
+
     /**
      * Compare two quaternion values for equality within epsilon
      * @param a - First quaternion
      * @param b - Second quaternion
-     * @param epsilon - Comparison tolerance (default 0.0001)
+     * @param epsilon - Comparison tolerance
      * @returns true if quaternions are equal within epsilon
      */
-    function quaternionEquals(a, b, epsilon) {
-        if (!epsilon) epsilon = 0.0001
+    function quaternionEqualsWithin(a: quaternion, b: quaternion, epsilon: real): bool {
         return Math.abs(a.x - b.x) < epsilon
             && Math.abs(a.y - b.y) < epsilon
             && Math.abs(a.z - b.z) < epsilon
@@ -90,7 +112,7 @@ QtObject {
 
     // Construct a camera ray through a screen point
     // Returns object with {origin, direction} in world space
-    function getCameraRay(view3d, screenPos) {
+    function getCameraRay(view3d: View3D, screenPos: point): var {
         if (!view3d) {
             return {
                 origin: Qt.vector3d(0, 0, 0),
@@ -99,7 +121,7 @@ QtObject {
         }
 
         // Get two points along the ray at different depths
-        var nearPoint = view3d.mapTo3DScene(screenPos)
+        var nearPoint = view3d.mapTo3DScene(Qt.vector3d(screenPos.x, screenPos.y, 0))
         var farPoint = view3d.mapTo3DScene(Qt.vector3d(screenPos.x, screenPos.y, 100))
 
         // Calculate ray direction (from near to far, away from camera)
@@ -128,7 +150,8 @@ QtObject {
 
     // Calculate closest point on an axis to a ray
     // Returns the scalar t such that axisOrigin + t*axisDir is closest to the ray
-    function closestPointOnAxisToRay(rayOrigin, rayDir, axisOrigin, axisDir) {
+    function closestPointOnAxisToRay(rayOrigin: vector3d, rayDir: vector3d,
+                                     axisOrigin: vector3d, axisDir: vector3d): real {
         // Vector from axis origin to ray origin
         var wx = rayOrigin.x - axisOrigin.x
         var wy = rayOrigin.y - axisOrigin.y
@@ -155,7 +178,8 @@ QtObject {
 
     // Ray-plane intersection
     // Returns intersection point in world space, or null if ray is parallel to plane
-    function intersectRayPlane(rayOrigin, rayDir, planeOrigin, planeNormal) {
+    function intersectRayPlane(rayOrigin: vector3d, rayDir: vector3d,
+                               planeOrigin: vector3d, planeNormal: vector3d): var {
         var denom = dotProduct(rayDir, planeNormal)
 
         // Ray is parallel to plane
@@ -176,14 +200,14 @@ QtObject {
 
     // Snap a delta/relative value to the nearest increment
     // Used for relative snapping (snapToAbsolute: false)
-    function snapValue(value, increment) {
+    function snapValue(value: real, increment: real): real {
         if (increment <= 0) return value
         return Math.round(value / increment) * increment
     }
 
     // Snap an absolute value to the nearest world grid position
     // Used for world-space snapping (snapToAbsolute: true)
-    function snapValueAbsolute(value, increment) {
+    function snapValueAbsolute(value: real, increment: real): real {
         if (increment <= 0) return value
         return Math.round(value / increment) * increment
     }
@@ -192,13 +216,14 @@ QtObject {
     // Angle Utilities
     // ========================================
 
-    function normalizeAngleDelta(delta) {
+    function normalizeAngleDelta(delta: real): real {
         while (delta > Math.PI) delta -= Math.PI * 2
         while (delta < -Math.PI) delta += Math.PI * 2
         return delta
     }
 
-    function calculatePlaneAngle(point, center, planeNormal, referenceAxis) {
+    function calculatePlaneAngle(point: vector3d, center: vector3d,
+                                 planeNormal: vector3d, referenceAxis: vector3d): real {
         // Get vector from center to point
         var toPoint = vectorSubtract(point, center)
 
@@ -221,7 +246,7 @@ QtObject {
     // Quaternion Helper Functions
     // ========================================
 
-    function quaternionFromAxisAngle(axis, angleDegrees) {
+    function quaternionFromAxisAngle(axis: vector3d, angleDegrees: real): quaternion {
         // Convert degrees to radians
         var angleRadians = angleDegrees * (Math.PI / 180)
         var halfAngle = angleRadians / 2
@@ -243,7 +268,7 @@ QtObject {
      * @param quat - Quaternion rotation to apply
      * @returns Rotated vector3d
      */
-    function transformVectorByQuaternion(vec, quat) {
+    function transformVectorByQuaternion(vec: vector3d, quat: quaternion): vector3d {
         // Quaternion-vector multiplication: q * v * q^(-1)
         // For unit quaternions, q^(-1) = q* (conjugate)
 
@@ -272,7 +297,7 @@ QtObject {
      * @param rotation - Quaternion representing the node's rotation
      * @returns Object with {x, y, z} vector3d local axes
      */
-    function getLocalAxes(rotation) {
+    function getLocalAxes(rotation: quaternion): var {
         return {
             x: transformVectorByQuaternion(Qt.vector3d(1, 0, 0), rotation),
             y: transformVectorByQuaternion(Qt.vector3d(0, 1, 0), rotation),
@@ -291,7 +316,7 @@ QtObject {
      * @param lineEnd - Segment end {x, y}
      * @returns Distance in pixels
      */
-    function distanceToLineSegment2D(point, lineStart, lineEnd) {
+    function distanceToLineSegment2D(point: var, lineStart: var, lineEnd: var): real {
         var dx = lineEnd.x - lineStart.x
         var dy = lineEnd.y - lineStart.y
 
@@ -327,7 +352,7 @@ QtObject {
      * @param corners - Array of 4 corner points [{x, y}, {x, y}, {x, y}, {x, y}]
      * @returns true if point is inside quad
      */
-    function pointInQuad2D(point, corners) {
+    function pointInQuad2D(point: var, corners: var): bool {
         if (!corners || corners.length !== 4) {
             return false
         }
@@ -361,7 +386,7 @@ QtObject {
      * @param polylinePoints - Array of points [{x, y}, ...] forming connected segments
      * @returns Minimum distance in pixels
      */
-    function distanceToPolyline2D(point, polylinePoints) {
+    function distanceToPolyline2D(point: var, polylinePoints: var): real {
         if (!polylinePoints || polylinePoints.length < 2) {
             return Infinity
         }
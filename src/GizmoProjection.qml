@@ -20,7 +20,7 @@ QtObject {
      * @param projector - Object implementing projectWorldToScreen(worldPos)
      * @returns vector3d with x,y as screen coordinates, z as depth
      */
-    function projectWorldToScreen(worldPos, projector) {
+    function projectWorldToScreen(worldPos: vector3d, projector: var): vector3d {
         if (!projector || typeof projector.projectWorldToScreen !== 'function') {
             console.error("GizmoProjection: Invalid projector object")
             return Qt.vector3d(0, 0, 0)
@@ -34,7 +34,7 @@ QtObject {
      * @param projector - Object implementing projectScreenToWorld(screenPos)
      * @returns vector3d in world space
      */
-    function projectScreenToWorld(screenPos, projector) {
+    function projectScreenToWorld(screenPos: point, projector: var): vector3d {
         if (!projector || typeof projector.projectScreenToWorld !== 'function') {
             console.error("GizmoProjection: Invalid projector object")
             return Qt.vector3d(0, 0, 0)
@@ -48,7 +48,7 @@ QtObject {
      * @param projector - Object implementing getCameraRay(screenPos)
      * @returns { origin: vector3d, direction: vector3d }
      */
-    function getCameraRay(screenPos, projector) {
+    function getCameraRay(screenPos: point, projector: var): var {
         if (!projector || typeof projector.getCameraRay !== 'function') {
             console.error("GizmoProjection: Invalid projector object")
             return { origin: Qt.vector3d(0, 0, 0), direction: Qt.vector3d(0, 0, 1) }
@@ -61,7 +61,7 @@ QtObject {
      * @param projector - Object implementing getCameraPosition()
      * @returns vector3d camera position
      */
-    function getCameraPosition(projector) {
+    function getCameraPosition(projector: var): vector3d {
         if (!projector || typeof projector.getCameraPosition !== 'function') {
             console.error("GizmoProjection: Invalid projector object")
             return Qt.vector3d(0, 0, 0)
@@ -74,11 +74,22 @@ QtObject {
      * @param projector - Object implementing getCameraForward()
      * @returns vector3d normalized forward direction
      */
-    function getCameraForward(projector) {
+    function getCameraForward(projector: var): vector3d {
         if (!projector || typeof projector.getCameraForward !== 'function') {
             console.error("GizmoProjection: Invalid projector object")
             return Qt.vector3d(0, 0, -1)
         }
         return projector.getCameraForward()
     }
+
+    /**
+     * Whether the projector uses an orthographic projection
+     * @param projector - Object optionally implementing isOrthographic()
+     * @returns bool (false when the projector does not implement it)
+     */
+    function isOrthographic(projector: var): bool {
+        return !!projector
+            && typeof projector.isOrthographic === 'function'
+            && projector.isOrthographic()
+    }
 }
@@ -0,0 +1,127 @@
+import QtQuick
+import Gizmo3D
+
+/**
+ * GizmoStatsOverlay - Live view of GizmoProfiler
+ *
+ * Drop-in HUD listing the per-stage timings and counters of the gizmo pipeline,
+ * averaged over the profiler's frame history. It attaches GizmoProfiler to its window,
+ * so frames close once per rendered frame.
+ *
+ * Usage:
+ *   GizmoStatsOverlay {
+ *       anchors.bottom: parent.bottom
+ *       anchors.left: parent.left
+ *       anchors.margins: 10
+ *       profiling: true   // or run with GIZMO3D_PROFILE=1
+ *   }
+ *
+ * Built without GIZMO3D_PROFILING the overlay says so and collects nothing.
+ */
+Rectangle {
+    id: root
+
+    // Turns GizmoProfiler on while the overlay exists; leave unset to follow GIZMO3D_PROFILE
+    property bool profiling: GizmoProfiler.enabled
+
+    // Latest GizmoProfiler.summary(), refreshed on GizmoProfiler.updated
+    property var summary: ({ frames: 0 })
+
+    readonly property var _stageRows: [
+        { key: "dirtyCheck", label: "Dirty check" },
+        { key: "projection", label: "Projection" },
+        { key: "geometryBuild", label: "Geometry" },
+        { key: "hitTest", label: "Hit test" },
+        { key: "dragSolve", label: "Drag solve" },
+        { key: "signalEmit", label: "Signal emit" }
+    ]
+    readonly property var _counterRows: [
+        { key: "projections", label: "Projections" },
+        { key: "pointsGenerated", label: "Points" },
+        { key: "skippedUpdates", label: "Skipped" },
+        { key: "geometryUpdates", label: "Updates" }
+    ]
+
+    width: statsColumn.width + 20
+    height: statsColumn.height + 20
+    color: "#cc000000"
+    radius: 5
+
+    onProfilingChanged: GizmoProfiler.enabled = profiling
+    Component.onCompleted: {
+        GizmoProfiler.enabled = profiling
+        GizmoProfiler.attach(Window.window)
+    }
+    Window.onWindowChanged: GizmoProfiler.attach(Window.window)
+
+    Connections {
+        target: GizmoProfiler
+        function onUpdated() { root.summary = GizmoProfiler.summary() }
+    }
+
+    function _pad(text: string, width: int): string {
+        while (text.length < width) text += " "
+        return text
+    }
+
+    function _stageLine(row: var): string {
+        var stage = summary.stages ? summary.stages[row.key] : undefined
+        if (!stage) return _pad(row.label, 12) + "     -"
+        return _pad(row.label, 12) + stage.avg_ms.toFixed(3) + " ms  (max " + stage.max_ms.toFixed(2) + ")"
+    }
+
+    function _counterLine(row: var): string {
+        var counter = summary.counters ? summary.counters[row.key] : undefined
+        if (!counter) return _pad(row.label, 12) + "     -"
+        return _pad(row.label, 12) + counter.avg.toFixed(1) + " /frame  (max " + counter.max + ")"
+    }
+
+    Column {
+        id: statsColumn
+        anchors.centerIn: parent
+        spacing: 4
+
+        Text {
+            text: "Gizmo Profiler"
+            color: "white"
+            font.pixelSize: 14
+            font.bold: true
+        }
+
+        Text {
+            visible: !GizmoProfiler.available
+            text: "Profiling not compiled in\n(GIZMO3D_PROFILING=OFF)"
+            color: "#ff4040"
+            font.pixelSize: 12
+        }
+
+        Text {
+            visible: GizmoProfiler.available
+            text: GizmoProfiler.enabled ? "Frames: " + root.summary.frames : "Disabled"
+            color: GizmoProfiler.enabled ? "#aaaaaa" : "#666666"
+            font.pixelSize: 12
+        }
+
+        Repeater {
+            model: GizmoProfiler.available ? root._stageRows : []
+            Text {
+                required property var modelData
+                text: root._stageLine(modelData)
+                color: "#40ff40"
+                font.pixelSize: 12
+                font.family: "monospace"
+            }
+        }
+
+        Repeater {
+            model: GizmoProfiler.available ? root._counterRows : []
+            Text {
+                required property var modelData
+                text: root._counterLine(modelData)
+                color: "#80c0ff"
+                font.pixelSize: 12
+                font.family: "monospace"
+            }
+        }
+    }
+}
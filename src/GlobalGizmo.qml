@@ -19,6 +19,7 @@ import Gizmo3D
  * The GlobalGizmo:
  * - Manages two child gizmos (TranslationGizmo and RotationGizmo)
  * - Binds common properties (view3d, targetNode, snapEnabled, snapToAbsolute)
+ * - Creates each child gizmo the first time the mode shows it (see releaseDelay)
  * - Forwards all signals from both gizmos for controller integration
  * - Provides mode control to switch between translation and rotation
  */
@@ -28,6 +29,12 @@ Item {
     // Common properties factorized from both gizmos
     property View3D view3d: null
     property Node targetNode: null
+
+    // Multi-selection: when targetNodes is set the gizmo sits on their pivot and
+    // targetNode is ignored. Each move still emits one delta, for the whole set
+    property list<Node> targetNodes
+    property int pivotMode: GizmoSelection.Centroid
+
     property bool snapEnabled: false
     property bool snapToAbsolute: true
 
@@ -52,21 +59,95 @@ Item {
     // Mode control: GizmoEnums.Mode.Translate, Rotate, Scale, Both, or All
     property int mode: GizmoEnums.Mode.Translate
 
+    // External control flag - when true, a parent (MultiViewGizmo) drives sharedFrameUpdate()
+    property bool managedByParent: false
+
+    // Compute child geometry natively on the shared worker pool (see TranslationGizmo)
+    property bool parallelGeometry: false
+
+    // Child gizmos are created the first time the mode shows them. preloadSubGizmos
+    // creates all three up front; releaseDelay >= 0 destroys a child after it has been
+    // hidden by the mode for that many ms (-1 keeps it for instant mode switches)
+    property bool preloadSubGizmos: false
+    property int releaseDelay: -1
+
+    // Child gizmos, null until created (see SubGizmoLoader)
+    readonly property ScaleGizmo scaleGizmo: scaleLoader.item as ScaleGizmo
+    readonly property TranslationGizmo translationGizmo: translationLoader.item as TranslationGizmo
+    readonly property RotationGizmo rotationGizmo: rotationLoader.item as RotationGizmo
+
+    // Pivot tracking for targetNodes, readable by controllers and batch appliers
+    readonly property GizmoSelection selection: GizmoSelection {
+        nodes: root.targetNodes
+        pivotMode: root.pivotMode
+    }
+
+    // Drags write targetNode's transform natively, without a controller; the signals
+    // still fire. deltas.validator can veto or adjust each write. Not for targetNodes
+    property bool directManipulation: false
+
+    // Opt-in single typed delta signal (deltas.enabled: true). Forwarded natively from
+    // the child gizmos, bypassing the signal relays below; targets are activeTarget's
+    readonly property GizmoDeltaForwarder deltas: GizmoDeltaForwarder {
+        sources: [root.translationGizmo, root.rotationGizmo, root.scaleGizmo]
+        targetNode: root.activeTarget
+        applyToTarget: root.directManipulation && root.selection.count === 0
+    }
+
+    // Node the gizmo is drawn on: the selection's pivot, or targetNode
+    readonly property Node activeTarget: selection.count > 0 ? pivotNode : targetNode
+
+    // Local/world axes, computed once and shared by all child gizmos
+    property var currentAxes: {
+        if (transformMode === GizmoEnums.TransformMode.Local && activeTarget) {
+            return GizmoMath.getLocalAxes(activeTarget.sceneRotation)
+        } else {
+            return {
+                x: Qt.vector3d(1, 0, 0),
+                y: Qt.vector3d(0, 1, 0),
+                z: Qt.vector3d(0, 0, 1)
+            }
+        }
+    }
+
     // Forward activeAxis from active gizmo
     readonly property int activeAxis: {
-        if (mode === GizmoEnums.Mode.Translate) return translationGizmo.activeAxis
-        if (mode === GizmoEnums.Mode.Rotate) return rotationGizmo.activeAxis
-        if (mode === GizmoEnums.Mode.Scale) return scaleGizmo.activeAxis
+        var scaleAxis = scaleGizmo ? scaleGizmo.activeAxis : GizmoEnums.Axis.None
+        var translationAxis = translationGizmo ? translationGizmo.activeAxis : GizmoEnums.Axis.None
+        var rotationAxis = rotationGizmo ? rotationGizmo.activeAxis : GizmoEnums.Axis.None
+        if (mode === GizmoEnums.Mode.Translate) return translationAxis
+        if (mode === GizmoEnums.Mode.Rotate) return rotationAxis
+        if (mode === GizmoEnums.Mode.Scale) return scaleAxis
         // For Both/All modes, return first non-None activeAxis
-        if (scaleGizmo.activeAxis !== GizmoEnums.Axis.None) return scaleGizmo.activeAxis
-        if (translationGizmo.activeAxis !== GizmoEnums.Axis.None) return translationGizmo.activeAxis
-        if (rotationGizmo.activeAxis !== GizmoEnums.Axis.None) return rotationGizmo.activeAxis
-        return GizmoEnums.Axis.None
+        if (scaleAxis !== GizmoEnums.Axis.None) return scaleAxis
+        if (translationAxis !== GizmoEnums.Axis.None) return translationAxis
+        return rotationAxis
     }
-    readonly property int activePlane: translationGizmo.activePlane
+    readonly property int activePlane: translationGizmo ? translationGizmo.activePlane
+                                                        : GizmoEnums.Plane.None
 
     readonly property bool isActive: {
-        return translationGizmo.isActive || rotationGizmo.isActive || scaleGizmo.isActive
+        return (translationGizmo !== null && translationGizmo.isActive) ||
+               (rotationGizmo !== null && rotationGizmo.isActive) ||
+               (scaleGizmo !== null && scaleGizmo.isActive)
+    }
+
+    // Handle being manipulated as {mode, axis, plane}, where mode is the child gizmo's
+    // GizmoEnums.Mode (Translate, Rotate or Scale), or null when idle
+    readonly property var activeHandle: {
+        if (translationGizmo && translationGizmo.isActive) {
+            return { mode: GizmoEnums.Mode.Translate, axis: translationGizmo.activeAxis,
+                     plane: translationGizmo.activePlane }
+        }
+        if (rotationGizmo && rotationGizmo.isActive) {
+            return { mode: GizmoEnums.Mode.Rotate, axis: rotationGizmo.activeAxis,
+                     plane: GizmoEnums.Plane.None }
+        }
+        if (scaleGizmo && scaleGizmo.isActive) {
+            return { mode: GizmoEnums.Mode.Scale, axis: scaleGizmo.activeAxis,
+                     plane: GizmoEnums.Plane.None }
+        }
+        return null
     }
 
     // Translation signals (forwarded from TranslationGizmo)
@@ -90,240 +171,272 @@ Item {
     // Computed property: are we in composite mode with multiple gizmos sharing arrow space?
     readonly property bool isCompositeMode: mode === GizmoEnums.Mode.All
 
-    visible: targetNode !== null && view3d !== null
+    visible: activeTarget !== null && view3d !== null
 
     // Dirty-checking state for performance optimization
-    property vector3d _lastCameraPos: Qt.vector3d(0, 0, 0)
-    property quaternion _lastCameraRot: Qt.quaternion(1, 0, 0, 0)
-    property vector3d _lastTargetPos: Qt.vector3d(0, 0, 0)
-    property quaternion _lastTargetRot: Qt.quaternion(1, 0, 0, 0)
-    property int _lastTransformMode: -1
-
-    // Check if camera or target transforms have changed since last frame
-    function _transformsChanged() {
-        if (!view3d || !view3d.camera || !targetNode) return true
-
-        var cam = view3d.camera
-        var epsilon = 0.0001
-
-        // Check camera position
-        var camPos = cam.scenePosition
-        if (Math.abs(camPos.x - _lastCameraPos.x) > epsilon ||
-            Math.abs(camPos.y - _lastCameraPos.y) > epsilon ||
-            Math.abs(camPos.z - _lastCameraPos.z) > epsilon) {
-            return true
-        }
+    GizmoDirtyState {
+        id: dirtyState
+        view3d: root.view3d
+        target: root.activeTarget
+        transformMode: root.transformMode
+        // A mode switch shows sub-gizmos whose cached geometry is stale or missing
+        mode: root.mode
+    }
 
-        // Check camera rotation
-        var camRot = cam.sceneRotation
-        if (Math.abs(camRot.x - _lastCameraRot.x) > epsilon ||
-            Math.abs(camRot.y - _lastCameraRot.y) > epsilon ||
-            Math.abs(camRot.z - _lastCameraRot.z) > epsilon ||
-            Math.abs(camRot.scalar - _lastCameraRot.scalar) > epsilon) {
-            return true
-        }
+    // Frames are skipped while hidden, so the cached state can miss changes
+    onVisibleChanged: if (!visible) dirtyState.invalidate()
 
-        // Check target position
-        var targetPos = targetNode.scenePosition
-        if (Math.abs(targetPos.x - _lastTargetPos.x) > epsilon ||
-            Math.abs(targetPos.y - _lastTargetPos.y) > epsilon ||
-            Math.abs(targetPos.z - _lastTargetPos.z) > epsilon) {
-            return true
-        }
+    /**
+     * Updates all visible child gizmos with ONE shared projector if anything changed.
+     * Called by the coordinating FrameAnimation, or once per frame by a managing parent.
+     */
+    function frameUpdate(): void {
+        dirtyState.refresh(root)
+    }
 
-        // Check target rotation (only matters for local transform mode)
-        var targetRot = targetNode.sceneRotation
-        if (Math.abs(targetRot.x - _lastTargetRot.x) > epsilon ||
-            Math.abs(targetRot.y - _lastTargetRot.y) > epsilon ||
-            Math.abs(targetRot.z - _lastTargetRot.z) > epsilon ||
-            Math.abs(targetRot.scalar - _lastTargetRot.scalar) > epsilon) {
-            return true
-        }
+    /**
+     * frameUpdate() for a parent that already classified the target (it is
+     * view-independent) and drives several GlobalGizmos
+     * @param targetChange - GizmoEnums.GeometryChange of the target
+     */
+    function sharedFrameUpdate(targetChange: int): void {
+        dirtyState.sharedRefresh(root, targetChange)
+    }
 
-        // Check transform mode change
-        if (_lastTransformMode !== transformMode) {
-            return true
-        }
+    /**
+     * Rebuilds the visible child gizmos' geometry from one frame context, so the target
+     * and its axes are projected once for all of them.
+     * @param projector - Shared projector object from View3DProjectionAdapter
+     * @param context - Optional GizmoFrameContext; built from the projector when null
+     */
+    function updateGeometry(projector: var, context: var): void {
+        if (!context && activeTarget)
+            context = GizmoFrameContext.create(projector, activeTarget.scenePosition, currentAxes)
+        var subGizmos = _jsGeometryGizmos()
+        for (var i = 0; i < subGizmos.length; i++) subGizmos[i].updateGeometry(projector, context)
+    }
+
+    /**
+     * Shifts the visible child gizmos' cached geometry to the target's screen position.
+     * @param projector - Shared projector object from View3DProjectionAdapter
+     */
+    function offsetGeometry(projector: var): void {
+        var subGizmos = _jsGeometryGizmos()
+        for (var i = 0; i < subGizmos.length; i++) subGizmos[i].offsetGeometry(projector)
+    }
 
-        return false
+    // Visible child gizmos whose geometry is built here; children on the native path
+    // are published by GizmoFrameCoordinator
+    function _jsGeometryGizmos(): var {
+        return [scaleGizmo, translationGizmo, rotationGizmo].filter(function(gizmo) {
+            return gizmo && gizmo.visible && !gizmo.parallelGeometryActive
+        })
     }
 
-    // Update cached state after geometry update
-    function _updateCachedState() {
-        if (!view3d || !view3d.camera || !targetNode) return
+    /**
+     * Highlights a handle without a local drag, mirroring a drag in another view.
+     * @param handle - {mode, axis, plane} as reported by activeHandle, or null to clear
+     */
+    function showHandle(handle: var): void {
+        var translate = handle && handle.mode === GizmoEnums.Mode.Translate
+        var rotate = handle && handle.mode === GizmoEnums.Mode.Rotate
+        var scale = handle && handle.mode === GizmoEnums.Mode.Scale
+
+        if (translationGizmo) {
+            translationGizmo.activeAxis = translate ? handle.axis : GizmoEnums.Axis.None
+            translationGizmo.activePlane = translate ? handle.plane : GizmoEnums.Plane.None
+        }
+        if (rotationGizmo) rotationGizmo.activeAxis = rotate ? handle.axis : GizmoEnums.Axis.None
+        if (scaleGizmo) scaleGizmo.activeAxis = scale ? handle.axis : GizmoEnums.Axis.None
+    }
 
-        var cam = view3d.camera
-        _lastCameraPos = cam.scenePosition
-        _lastCameraRot = cam.sceneRotation
-        _lastTargetPos = targetNode.scenePosition
-        _lastTargetRot = targetNode.sceneRotation
-        _lastTransformMode = transformMode
+    // Stand-in target for a multi-selection. It has no parent, so its position is
+    // its scene position
+    Node {
+        id: pivotNode
+        position: root.selection.pivot
+        rotation: root.selection.pivotRotation
     }
 
-    // Coordinating FrameAnimation - updates all visible child gizmos with ONE shared projector
+    // Coordinating FrameAnimation (standalone operation, disabled when managed by parent)
     FrameAnimation {
         id: coordinatorAnimation
-        running: root.visible && root.view3d && root.targetNode
-
-        onTriggered: {
-            // Skip geometry update if nothing has changed (performance optimization)
-            if (!root._transformsChanged()) return
-
-            var projector = View3DProjectionAdapter.createProjector(root.view3d)
-            if (!projector) return
-
-            // Update all visible child gizmos with shared projector
-            if (scaleGizmo.visible) {
-                scaleGizmo.updateGeometry(projector)
-            }
-            if (translationGizmo.visible) {
-                translationGizmo.updateGeometry(projector)
-            }
-            if (rotationGizmo.visible) {
-                rotationGizmo.updateGeometry(projector)
-            }
+        running: !root.managedByParent && root.visible && root.view3d && root.activeTarget
 
-            // Cache current state for next frame comparison
-            root._updateCachedState()
-        }
+        onTriggered: root.frameUpdate()
     }
 
     // ScaleGizmo child
-    ScaleGizmo {
-        id: scaleGizmo
+    SubGizmoLoader {
+        id: scaleLoader
         anchors.fill: parent
-        visible: root.mode === GizmoEnums.Mode.Scale || root.mode === GizmoEnums.Mode.All
-        z: root.mode === GizmoEnums.Mode.All ? 0 : 0
-
-        // Parent manages geometry updates via coordinating FrameAnimation
-        managedByParent: true
-
-        // Bind common properties
-        view3d: root.view3d
-        targetNode: root.targetNode
-        snapEnabled: root.snapEnabled
-        snapToAbsolute: root.snapToAbsolute
-        transformMode: root.transformMode
-        shapeAntialiasing: root.shapeAntialiasing
-
-        // Bind scale-specific properties
-        gizmoSize: root.gizmoSize
-        snapIncrement: root.scaleSnapIncrement
-
-        // Set arrow ratios for composite mode
-        arrowStartRatio: 0.0
-        arrowEndRatio: root.isCompositeMode ? 0.5 : 1.0
+        shown: root.mode === GizmoEnums.Mode.Scale || root.mode === GizmoEnums.Mode.All
+        preload: root.preloadSubGizmos
+        releaseDelay: root.releaseDelay
+
+        sourceComponent: Component {
+            ScaleGizmo {
+                anchors.fill: parent
+                visible: scaleLoader.shown
+
+                // Parent manages geometry updates via coordinating FrameAnimation
+                managedByParent: true
+                parallelGeometry: root.parallelGeometry
+
+                // Bind common properties
+                view3d: root.view3d
+                targetNode: root.activeTarget
+                snapEnabled: root.snapEnabled
+                snapToAbsolute: root.snapToAbsolute
+                transformMode: root.transformMode
+                currentAxes: root.currentAxes
+                shapeAntialiasing: root.shapeAntialiasing
+
+                // Bind scale-specific properties
+                gizmoSize: root.gizmoSize
+                snapIncrement: root.scaleSnapIncrement
+
+                // Set arrow ratios for composite mode
+                arrowStartRatio: 0.0
+                arrowEndRatio: root.isCompositeMode ? 0.5 : 1.0
+            }
+        }
     }
 
     // TranslationGizmo child
-    TranslationGizmo {
-        id: translationGizmo
+    SubGizmoLoader {
+        id: translationLoader
         anchors.fill: parent
-        visible: root.mode === GizmoEnums.Mode.Translate || root.mode === GizmoEnums.Mode.Both || root.mode === GizmoEnums.Mode.All
-        z: root.mode === GizmoEnums.Mode.Both || root.mode === GizmoEnums.Mode.All ? 0 : 0
-
-        // Parent manages geometry updates via coordinating FrameAnimation
-        managedByParent: true
-
-        // Bind common properties
-        view3d: root.view3d
-        targetNode: root.targetNode
-        snapEnabled: root.snapEnabled
-        snapToAbsolute: root.snapToAbsolute
-        transformMode: root.transformMode
-        shapeAntialiasing: root.shapeAntialiasing
-
-        // Bind translation-specific properties
-        gizmoSize: root.gizmoSize * 1.3
-        snapIncrement: root.snapIncrement
-
-        // Set arrow ratios for composite mode
-        arrowStartRatio: root.isCompositeMode ? 0.5 : 0.0
-        arrowEndRatio: 1.0
+        shown: root.mode === GizmoEnums.Mode.Translate || root.mode === GizmoEnums.Mode.Both || root.mode === GizmoEnums.Mode.All
+        preload: root.preloadSubGizmos
+        releaseDelay: root.releaseDelay
+
+        sourceComponent: Component {
+            TranslationGizmo {
+                anchors.fill: parent
+                visible: translationLoader.shown
+
+                // Parent manages geometry updates via coordinating FrameAnimation
+                managedByParent: true
+                parallelGeometry: root.parallelGeometry
+
+                // Bind common properties
+                view3d: root.view3d
+                targetNode: root.activeTarget
+                snapEnabled: root.snapEnabled
+                snapToAbsolute: root.snapToAbsolute
+                transformMode: root.transformMode
+                currentAxes: root.currentAxes
+                shapeAntialiasing: root.shapeAntialiasing
+
+                // Bind translation-specific properties
+                gizmoSize: root.gizmoSize * 1.3
+                snapIncrement: root.snapIncrement
+
+                // Set arrow ratios for composite mode
+                arrowStartRatio: root.isCompositeMode ? 0.5 : 0.0
+                arrowEndRatio: 1.0
+            }
+        }
     }
 
     // RotationGizmo child
-    RotationGizmo {
-        id: rotationGizmo
+    SubGizmoLoader {
+        id: rotationLoader
         anchors.fill: parent
-        visible: root.mode === GizmoEnums.Mode.Rotate || root.mode === GizmoEnums.Mode.Both || root.mode === GizmoEnums.Mode.All
+        shown: root.mode === GizmoEnums.Mode.Rotate || root.mode === GizmoEnums.Mode.Both || root.mode === GizmoEnums.Mode.All
+        preload: root.preloadSubGizmos
+        releaseDelay: root.releaseDelay
         z: root.mode === GizmoEnums.Mode.Both || root.mode === GizmoEnums.Mode.All ? 1 : 0  // Rotation on top when multiple visible
 
-        // Parent manages geometry updates via coordinating FrameAnimation
-        managedByParent: true
-
-        // Bind common properties
-        view3d: root.view3d
-        targetNode: root.targetNode
-        snapEnabled: root.snapEnabled
-        snapToAbsolute: root.snapToAbsolute
-        transformMode: root.transformMode
-        shapeAntialiasing: root.shapeAntialiasing
-
-        // Bind rotation-specific properties
-        gizmoSize: root.gizmoSize
-        snapAngle: root.snapAngle
+        sourceComponent: Component {
+            RotationGizmo {
+                anchors.fill: parent
+                visible: rotationLoader.shown
+
+                // Parent manages geometry updates via coordinating FrameAnimation
+                managedByParent: true
+                parallelGeometry: root.parallelGeometry
+
+                // Bind common properties
+                view3d: root.view3d
+                targetNode: root.activeTarget
+                snapEnabled: root.snapEnabled
+                snapToAbsolute: root.snapToAbsolute
+                transformMode: root.transformMode
+                currentAxes: root.currentAxes
+                shapeAntialiasing: root.shapeAntialiasing
+
+                // Bind rotation-specific properties
+                gizmoSize: root.gizmoSize
+                snapAngle: root.snapAngle
+            }
+        }
     }
 
     // Forward translation signals
     Connections {
-        target: translationGizmo
+        target: root.translationGizmo
 
-        function onAxisTranslationStarted(axis) {
+        function onAxisTranslationStarted(axis: int) {
             root.axisTranslationStarted(axis)
         }
 
-        function onAxisTranslationDelta(axis, transformMode, delta, snapActive) {
+        function onAxisTranslationDelta(axis: int, transformMode: int, delta: real, snapActive: bool) {
+            if (GizmoLatency.enabled) GizmoLatency.mark(GizmoLatency.Forwarded)
             root.axisTranslationDelta(axis, transformMode, delta, snapActive)
         }
 
-        function onAxisTranslationEnded(axis) {
+        function onAxisTranslationEnded(axis: int) {
             root.axisTranslationEnded(axis)
         }
 
-        function onPlaneTranslationStarted(plane) {
+        function onPlaneTranslationStarted(plane: int) {
             root.planeTranslationStarted(plane)
         }
 
-        function onPlaneTranslationDelta(plane, transformMode, delta, snapActive) {
+        function onPlaneTranslationDelta(plane: int, transformMode: int, delta: vector3d, snapActive: bool) {
+            if (GizmoLatency.enabled) GizmoLatency.mark(GizmoLatency.Forwarded)
             root.planeTranslationDelta(plane, transformMode, delta, snapActive)
         }
 
-        function onPlaneTranslationEnded(plane) {
+        function onPlaneTranslationEnded(plane: int) {
             root.planeTranslationEnded(plane)
         }
     }
 
     // Forward rotation signals
     Connections {
-        target: rotationGizmo
+        target: root.rotationGizmo
 
-        function onRotationStarted(axis) {
+        function onRotationStarted(axis: int) {
             root.rotationStarted(axis)
         }
 
-        function onRotationDelta(axis, transformMode, angleDegrees, snapActive) {
+        function onRotationDelta(axis: int, transformMode: int, angleDegrees: real, snapActive: bool) {
+            if (GizmoLatency.enabled) GizmoLatency.mark(GizmoLatency.Forwarded)
             root.rotationDelta(axis, transformMode, angleDegrees, snapActive)
         }
 
-        function onRotationEnded(axis) {
+        function onRotationEnded(axis: int) {
             root.rotationEnded(axis)
         }
     }
 
     // Forward scale signals
     Connections {
-        target: scaleGizmo
+        target: root.scaleGizmo
 
-        function onScaleStarted(axis) {
+        function onScaleStarted(axis: int) {
             root.scaleStarted(axis)
         }
 
-        function onScaleDelta(axis, transformMode, scaleFactor, snapActive) {
+        function onScaleDelta(axis: int, transformMode: int, scaleFactor: real, snapActive: bool) {
+            if (GizmoLatency.enabled) GizmoLatency.mark(GizmoLatency.Forwarded)
             root.scaleDelta(axis, transformMode, scaleFactor, snapActive)
         }
 
-        function onScaleEnded(axis) {
+        function onScaleEnded(axis: int) {
             root.scaleEnded(axis)
         }
     }
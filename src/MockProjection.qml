@@ -18,7 +18,7 @@ QtObject {
      *   }
      * @returns Projector object compatible with GizmoProjection interface
      */
-    function createProjector(config) {
+    function createProjector(config: var): var {
         config = config || {}
 
         var projType = config.type || "orthographic"
@@ -124,6 +124,15 @@ QtObject {
             },
 
             getCameraRay: function(screenPos) {
+                if (this.type === "orthographic") {
+                    // Parallel rays along the view direction, starting on the camera plane
+                    var planePoint = this._unprojectOrthographic(screenPos)
+                    return {
+                        origin: Qt.vector3d(planePoint.x, planePoint.y, this.cameraPosition.z),
+                        direction: this.cameraForward
+                    }
+                }
+
                 var origin = this.cameraPosition
                 var target = this.projectScreenToWorld(screenPos)
 
@@ -157,6 +166,10 @@ QtObject {
 
             getCameraForward: function() {
                 return this.cameraForward
+            },
+
+            isOrthographic: function() {
+                return this.type === "orthographic"
             }
         }
     }
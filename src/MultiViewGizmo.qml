@@ -0,0 +1,229 @@
+pragma ComponentBehavior: Bound
+
+import QtQuick
+import QtQuick3D
+import Gizmo3D
+
+/**
+ * MultiViewGizmo - One logical gizmo presented in several View3Ds
+ *
+ * Editors that show the same selection in several views (e.g. a quad view) would
+ * otherwise need one GlobalGizmo per view, each duplicating axes, dirty checks and
+ * signal forwarding, and each competing for the active handle. MultiViewGizmo owns the
+ * target-side state once and instantiates a lightweight GlobalGizmo inside each view
+ * that only does that view's projection, rendering and hit testing.
+ *
+ * Usage:
+ *   MultiViewGizmo {
+ *       views: [perspectiveView, topView, frontView, sideView]
+ *       targetNode: myCube
+ *       mode: GizmoEnums.Mode.All
+ *   }
+ *
+ * Shared across views:
+ * - Local/world axes and target change detection (computed once per frame)
+ * - Snap configuration, transform mode and gizmo mode
+ * - The drag session: while a handle is dragged in one view, the other views show it
+ *   highlighted and ignore presses until the drag ends
+ *
+ * Each per-view gizmo is reparented into its View3D, so it always covers that view.
+ * Signals are the same as GlobalGizmo's and are emitted once, from the dragging view.
+ */
+Item {
+    id: root
+
+    // Views presenting the gizmo
+    property list<View3D> views
+
+    // Target and configuration shared by every view
+    property Node targetNode: null
+    property bool snapEnabled: false
+    property bool snapToAbsolute: true
+    property int transformMode: GizmoEnums.TransformMode.World
+    property real gizmoSize: 80.0
+    property real snapIncrement: 1.0
+    property real snapAngle: 15.0
+    property real scaleSnapIncrement: 0.1
+    property bool shapeAntialiasing: true
+    property int mode: GizmoEnums.Mode.Translate
+    property bool parallelGeometry: false
+
+    // Local/world axes, computed once for all views
+    readonly property var currentAxes: {
+        if (transformMode === GizmoEnums.TransformMode.Local && targetNode) {
+            return GizmoMath.getLocalAxes(targetNode.sceneRotation)
+        } else {
+            return {
+                x: Qt.vector3d(1, 0, 0),
+                y: Qt.vector3d(0, 1, 0),
+                z: Qt.vector3d(0, 0, 1)
+            }
+        }
+    }
+
+    // Drag session: the view whose gizmo owns the current drag (null when idle)
+    property View3D _activeView: null
+    property GlobalGizmo _activeGizmo: null
+    readonly property View3D activeView: _activeView
+
+    readonly property var activeHandle: _activeGizmo ? _activeGizmo.activeHandle : null
+    readonly property int activeAxis: _activeGizmo ? _activeGizmo.activeAxis : GizmoEnums.Axis.None
+    readonly property int activePlane: _activeGizmo ? _activeGizmo.activePlane : GizmoEnums.Plane.None
+    readonly property bool isActive: _activeGizmo !== null
+
+    // Translation signals
+    signal axisTranslationStarted(int axis)
+    signal axisTranslationDelta(int axis, int transformMode, real delta, bool snapActive)
+    signal axisTranslationEnded(int axis)
+    signal planeTranslationStarted(int plane)
+    signal planeTranslationDelta(int plane, int transformMode, vector3d delta, bool snapActive)
+    signal planeTranslationEnded(int plane)
+
+    // Rotation signals
+    signal rotationStarted(int axis)
+    signal rotationDelta(int axis, int transformMode, real angleDegrees, bool snapActive)
+    signal rotationEnded(int axis)
+
+    // Scale signals
+    signal scaleStarted(int axis)
+    signal scaleDelta(int axis, int transformMode, real scaleFactor, bool snapActive)
+    signal scaleEnded(int axis)
+
+    visible: targetNode !== null
+
+    /**
+     * Returns the gizmo presented in a view
+     * @param view3d - One of the views
+     * @returns GlobalGizmo or null
+     */
+    function gizmoForView(view3d: View3D): GlobalGizmo {
+        for (var i = 0; i < viewGizmos.count; i++) {
+            var gizmo = viewGizmos.objectAt(i) as GlobalGizmo
+            if (gizmo && gizmo.view3d === view3d) return gizmo
+        }
+        return null
+    }
+
+    // Start of a drag in one view: it owns the session and the others mirror its handle
+    function _beginDrag(gizmo: GlobalGizmo): void {
+        _activeView = gizmo.view3d
+        _activeGizmo = gizmo
+        for (var i = 0; i < viewGizmos.count; i++) {
+            var other = viewGizmos.objectAt(i) as GlobalGizmo
+            if (other && other !== gizmo) other.showHandle(gizmo.activeHandle)
+        }
+    }
+
+    function _endDrag(): void {
+        for (var i = 0; i < viewGizmos.count; i++) {
+            var other = viewGizmos.objectAt(i) as GlobalGizmo
+            if (other && other !== _activeGizmo) other.showHandle(null)
+        }
+        _activeView = null
+        _activeGizmo = null
+    }
+
+    // View-independent dirty state: the target is classified once per frame for all views
+    GizmoDirtyState {
+        id: targetState
+        target: root.targetNode
+        transformMode: root.transformMode
+    }
+
+    // Single coordinating FrameAnimation: shared work once, then per-view projection
+    FrameAnimation {
+        id: coordinatorAnimation
+        running: root.visible && viewGizmos.count > 0
+
+        onTriggered: {
+            var targetChange = targetState.targetChange()
+            for (var i = 0; i < viewGizmos.count; i++) {
+                var gizmo = viewGizmos.objectAt(i) as GlobalGizmo
+                if (gizmo && gizmo.visible) gizmo.sharedFrameUpdate(targetChange)
+            }
+            targetState.update()
+        }
+    }
+
+    // One presentation per view (Instantiator, so each gizmo can live inside its view)
+    Instantiator {
+        id: viewGizmos
+        model: root.views
+
+        delegate: GlobalGizmo {
+            id: viewGizmo
+            required property View3D modelData
+
+            parent: modelData
+            anchors.fill: parent
+            z: 1000
+
+            managedByParent: true
+            parallelGeometry: root.parallelGeometry
+            view3d: modelData
+            visible: root.visible && view3d !== null
+            enabled: root.enabled && (root._activeView === null || root._activeView === view3d)
+
+            targetNode: root.targetNode
+            currentAxes: root.currentAxes
+            snapEnabled: root.snapEnabled
+            snapToAbsolute: root.snapToAbsolute
+            transformMode: root.transformMode
+            gizmoSize: root.gizmoSize
+            snapIncrement: root.snapIncrement
+            snapAngle: root.snapAngle
+            scaleSnapIncrement: root.scaleSnapIncrement
+            shapeAntialiasing: root.shapeAntialiasing
+            mode: root.mode
+
+            onAxisTranslationStarted: (axis) => {
+                root._beginDrag(viewGizmo)
+                root.axisTranslationStarted(axis)
+            }
+            onAxisTranslationDelta: (axis, transformMode, delta, snapActive) => {
+                root.axisTranslationDelta(axis, transformMode, delta, snapActive)
+            }
+            onAxisTranslationEnded: (axis) => {
+                root.axisTranslationEnded(axis)
+                root._endDrag()
+            }
+            onPlaneTranslationStarted: (plane) => {
+                root._beginDrag(viewGizmo)
+                root.planeTranslationStarted(plane)
+            }
+            onPlaneTranslationDelta: (plane, transformMode, delta, snapActive) => {
+                root.planeTranslationDelta(plane, transformMode, delta, snapActive)
+            }
+            onPlaneTranslationEnded: (plane) => {
+                root.planeTranslationEnded(plane)
+                root._endDrag()
+            }
+            onRotationStarted: (axis) => {
+                root._beginDrag(viewGizmo)
+                root.rotationStarted(axis)
+            }
+            onRotationDelta: (axis, transformMode, angleDegrees, snapActive) => {
+                root.rotationDelta(axis, transformMode, angleDegrees, snapActive)
+            }
+            onRotationEnded: (axis) => {
+                root.rotationEnded(axis)
+                root._endDrag()
+            }
+            onScaleStarted: (axis) => {
+                root._beginDrag(viewGizmo)
+                root.scaleStarted(axis)
+            }
+            onScaleDelta: (axis, transformMode, scaleFactor, snapActive) => {
+                root.scaleDelta(axis, transformMode, scaleFactor, snapActive)
+            }
+            onScaleEnded: (axis) => {
+                root.scaleEnded(axis)
+                root._endDrag()
+            }
+        }
+
+        onObjectRemoved: (index, object) => {
+            if (object === root._activeGizmo) root._endDrag()
+        }
+    }
+}
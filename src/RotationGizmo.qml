@@ -27,7 +27,8 @@ Item {
     property bool isActive: activeAxis !== GizmoEnums.Axis.None
 
     // Computed local/world axes based on transform mode
-    readonly property var currentAxes: {
+    // (a coordinating parent may bind its own shared axes instead)
+    property var currentAxes: {
         if (transformMode === GizmoEnums.TransformMode.Local && targetNode) {
             return GizmoMath.getLocalAxes(targetNode.sceneRotation)
         } else {
@@ -58,7 +59,7 @@ Item {
 
     // Performance optimization: drag state and caching
     property bool isDragging: false
-    property var cachedProjector: null
+    property GizmoProjector cachedProjector: null
     property var lastHitTestGeometry: null
 
     // External control flag - when true, parent manages geometry updates via FrameAnimation
@@ -76,90 +77,62 @@ Item {
     property var _previousRadii: null
 
     // Dirty-checking state for performance optimization (standalone mode only)
-    property vector3d _lastCameraPos: Qt.vector3d(0, 0, 0)
-    property quaternion _lastCameraRot: Qt.quaternion(1, 0, 0, 0)
-    property vector3d _lastTargetPos: Qt.vector3d(0, 0, 0)
-    property quaternion _lastTargetRot: Qt.quaternion(1, 0, 0, 0)
-    property int _lastTransformMode: -1
-
-    // Check if camera or target transforms have changed since last frame
-    function _transformsChanged() {
-        if (!view3d || !view3d.camera || !targetNode) return true
-
-        var cam = view3d.camera
-        var epsilon = 0.0001
-
-        // Check camera position
-        var camPos = cam.scenePosition
-        if (Math.abs(camPos.x - _lastCameraPos.x) > epsilon ||
-            Math.abs(camPos.y - _lastCameraPos.y) > epsilon ||
-            Math.abs(camPos.z - _lastCameraPos.z) > epsilon) {
-            return true
-        }
-
-        // Check camera rotation
-        var camRot = cam.sceneRotation
-        if (Math.abs(camRot.x - _lastCameraRot.x) > epsilon ||
-            Math.abs(camRot.y - _lastCameraRot.y) > epsilon ||
-            Math.abs(camRot.z - _lastCameraRot.z) > epsilon ||
-            Math.abs(camRot.scalar - _lastCameraRot.scalar) > epsilon) {
-            return true
-        }
-
-        // Check target position
-        var targetPos = targetNode.scenePosition
-        if (Math.abs(targetPos.x - _lastTargetPos.x) > epsilon ||
-            Math.abs(targetPos.y - _lastTargetPos.y) > epsilon ||
-            Math.abs(targetPos.z - _lastTargetPos.z) > epsilon) {
-            return true
-        }
-
-        // Check target rotation (matters for local transform mode)
-        var targetRot = targetNode.sceneRotation
-        if (Math.abs(targetRot.x - _lastTargetRot.x) > epsilon ||
-            Math.abs(targetRot.y - _lastTargetRot.y) > epsilon ||
-            Math.abs(targetRot.z - _lastTargetRot.z) > epsilon ||
-            Math.abs(targetRot.scalar - _lastTargetRot.scalar) > epsilon) {
-            return true
-        }
-
-        // Check transform mode change
-        if (_lastTransformMode !== transformMode) {
-            return true
-        }
-
-        return false
+    GizmoDirtyState {
+        id: dirtyState
+        view3d: root.view3d
+        target: root.targetNode
+        transformMode: root.transformMode
+        mode: GizmoEnums.Mode.Rotate
+        cacheValid: root.geometry !== null
     }
 
-    // Update cached state after geometry update
-    function _updateCachedState() {
-        if (!view3d || !view3d.camera || !targetNode) return
+    visible: targetNode !== null && view3d !== null
 
-        var cam = view3d.camera
-        _lastCameraPos = cam.scenePosition
-        _lastCameraRot = cam.sceneRotation
-        _lastTargetPos = targetNode.scenePosition
-        _lastTargetRot = targetNode.sceneRotation
-        _lastTransformMode = transformMode
+    // Opt-in native geometry: computed on GizmoFrameCoordinator's worker pool together
+    // with every other gizmo's. The JS path takes over whenever the task is inactive
+    // (unsupported camera lens, no window)
+    property bool parallelGeometry: false
+    readonly property bool parallelGeometryActive: geometryTask.active
+
+    GizmoGeometryTask {
+        id: geometryTask
+        kind: GizmoGeometryTask.Circle
+        enabled: root.parallelGeometry && root.visible
+        view3d: root.parallelGeometry ? root.view3d : null
+        targetPosition: root.targetPosition
+        // Drag start axes during active rotation for stable wedge rendering
+        axes: (root.activeAxis !== GizmoEnums.Axis.None && root.dragStartAxes) ? root.dragStartAxes : root.currentAxes
+        facingAxes: root.currentAxes
+        gizmoSize: root.gizmoSize
+        maxScreenRadius: root.maxScreenRadius
+        segments: 48
+        onGeometryChanged: {
+            var newGeometry = geometryTask.geometry
+            root.geometry = newGeometry
+            root._previousRadii = newGeometry.radii
+            root.yzFacingAngle = newGeometry.facing.yz
+            root.zxFacingAngle = newGeometry.facing.zx
+            root.xyFacingAngle = newGeometry.facing.xy
+        }
     }
 
-    visible: targetNode !== null && view3d !== null
-
     // Internal FrameAnimation for standalone operation (disabled when managed by parent)
     FrameAnimation {
         id: internalAnimation
-        running: !root.managedByParent && root.visible && root.view3d && root.targetNode
+        running: !root.managedByParent && !root.parallelGeometryActive &&
+                 root.visible && root.view3d && root.targetNode
 
-        onTriggered: {
-            // Skip geometry update if nothing has changed (performance optimization)
-            if (!root._transformsChanged()) return
+        onTriggered: dirtyState.refresh(root)
+    }
 
-            var projector = View3DProjectionAdapter.createProjector(root.view3d)
-            if (projector) {
-                root.updateGeometry(projector)
-                root._updateCachedState()
-            }
-        }
+    // Latency instrumentation: the controller's write to the target during a drag
+    Connections {
+        target: root.targetNode
+        enabled: GizmoLatency.enabled && root.isActive
+
+        function onPositionChanged() { GizmoLatency.mark(GizmoLatency.Applied) }
+        function onRotationChanged() { GizmoLatency.mark(GizmoLatency.Applied) }
+        function onScaleChanged() { GizmoLatency.mark(GizmoLatency.Applied) }
     }
 
     /**
@@ -167,48 +140,66 @@ Item {
      * Called by parent coordinator (GlobalGizmo) or internal FrameAnimation.
      * Uses ONE shared projector for all calculations (was 4 projectors before).
      * @param projector - Shared projector object from View3DProjectionAdapter
+     * @param context - Optional GizmoFrameContext shared with sibling gizmos (GlobalGizmo);
+     *                  built from the projector when omitted
      */
-    function updateGeometry(projector) {
+    function updateGeometry(projector: var, context: var): void {
         if (!view3d || !view3d.camera || !targetNode) {
             geometry = null
             return
         }
 
+        if (!context) context = GizmoFrameContext.create(projector, targetNode.scenePosition, currentAxes)
+        if (!context) {
+            geometry = null
+            return
+        }
+
         // Use drag start axes during active rotation for stable wedge rendering
         var axesToUse = (activeAxis !== GizmoEnums.Axis.None && dragStartAxes) ? dragStartAxes : currentAxes
 
         // Calculate main geometry with temporal smoothing
-        var newGeometry = RotationGeometryCalculator.calculateCircleGeometry({
-            projector: projector,
-            targetPosition: targetNode.scenePosition,
-            axes: axesToUse,
-            gizmoSize: gizmoSize,
-            maxScreenRadius: maxScreenRadius,
-            segments: 48,  // matches GeometryTemplates.defaultSegments -> uses cached unit circle
-            previousRadii: _previousRadii,
-            smoothingFactor: 0.3
-        })
+        // (48 segments matches GeometryTemplates.defaultSegments -> uses cached unit circle)
+        var newGeometry = RotationGeometryCalculator.circleGeometry(
+            context, axesToUse, gizmoSize, maxScreenRadius, 48, _previousRadii, 0.3
+        )
 
         geometry = newGeometry
         // Save radii for next frame smoothing
         if (newGeometry && newGeometry.radii) {
             _previousRadii = newGeometry.radii
         }
+        if (newGeometry && GizmoProfiler.enabled) {
+            var circles = newGeometry.circles
+            GizmoProfiler.count(GizmoProfiler.PointsGenerated,
+                                1 + circles.xy.length + circles.yz.length + circles.zx.length)
+        }
 
-        // Calculate all 3 facing angles with the SAME projector (was 3 separate projectors)
-        yzFacingAngle = RotationGeometryCalculator.calculateCameraFacingAngle(
-            targetNode.scenePosition, currentAxes.x, currentAxes.y, projector
-        )
-        zxFacingAngle = RotationGeometryCalculator.calculateCameraFacingAngle(
-            targetNode.scenePosition, currentAxes.y, currentAxes.z, projector
-        )
-        xyFacingAngle = RotationGeometryCalculator.calculateCameraFacingAngle(
-            targetNode.scenePosition, currentAxes.z, currentAxes.x, projector
+        // All 3 facing angles from the context's view direction
+        yzFacingAngle = RotationGeometryCalculator.facingAngle(context.toCamera, currentAxes.x, currentAxes.y)
+        zxFacingAngle = RotationGeometryCalculator.facingAngle(context.toCamera, currentAxes.y, currentAxes.z)
+        xyFacingAngle = RotationGeometryCalculator.facingAngle(context.toCamera, currentAxes.z, currentAxes.x)
+    }
+
+    /**
+     * Shifts the cached geometry to the target's current screen position
+     * (a GizmoEnums.GeometryChange.Translation frame).
+     * @param projector - Shared projector object from View3DProjectionAdapter
+     */
+    function offsetGeometry(projector: var): void {
+        if (!geometry || !targetNode) {
+            updateGeometry(projector, null)
+            return
+        }
+
+        var center = GizmoProjection.projectWorldToScreen(targetNode.scenePosition, projector)
+        geometry = RotationGeometryCalculator.offsetGeometry(
+            geometry, center.x - geometry.center.x, center.y - geometry.center.y
         )
     }
 
     // Test helper - creates a fresh projector and calculates geometry on demand
-    function calculateCircleGeometry() {
+    function calculateCircleGeometry(): var {
         if (!view3d || !view3d.camera || !targetNode) return null
         var projector = View3DProjectionAdapter.createProjector(view3d)
         if (!projector) return null
@@ -228,7 +219,7 @@ Item {
     // ========================================
 
     // Calculate the angle on a rotation plane that faces the camera (uses geometry calculator)
-    function calculateCameraFacingAngle(planeNormal, referenceAxis) {
+    function calculateCameraFacingAngle(planeNormal: vector3d, referenceAxis: vector3d): real {
         if (!view3d || !view3d.camera || !targetNode) return 0
         var projector = View3DProjectionAdapter.createProjector(view3d)
         if (!projector) return 0
@@ -308,7 +299,8 @@ Item {
     // ========================================
 
     // Helper function to check if a hit point is within the visible arc range
-    function isHitWithinArcRange(mouseX, mouseY, planeNormal, referenceAxis, facingAngle) {
+    function isHitWithinArcRange(mouseX: real, mouseY: real, planeNormal: vector3d,
+                                 referenceAxis: vector3d, facingAngle: real): bool {
         // Get ray from mouse position
         var ray = GizmoMath.getCameraRay(view3d, Qt.point(mouseX, mouseY))
 
@@ -331,7 +323,7 @@ Item {
 
     // Geometric hit detection using circle geometry
     // Caches geometry to avoid recalculating on press
-    function getHitAxis(x, y) {
+    function getHitAxis(x: real, y: real): int {
         lastHitTestGeometry = root.geometry
         if (!lastHitTestGeometry) {
             return GizmoEnums.Axis.None
@@ -394,7 +386,9 @@ Item {
             }
 
             // Pixel-perfect hit detection
+            var hitStart = GizmoProfiler.enabled ? GizmoProfiler.begin(GizmoProfiler.HitTest, root, GizmoEnums.Mode.Rotate) : 0
             root.activeAxis = root.getHitAxis(mouse.x, mouse.y)
+            if (hitStart) GizmoProfiler.end(GizmoProfiler.HitTest, hitStart)
 
             if (root.activeAxis !== GizmoEnums.Axis.None) {
                 // Start drag - cache projector
@@ -443,6 +437,8 @@ Item {
             }
 
             mouse.accepted = true
+            if (GizmoLatency.enabled) GizmoLatency.markInput(root.Window.window)
+            var profile = GizmoProfiler.enabled ? GizmoProfiler.begin(GizmoProfiler.DragSolve, root, GizmoEnums.Mode.Rotate) : 0
 
             // Get current mouse position in 3D
             var ray = GizmoMath.getCameraRay(root.view3d, Qt.point(mouse.x, mouse.y))
@@ -450,6 +446,7 @@ Item {
 
             if (!intersection) {
                 console.warn("RotationGizmo: Ray-plane intersection failed (ray parallel to plane)")
+                if (profile) GizmoProfiler.end(GizmoProfiler.DragSolve, profile)
                 return
             }
 
@@ -481,7 +478,13 @@ Item {
             }
 
             // Emit delta signal with transform mode
+            if (profile) {
+                GizmoProfiler.end(GizmoProfiler.DragSolve, profile)
+                profile = GizmoProfiler.begin(GizmoProfiler.SignalEmit, root, GizmoEnums.Mode.Rotate)
+            }
+            if (GizmoLatency.enabled) GizmoLatency.mark(GizmoLatency.Delta)
             root.rotationDelta(root.activeAxis, root.transformMode, snappedDeltaDegrees, root.snapEnabled)
+            if (profile) GizmoProfiler.end(GizmoProfiler.SignalEmit, profile)
             // Note: updateGeometry() removed - geometry is cached at drag start,
             // visual feedback (wedge fill) is driven by currentAngle property binding
         }
@@ -507,7 +510,7 @@ Item {
     }
 
     // Legacy API compatibility - no-op since geometry is now reactive
-    function repaintGizmo() {
+    function repaintGizmo(): void {
         // Geometry updates automatically via property bindings
     }
 }
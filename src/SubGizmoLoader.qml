@@ -0,0 +1,54 @@
+import QtQuick
+
+/**
+ * SubGizmoLoader - Creates one of GlobalGizmo's child gizmos on first use
+ *
+ * The child is instantiated the first time its mode shows it (or up front with
+ * preload). Once hidden by a mode switch it is kept, or destroyed after
+ * releaseDelay ms when releaseDelay is 0 or more. A child in the middle of a
+ * drag is never released.
+ */
+Loader {
+    id: loader
+
+    // Whether the current mode shows this child gizmo
+    property bool shown: false
+
+    // Create the child immediately instead of on first use
+    property bool preload: false
+
+    // Idle time in ms before a hidden child is destroyed; -1 keeps it
+    property int releaseDelay: -1
+
+    active: false
+
+    onShownChanged: _sync()
+    onPreloadChanged: _sync()
+    onReleaseDelayChanged: _sync()
+    Component.onCompleted: _sync()
+
+    function _sync(): void {
+        if (shown || preload) {
+            releaseTimer.stop()
+            active = true
+        } else if (active && releaseDelay >= 0) {
+            releaseTimer.restart()
+        } else {
+            releaseTimer.stop()
+        }
+    }
+
+    Timer {
+        id: releaseTimer
+        interval: Math.max(0, loader.releaseDelay)
+
+        onTriggered: {
+            if (loader.shown || loader.preload) return
+            if (loader.item && loader.item.isActive) {
+                restart()
+                return
+            }
+            loader.active = false
+        }
+    }
+}
@@ -31,7 +31,8 @@ Item {
     property real arrowEndRatio: 1.0    // End at full length by default
 
     // Computed local/world axes based on transform mode
-    readonly property var currentAxes: {
+    // (a coordinating parent may bind its own shared axes instead)
+    property var currentAxes: {
         if (transformMode === GizmoEnums.TransformMode.Local && targetNode) {
             return GizmoMath.getLocalAxes(targetNode.sceneRotation)
         } else {
@@ -68,7 +69,7 @@ Item {
 
     // Performance optimization: drag state and caching
     property bool isDragging: false
-    property var cachedProjector: null
+    property GizmoProjector cachedProjector: null
     property var lastHitTestGeometry: null
 
     // External control flag - when true, parent manages geometry updates via FrameAnimation
@@ -78,116 +79,98 @@ Item {
     property var geometry: null
 
     // Dirty-checking state for performance optimization (standalone mode only)
-    property vector3d _lastCameraPos: Qt.vector3d(0, 0, 0)
-    property quaternion _lastCameraRot: Qt.quaternion(1, 0, 0, 0)
-    property vector3d _lastTargetPos: Qt.vector3d(0, 0, 0)
-    property quaternion _lastTargetRot: Qt.quaternion(1, 0, 0, 0)
-    property int _lastTransformMode: -1
-
-    // Check if camera or target transforms have changed since last frame
-    function _transformsChanged() {
-        if (!view3d || !view3d.camera || !targetNode) return true
-
-        var cam = view3d.camera
-        var epsilon = 0.0001
-
-        // Check camera position
-        var camPos = cam.scenePosition
-        if (Math.abs(camPos.x - _lastCameraPos.x) > epsilon ||
-            Math.abs(camPos.y - _lastCameraPos.y) > epsilon ||
-            Math.abs(camPos.z - _lastCameraPos.z) > epsilon) {
-            return true
-        }
-
-        // Check camera rotation
-        var camRot = cam.sceneRotation
-        if (Math.abs(camRot.x - _lastCameraRot.x) > epsilon ||
-            Math.abs(camRot.y - _lastCameraRot.y) > epsilon ||
-            Math.abs(camRot.z - _lastCameraRot.z) > epsilon ||
-            Math.abs(camRot.scalar - _lastCameraRot.scalar) > epsilon) {
-            return true
-        }
-
-        // Check target position
-        var targetPos = targetNode.scenePosition
-        if (Math.abs(targetPos.x - _lastTargetPos.x) > epsilon ||
-            Math.abs(targetPos.y - _lastTargetPos.y) > epsilon ||
-            Math.abs(targetPos.z - _lastTargetPos.z) > epsilon) {
-            return true
-        }
-
-        // Check target rotation (matters for local transform mode)
-        var targetRot = targetNode.sceneRotation
-        if (Math.abs(targetRot.x - _lastTargetRot.x) > epsilon ||
-            Math.abs(targetRot.y - _lastTargetRot.y) > epsilon ||
-            Math.abs(targetRot.z - _lastTargetRot.z) > epsilon ||
-            Math.abs(targetRot.scalar - _lastTargetRot.scalar) > epsilon) {
-            return true
-        }
-
-        // Check transform mode change
-        if (_lastTransformMode !== transformMode) {
-            return true
-        }
-
-        return false
+    GizmoDirtyState {
+        id: dirtyState
+        view3d: root.view3d
+        target: root.targetNode
+        transformMode: root.transformMode
+        mode: GizmoEnums.Mode.Translate
+        cacheValid: root.geometry !== null
     }
 
-    // Update cached state after geometry update
-    function _updateCachedState() {
-        if (!view3d || !view3d.camera || !targetNode) return
+    visible: targetNode !== null && view3d !== null
 
-        var cam = view3d.camera
-        _lastCameraPos = cam.scenePosition
-        _lastCameraRot = cam.sceneRotation
-        _lastTargetPos = targetNode.scenePosition
-        _lastTargetRot = targetNode.sceneRotation
-        _lastTransformMode = transformMode
+    // Opt-in native geometry: computed on GizmoFrameCoordinator's worker pool together
+    // with every other gizmo's. The JS path takes over whenever the task is inactive
+    // (unsupported camera lens, no window)
+    property bool parallelGeometry: false
+    readonly property bool parallelGeometryActive: geometryTask.active
+
+    GizmoGeometryTask {
+        id: geometryTask
+        kind: GizmoGeometryTask.Arrow
+        enabled: root.parallelGeometry && root.visible
+        view3d: root.parallelGeometry ? root.view3d : null
+        targetPosition: root.targetPosition
+        axes: root.currentAxes
+        gizmoSize: root.gizmoSize
+        maxScreenSize: root.maxScreenSize
+        arrowStartRatio: root.arrowStartRatio
+        arrowEndRatio: root.arrowEndRatio
+        onGeometryChanged: {
+            root.geometry = geometryTask.geometry
+        }
     }
 
-    visible: targetNode !== null && view3d !== null
-
     // Internal FrameAnimation for standalone operation (disabled when managed by parent)
     FrameAnimation {
         id: internalAnimation
-        running: !root.managedByParent && root.visible && root.view3d && root.targetNode
+        running: !root.managedByParent && !root.parallelGeometryActive &&
+                 root.visible && root.view3d && root.targetNode
 
-        onTriggered: {
-            // Skip geometry update if nothing has changed (performance optimization)
-            if (!root._transformsChanged()) return
+        onTriggered: dirtyState.refresh(root)
+    }
 
-            var projector = View3DProjectionAdapter.createProjector(root.view3d)
-            if (projector) {
-                root.updateGeometry(projector)
-                root._updateCachedState()
-            }
-        }
+    // Latency instrumentation: the controller's write to the target during a drag
+    Connections {
+        target: root.targetNode
+        enabled: GizmoLatency.enabled && root.isActive
+
+        function onPositionChanged() { GizmoLatency.mark(GizmoLatency.Applied) }
+        function onRotationChanged() { GizmoLatency.mark(GizmoLatency.Applied) }
+        function onScaleChanged() { GizmoLatency.mark(GizmoLatency.Applied) }
     }
 
     /**
      * Updates geometry using the provided projector.
      * Called by parent coordinator (GlobalGizmo) or internal FrameAnimation.
      * @param projector - Shared projector object from View3DProjectionAdapter
+     * @param context - Optional GizmoFrameContext shared with sibling gizmos (GlobalGizmo);
+     *                  built from the projector when omitted
      */
-    function updateGeometry(projector) {
+    function updateGeometry(projector: var, context: var): void {
         if (!view3d || !view3d.camera || !targetNode) {
             geometry = null
             return
         }
 
-        geometry = TranslationGeometryCalculator.calculateArrowGeometry({
-            projector: projector,
-            targetPosition: targetNode.scenePosition,
-            axes: currentAxes,
-            gizmoSize: gizmoSize,
-            maxScreenSize: maxScreenSize,
-            arrowStartRatio: arrowStartRatio,
-            arrowEndRatio: arrowEndRatio
-        })
+        if (!context) context = GizmoFrameContext.create(projector, targetNode.scenePosition, currentAxes)
+        geometry = context
+            ? TranslationGeometryCalculator.arrowGeometry(context, gizmoSize, maxScreenSize, arrowStartRatio, arrowEndRatio)
+            : null
+        // Screen points per geometry: center, 6 arrow endpoints and 12 plane corners
+        if (geometry && GizmoProfiler.enabled) GizmoProfiler.count(GizmoProfiler.PointsGenerated, 19)
+    }
+
+    /**
+     * Shifts the cached geometry to the target's current screen position
+     * (a GizmoEnums.GeometryChange.Translation frame).
+     * @param projector - Shared projector object from View3DProjectionAdapter
+     */
+    function offsetGeometry(projector: var): void {
+        if (!geometry || !targetNode) {
+            updateGeometry(projector, null)
+            return
+        }
+
+        var center = GizmoProjection.projectWorldToScreen(targetNode.scenePosition, projector)
+        geometry = TranslationGeometryCalculator.offsetGeometry(
+            geometry, center.x - geometry.center.x, center.y - geometry.center.y
+        )
     }
 
     // Test helper - creates a fresh projector and calculates geometry on demand
-    function calculateGizmoGeometry() {
+    function calculateGizmoGeometry(): var {
         if (!view3d || !view3d.camera || !targetNode) return null
         var projector = View3DProjectionAdapter.createProjector(view3d)
         if (!projector) return null
@@ -203,7 +186,7 @@ Item {
     }
 
     // Snap planar movement to grid (uses geometry calculator)
-    function snapPlaneMovement(delta, plane, startPos) {
+    function snapPlaneMovement(delta: vector3d, plane: int, startPos: vector3d): vector3d {
         return TranslationGeometryCalculator.snapPlaneMovement(
             delta, plane, startPos, snapIncrement, snapToAbsolute
         )
@@ -274,8 +257,10 @@ Item {
 
     // Geometric hit detection using screen-space geometry (uses HitTester)
     // Caches geometry to avoid recalculating on press
-    function getHitRegion(x, y) {
+    function getHitRegion(x: real, y: real): var {
         lastHitTestGeometry = root.geometry
+        // Native path: tests the same result buffer the renderers are drawing
+        if (parallelGeometryActive) return geometryTask.hitTest(x, y, 10)
         return HitTester.testTranslationGizmoHit(Qt.point(x, y), lastHitTestGeometry, 10)
     }
 
@@ -299,7 +284,9 @@ Item {
             }
 
             // Pixel-perfect hit detection using color picking
+            var hitStart = GizmoProfiler.enabled ? GizmoProfiler.begin(GizmoProfiler.HitTest, root, GizmoEnums.Mode.Translate) : 0
             var hitInfo = root.getHitRegion(mouse.x, mouse.y)
+            if (hitStart) GizmoProfiler.end(GizmoProfiler.HitTest, hitStart)
 
             if (hitInfo.type === "axis") {
                 root.activeAxis = hitInfo.axis
@@ -371,6 +358,8 @@ Item {
             }
 
             mouse.accepted = true
+            if (GizmoLatency.enabled) GizmoLatency.markInput(root.Window.window)
+            var profile = GizmoProfiler.enabled ? GizmoProfiler.begin(GizmoProfiler.DragSolve, root, GizmoEnums.Mode.Translate) : 0
 
             if (root.activePlane !== GizmoEnums.Plane.None) {
                 // Plane drag logic
@@ -416,7 +405,16 @@ Item {
                     }
 
                     // Emit delta signal with transform mode
+                    if (profile) {
+                        GizmoProfiler.end(GizmoProfiler.DragSolve, profile)
+                        profile = GizmoProfiler.begin(GizmoProfiler.SignalEmit, root, GizmoEnums.Mode.Translate)
+                    }
+                    if (GizmoLatency.enabled) GizmoLatency.mark(GizmoLatency.Delta)
                     root.planeTranslationDelta(root.activePlane, root.transformMode, delta, root.snapEnabled)
+                    if (profile) GizmoProfiler.end(GizmoProfiler.SignalEmit, profile)
+                } else if (profile) {
+                    // Ray parallel to the plane: nothing to emit
+                    GizmoProfiler.end(GizmoProfiler.DragSolve, profile)
                 }
             } else if (root.activeAxis !== GizmoEnums.Axis.None) {
                 // Axis drag logic
@@ -455,7 +453,13 @@ Item {
                 }
 
                 // Emit delta signal with transform mode
+                if (profile) {
+                    GizmoProfiler.end(GizmoProfiler.DragSolve, profile)
+                    profile = GizmoProfiler.begin(GizmoProfiler.SignalEmit, root, GizmoEnums.Mode.Translate)
+                }
+                if (GizmoLatency.enabled) GizmoLatency.mark(GizmoLatency.Delta)
                 root.axisTranslationDelta(root.activeAxis, root.transformMode, deltaT, root.snapEnabled)
+                if (profile) GizmoProfiler.end(GizmoProfiler.SignalEmit, profile)
             }
             // Note: updateGeometry() removed - geometry is cached at drag start,
             // only visual feedback (colors) changes during drag via property bindings
@@ -484,7 +488,7 @@ Item {
     }
 
     // Legacy API compatibility - no-op since geometry is now reactive
-    function repaintGizmo() {
+    function repaintGizmo(): void {
         // Geometry updates automatically via property bindings
     }
 }
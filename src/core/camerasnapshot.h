@@ -0,0 +1,80 @@
+#ifndef GIZMO3D_CORE_CAMERASNAPSHOT_H
+#define GIZMO3D_CORE_CAMERASNAPSHOT_H
+
+#include "vecmath.h"
+
+#include <cstring>
+
+namespace gizmo3d::core {
+
+/**
+ * Immutable per-frame copy of everything needed to project into one view
+ *
+ * Captured once per view on the GUI thread, then shared read-only by every geometry
+ * job for that view, so worker threads never touch QObjects.
+ */
+struct CameraSnapshot
+{
+    Mat4 viewProjection;
+    Vec3 position;
+    Vec3 forward{0.0f, 0.0f, -1.0f};
+    float viewportWidth = 0.0f;
+    float viewportHeight = 0.0f;
+    float clipNear = 0.0f;
+    bool orthographic = false;
+
+    /**
+     * Builds a snapshot from plain matrices, for callers without a View3D
+     * (GizmoProjector::captureSnapshot does the same from a view's camera)
+     * @param cameraTransform - Camera scene transform; the camera looks down local -Z
+     * @param projection - Lens projection (perspective or orthographic)
+     * @returns false when cameraTransform is singular or the viewport is empty
+     */
+    static bool fromMatrices(const Mat4 &cameraTransform, const Mat4 &projection,
+                             float viewportWidth, float viewportHeight, float clipNear,
+                             bool orthographic, CameraSnapshot *snapshot)
+    {
+        Mat4 view;
+        if (viewportWidth <= 0.0f || viewportHeight <= 0.0f || !invert(cameraTransform, &view))
+            return false;
+
+        snapshot->viewProjection = projection * view;
+        snapshot->position = cameraTransform.column3(3);
+        snapshot->forward = normalized(-cameraTransform.column3(2));
+        snapshot->viewportWidth = viewportWidth;
+        snapshot->viewportHeight = viewportHeight;
+        snapshot->clipNear = clipNear;
+        snapshot->orthographic = orthographic;
+        return true;
+    }
+
+    /**
+     * Projects a world position to view coordinates
+     * @returns (x, y) in view pixels and z = distance in front of the near clip plane,
+     *          matching View3D.mapFrom3DScene(); zero vector when degenerate
+     */
+    Vec3 project(Vec3 world) const
+    {
+        const Vec4 clip = viewProjection.map(world);
+        if (std::fabs(clip.w) < 1e-12f)
+            return {};
+
+        const float invW = 1.0f / clip.w;
+        return {(clip.x * invW + 1.0f) * 0.5f * viewportWidth,
+                (1.0f - clip.y * invW) * 0.5f * viewportHeight,
+                dot(world - position, forward) - clipNear};
+    }
+
+    bool operator==(const CameraSnapshot &other) const
+    {
+        return std::memcmp(viewProjection.m, other.viewProjection.m, sizeof(viewProjection.m)) == 0
+            && viewportWidth == other.viewportWidth
+            && viewportHeight == other.viewportHeight
+            && orthographic == other.orthographic;
+    }
+    bool operator!=(const CameraSnapshot &other) const { return !(*this == other); }
+};
+
+} // namespace gizmo3d::core
+
+#endif // GIZMO3D_CORE_CAMERASNAPSHOT_H
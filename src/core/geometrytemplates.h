@@ -0,0 +1,132 @@
+#ifndef GIZMO3D_CORE_GEOMETRYTEMPLATES_H
+#define GIZMO3D_CORE_GEOMETRYTEMPLATES_H
+
+#include "vecmath.h"
+
+#include <array>
+#include <span>
+
+// Compile-time shape templates: unit circles for a fixed set of segment counts, the
+// arrowhead rotation and the square-handle corners. Everything is generated by the
+// compiler, so drawing a gizmo does no trigonometry and builds no table at startup.
+
+namespace gizmo3d::core {
+
+struct UnitCirclePoint
+{
+    float cos = 0.0f;
+    float sin = 0.0f;
+};
+
+namespace templates_detail {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// std::sin is not constexpr in C++20: Taylor series after reduction to [-π, π]
+constexpr double sin(double x)
+{
+    while (x > kPi)
+        x -= 2.0 * kPi;
+    while (x < -kPi)
+        x += 2.0 * kPi;
+
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 30; ++n) {
+        term *= -x * x / double((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double cos(double x)
+{
+    return sin(x + kPi / 2.0);
+}
+
+// segments + 1 points: includes the closing point at angle 2π
+template <int Segments>
+constexpr std::array<UnitCirclePoint, Segments + 1> makeUnitCircle()
+{
+    std::array<UnitCirclePoint, Segments + 1> points{};
+    for (int i = 0; i <= Segments; ++i) {
+        const double angle = double(i) / double(Segments) * 2.0 * kPi;
+        points[size_t(i)] = {float(cos(angle)), float(sin(angle))};
+    }
+    return points;
+}
+
+template <int Segments>
+inline constexpr std::array<UnitCirclePoint, Segments + 1> kUnitCircle = makeUnitCircle<Segments>();
+
+} // namespace templates_detail
+
+// Segment count RotationGizmo requests
+inline constexpr int kDefaultCircleSegments = 48;
+
+// Segment counts with a precomputed unit circle
+inline constexpr std::array<int, 9> kCircleSegmentCounts{8, 12, 16, 24, 32, 48, 64, 96, 128};
+
+/**
+ * Precomputed unit circle for a segment count
+ * @returns segments + 1 {cos, sin} points, or an empty span when the count has no table
+ */
+constexpr std::span<const UnitCirclePoint> unitCircleTable(int segments)
+{
+    using namespace templates_detail;
+    switch (segments) {
+    case 8: return kUnitCircle<8>;
+    case 12: return kUnitCircle<12>;
+    case 16: return kUnitCircle<16>;
+    case 24: return kUnitCircle<24>;
+    case 32: return kUnitCircle<32>;
+    case 48: return kUnitCircle<48>;
+    case 64: return kUnitCircle<64>;
+    case 96: return kUnitCircle<96>;
+    case 128: return kUnitCircle<128>;
+    default: return {};
+    }
+}
+
+// ArrowRenderer's default headAngle (π/6) and its rotation
+inline constexpr float kArrowHeadAngle = float(templates_detail::kPi / 6.0);
+inline constexpr float kArrowHeadCos = float(templates_detail::cos(templates_detail::kPi / 6.0));
+inline constexpr float kArrowHeadSin = float(templates_detail::sin(templates_detail::kPi / 6.0));
+
+// Square handle corners for a half size of 1, in drawing order
+inline constexpr std::array<Vec2, 4> kSquareCorners{{{-1.0f, -1.0f}, {1.0f, -1.0f},
+                                                     {1.0f, 1.0f}, {-1.0f, 1.0f}}};
+
+struct ArrowHead
+{
+    Vec2 shaftEnd;  // Shaft stops half a head length before the tip
+    Vec2 left;
+    Vec2 right;
+};
+
+/**
+ * Arrowhead for an arrow from start to end. The head sides are the reversed arrow
+ * direction rotated by ±headAngle, given as its cosine and sine, so no angle is
+ * computed. A zero-length arrow points along +X, like atan2(0, 0).
+ */
+inline ArrowHead arrowHead(Vec2 start, Vec2 end, float headLength,
+                           float headCos = kArrowHeadCos, float headSin = kArrowHeadSin)
+{
+    Vec2 dir{end.x - start.x, end.y - start.y};
+    const float len = length(dir);
+    dir = len > 0.0f ? Vec2{dir.x / len, dir.y / len} : Vec2{1.0f, 0.0f};
+
+    // Direction rotated by -headAngle and +headAngle
+    const Vec2 minus{dir.x * headCos + dir.y * headSin, dir.y * headCos - dir.x * headSin};
+    const Vec2 plus{dir.x * headCos - dir.y * headSin, dir.y * headCos + dir.x * headSin};
+
+    return {
+        {end.x - dir.x * headLength * 0.5f, end.y - dir.y * headLength * 0.5f},
+        {end.x - minus.x * headLength, end.y - minus.y * headLength},
+        {end.x - plus.x * headLength, end.y - plus.y * headLength},
+    };
+}
+
+} // namespace gizmo3d::core
+
+#endif // GIZMO3D_CORE_GEOMETRYTEMPLATES_H
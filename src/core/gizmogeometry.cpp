@@ -0,0 +1,218 @@
+#include "gizmogeometry.h"
+
+#include "geometrytemplates.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace gizmo3d::core {
+
+namespace {
+
+constexpr float kTwoPi = 6.28318530717958647692f;
+
+// Fallback for segment counts without a compile-time table (geometrytemplates.h)
+std::vector<UnitCirclePoint> makeUnitCircle(int segments)
+{
+    // segments + 1 points: includes the closing point at angle 2π
+    std::vector<UnitCirclePoint> points(size_t(segments) + 1);
+    for (int i = 0; i <= segments; ++i) {
+        const float angle = float(i) / float(segments) * kTwoPi;
+        points[size_t(i)] = {std::cos(angle), std::sin(angle)};
+    }
+    return points;
+}
+
+// Screen-space axis directions scaled to gizmoSize and clamped to maxScreenSize
+struct ScreenAxes
+{
+    Vec3 center;
+    std::array<Vec2, 3> dir;
+    std::array<float, 3> projectedLength{};
+    float clampScale = 1.0f;
+};
+
+ScreenAxes projectAxes(const CameraSnapshot &camera, const ArrowParams &params)
+{
+    ScreenAxes s;
+    s.center = camera.project(params.targetPosition);
+
+    const Vec3 axes[3] = {params.axes.x, params.axes.y, params.axes.z};
+    float maxDist = 0.0f;
+    for (int i = 0; i < 3; ++i) {
+        const Vec3 end = camera.project(params.targetPosition + axes[i]);
+        Vec2 d{end.x - s.center.x, end.y - s.center.y};
+        const float len = length(d);
+        if (len > 0.0f)
+            d = {d.x / len * params.gizmoSize, d.y / len * params.gizmoSize};
+        s.dir[size_t(i)] = d;
+        s.projectedLength[size_t(i)] = len;
+        maxDist = std::max(maxDist, length(d));
+    }
+
+    // Screen-space clamping prevents oversized handles
+    if (maxDist > params.maxScreenSize) {
+        s.clampScale = params.maxScreenSize / maxDist;
+        for (Vec2 &d : s.dir)
+            d = {d.x * s.clampScale, d.y * s.clampScale};
+    }
+    return s;
+}
+
+void fillHandles(const ScreenAxes &s, const ArrowParams &params, HandleGeometry &out)
+{
+    out.center = s.center;
+    for (size_t i = 0; i < 3; ++i) {
+        const Vec2 d = s.dir[i];
+        out.start[i] = {s.center.x + d.x * params.arrowStartRatio,
+                        s.center.y + d.y * params.arrowStartRatio};
+        out.end[i] = {s.center.x + d.x * params.arrowEndRatio,
+                      s.center.y + d.y * params.arrowEndRatio};
+    }
+}
+
+void planeCorners(const CameraSnapshot &camera, Vec3 center, Vec3 axis1, Vec3 axis2,
+                  float size, std::array<Vec3, 4> &out)
+{
+    const Vec3 a = axis1 * (size / 2.0f);
+    const Vec3 b = axis2 * (size / 2.0f);
+    out[0] = camera.project(center + a + b);
+    out[1] = camera.project(center - a + b);
+    out[2] = camera.project(center - a - b);
+    out[3] = camera.project(center + a - b);
+}
+
+float projectedAxisLength(const CameraSnapshot &camera, Vec3 target, Vec3 axis, Vec3 centerScreen)
+{
+    const Vec3 p = camera.project(target + axis);
+    return length(Vec2{p.x - centerScreen.x, p.y - centerScreen.y});
+}
+
+// swapSinCos: ZX plane parametrization puts sin on the first axis (matches RotationGizmo)
+void circlePoints(const CameraSnapshot &camera, Vec3 center, Vec3 axis1, Vec3 axis2,
+                  float radius, std::span<const UnitCirclePoint> unitCircle,
+                  bool swapSinCos, std::vector<Vec2> &out)
+{
+    out.resize(unitCircle.size());
+    for (size_t i = 0; i < unitCircle.size(); ++i) {
+        const float a = (swapSinCos ? unitCircle[i].sin : unitCircle[i].cos) * radius;
+        const float b = (swapSinCos ? unitCircle[i].cos : unitCircle[i].sin) * radius;
+        const Vec3 screen = camera.project(center + axis1 * a + axis2 * b);
+        out[i] = {screen.x, screen.y};
+    }
+}
+
+} // namespace
+
+void computeHandleGeometry(const CameraSnapshot &camera, const ArrowParams &params,
+                           HandleGeometry &out)
+{
+    fillHandles(projectAxes(camera, params), params, out);
+}
+
+void computeArrowGeometry(const CameraSnapshot &camera, const ArrowParams &params,
+                          ArrowGeometry &out)
+{
+    const ScreenAxes s = projectAxes(camera, params);
+    fillHandles(s, params, out);
+
+    // World-space scale factor for the plane handles
+    const float avgLen = (s.projectedLength[0] + s.projectedLength[1] + s.projectedLength[2]) / 3.0f;
+    const float worldScale = (avgLen > 0.0f ? params.gizmoSize / avgLen : 1.0f) * s.clampScale;
+    const float planeOffset = worldScale * 0.4f;
+    const float planeSize = worldScale * 0.3f;
+
+    const Vec3 target = params.targetPosition;
+    const Axes &axes = params.axes;
+    planeCorners(camera, target + axes.x * planeOffset + axes.y * planeOffset,
+                 axes.x, axes.y, planeSize, out.planes[PlaneXY]);
+    planeCorners(camera, target + axes.x * planeOffset + axes.z * planeOffset,
+                 axes.x, axes.z, planeSize, out.planes[PlaneXZ]);
+    planeCorners(camera, target + axes.y * planeOffset + axes.z * planeOffset,
+                 axes.y, axes.z, planeSize, out.planes[PlaneYZ]);
+}
+
+void computeCircleGeometry(const CameraSnapshot &camera, const CircleParams &params,
+                           CircleGeometry &out)
+{
+    const Vec3 target = params.targetPosition;
+    const Vec3 center = camera.project(target);
+    out.center = center;
+
+    // Per-plane scales from the world axes that define each plane
+    const float xScale = projectedAxisLength(camera, target, {1.0f, 0.0f, 0.0f}, center);
+    const float yScale = projectedAxisLength(camera, target, {0.0f, 1.0f, 0.0f}, center);
+    const float zScale = projectedAxisLength(camera, target, {0.0f, 0.0f, 1.0f}, center);
+    const float planeScale[3] = {(xScale + yScale) / 2.0f,   // xy
+                                 (yScale + zScale) / 2.0f,   // yz
+                                 (zScale + xScale) / 2.0f};  // zx
+
+    for (size_t p = 0; p < 3; ++p) {
+        const float raw = planeScale[p] > 0.0f ? params.gizmoSize / planeScale[p] : 1.0f;
+        // Temporal smoothing eliminates jitter during camera movement
+        out.radii[p] = params.hasPreviousRadii
+            ? params.previousRadii[p] + (raw - params.previousRadii[p]) * params.smoothingFactor
+            : raw;
+    }
+
+    std::span<const UnitCirclePoint> unitCircle = unitCircleTable(params.segments);
+    std::vector<UnitCirclePoint> customCircle;
+    if (unitCircle.empty()) {
+        customCircle = makeUnitCircle(std::max(params.segments, 3));
+        unitCircle = customCircle;
+    }
+
+    const Axes &axes = params.axes;
+    circlePoints(camera, target, axes.x, axes.y, out.radii[CircleXY], unitCircle, false,
+                 out.circles[CircleXY]);
+    circlePoints(camera, target, axes.y, axes.z, out.radii[CircleYZ], unitCircle, false,
+                 out.circles[CircleYZ]);
+    circlePoints(camera, target, axes.x, axes.z, out.radii[CircleZX], unitCircle, true,
+                 out.circles[CircleZX]);
+
+    // Per-plane screen-space clamping as safety limit
+    for (size_t p = 0; p < 3; ++p) {
+        std::vector<Vec2> &points = out.circles[p];
+        float maxDist = 0.0f;
+        for (const Vec2 &pt : points)
+            maxDist = std::max(maxDist, length(Vec2{pt.x - center.x, pt.y - center.y}));
+
+        if (maxDist > params.maxScreenRadius) {
+            const float clampScale = params.maxScreenRadius / maxDist;
+            for (Vec2 &pt : points)
+                pt = {center.x + (pt.x - center.x) * clampScale,
+                      center.y + (pt.y - center.y) * clampScale};
+            out.radii[p] *= clampScale;
+        }
+    }
+
+    const Axes &facing = params.facingAxes;
+    out.facingAngles[0] = cameraFacingAngle(camera, target, facing.x, facing.y);  // yz
+    out.facingAngles[1] = cameraFacingAngle(camera, target, facing.y, facing.z);  // zx
+    out.facingAngles[2] = cameraFacingAngle(camera, target, facing.z, facing.x);  // xy
+}
+
+float cameraFacingAngle(const CameraSnapshot &camera, Vec3 targetPosition,
+                        Vec3 planeNormal, Vec3 referenceAxis)
+{
+    // An orthographic camera views everything along the same direction
+    const Vec3 targetToCamera = camera.orthographic ? -camera.forward
+                                                    : camera.position - targetPosition;
+
+    // Project onto the rotation plane by removing the normal component
+    Vec3 projected = targetToCamera - planeNormal * dot(targetToCamera, planeNormal);
+    const float len = length(projected);
+    if (len < 0.001f)
+        return 0.0f;  // Camera aligned with plane normal
+    projected = projected * (1.0f / len);
+
+    const Vec3 perpAxis = cross(planeNormal, referenceAxis);
+    float angle = std::atan2(dot(projected, perpAxis), dot(projected, referenceAxis));
+    if (angle < 0.0f)
+        angle += kTwoPi;
+    if (angle >= kTwoPi)
+        angle -= kTwoPi;
+    return angle;
+}
+
+} // namespace gizmo3d::core
@@ -0,0 +1,84 @@
+#ifndef GIZMO3D_CORE_GIZMOGEOMETRY_H
+#define GIZMO3D_CORE_GIZMOGEOMETRY_H
+
+#include "camerasnapshot.h"
+#include "vecmath.h"
+
+#include <array>
+#include <vector>
+
+// Native ports of the QML geometry calculators (TranslationGeometryCalculator,
+// ScaleGeometryCalculator, RotationGeometryCalculator). They produce the same
+// screen-space geometry from a CameraSnapshot, are pure and thread-safe, and reuse
+// the output's storage so steady-state frames do not allocate.
+
+namespace gizmo3d::core {
+
+enum AxisIndex { AxisX = 0, AxisY = 1, AxisZ = 2 };
+enum ArrowPlaneIndex { PlaneXY = 0, PlaneXZ = 1, PlaneYZ = 2 };
+enum CirclePlaneIndex { CircleXY = 0, CircleYZ = 1, CircleZX = 2 };
+
+// Inputs shared by translation arrows and scale handles
+struct ArrowParams
+{
+    Vec3 targetPosition;
+    Axes axes;
+    float gizmoSize = 100.0f;
+    float maxScreenSize = 150.0f;
+    float arrowStartRatio = 0.0f;
+    float arrowEndRatio = 1.0f;
+};
+
+// Scale handles: center plus one start/end pair per axis (indexed by AxisIndex)
+struct HandleGeometry
+{
+    Vec3 center;
+    std::array<Vec2, 3> start;
+    std::array<Vec2, 3> end;
+};
+
+// Translation arrows: handles plus plane quads (indexed by ArrowPlaneIndex)
+struct ArrowGeometry : HandleGeometry
+{
+    std::array<std::array<Vec3, 4>, 3> planes;
+};
+
+struct CircleParams
+{
+    Vec3 targetPosition;
+    Axes axes;        // Circle axes (drag-start axes while rotating)
+    Axes facingAxes;  // Axes for the camera-facing angles
+    float gizmoSize = 80.0f;
+    float maxScreenRadius = 100.0f;
+    int segments = 48;
+    bool hasPreviousRadii = false;
+    std::array<float, 3> previousRadii{};
+    float smoothingFactor = 0.3f;
+};
+
+// Rotation circles (indexed by CirclePlaneIndex) and facing angles (yz, zx, xy)
+struct CircleGeometry
+{
+    Vec3 center;
+    std::array<std::vector<Vec2>, 3> circles;
+    std::array<float, 3> radii{};
+    std::array<float, 3> facingAngles{};
+};
+
+void computeHandleGeometry(const CameraSnapshot &camera, const ArrowParams &params,
+                           HandleGeometry &out);
+void computeArrowGeometry(const CameraSnapshot &camera, const ArrowParams &params,
+                          ArrowGeometry &out);
+void computeCircleGeometry(const CameraSnapshot &camera, const CircleParams &params,
+                           CircleGeometry &out);
+
+/**
+ * Angle on a rotation plane that faces the camera (RotationGeometryCalculator)
+ * @returns angle in radians in [0, 2π)
+ */
+float cameraFacingAngle(const CameraSnapshot &camera, Vec3 targetPosition,
+                        Vec3 planeNormal, Vec3 referenceAxis);
+
+} // namespace gizmo3d::core
+
+#endif // GIZMO3D_CORE_GIZMOGEOMETRY_H
@@ -0,0 +1,22 @@
+#ifndef GIZMO3D_CORE_GIZMOIDS_H
+#define GIZMO3D_CORE_GIZMOIDS_H
+
+// Handle identifiers shared with GizmoEnums (Axis and Plane), so native results can
+// be handed to QML unchanged.
+
+namespace gizmo3d::core {
+
+inline constexpr int kAxisNone = 0;
+inline constexpr int kAxisX = 1;
+inline constexpr int kAxisY = 2;
+inline constexpr int kAxisZ = 3;
+inline constexpr int kAxisUniform = 4;
+
+inline constexpr int kPlaneNone = 0;
+inline constexpr int kPlaneXY = 1;
+inline constexpr int kPlaneXZ = 2;
+inline constexpr int kPlaneYZ = 3;
+
+} // namespace gizmo3d::core
+
+#endif // GIZMO3D_CORE_GIZMOIDS_H
@@ -0,0 +1,110 @@
+#include "hittest.h"
+
+#include "gizmoids.h"
+
+#include <cmath>
+#include <limits>
+
+namespace gizmo3d::core {
+
+namespace {
+
+HitResult closestAxis(const HandleGeometry &geometry, Vec2 point, float threshold)
+{
+    constexpr int axisIds[3] = {kAxisX, kAxisY, kAxisZ};
+
+    HitResult result;
+    float closest = std::numeric_limits<float>::infinity();
+    for (size_t i = 0; i < 3; ++i) {
+        const float distance = distanceToSegment(point, geometry.start[i], geometry.end[i]);
+        if (distance <= threshold && distance < closest) {
+            closest = distance;
+            result = {HitType::Axis, axisIds[i], 0, distance};
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+float distanceToSegment(Vec2 point, Vec2 start, Vec2 end)
+{
+    const float dx = end.x - start.x;
+    const float dy = end.y - start.y;
+    const float lengthSquared = dx * dx + dy * dy;
+
+    // Degenerate case: segment is a point
+    if (lengthSquared < 0.0001f)
+        return length(Vec2{point.x - start.x, point.y - start.y});
+
+    float t = ((point.x - start.x) * dx + (point.y - start.y) * dy) / lengthSquared;
+    t = std::fmax(0.0f, std::fmin(1.0f, t));
+    return length(Vec2{point.x - (start.x + t * dx), point.y - (start.y + t * dy)});
+}
+
+float distanceToPolyline(Vec2 point, const std::vector<Vec2> &points)
+{
+    float minDistance = std::numeric_limits<float>::infinity();
+    for (size_t i = 0; i + 1 < points.size(); ++i)
+        minDistance = std::fmin(minDistance, distanceToSegment(point, points[i], points[i + 1]));
+    return minDistance;
+}
+
+bool pointInQuad(Vec2 point, const std::array<Vec3, 4> &corners)
+{
+    // Ray-crossing algorithm: odd number of edge crossings = inside
+    int crossings = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        const Vec3 &a = corners[i];
+        const Vec3 &b = corners[(i + 1) % 4];
+        if (((a.y <= point.y && point.y < b.y) || (b.y <= point.y && point.y < a.y))
+            && point.x < (b.x - a.x) * (point.y - a.y) / (b.y - a.y) + a.x)
+            ++crossings;
+    }
+    return crossings % 2 == 1;
+}
+
+HitResult hitTestArrows(const ArrowGeometry &geometry, Vec2 point, float axisThreshold)
+{
+    const HitResult axisHit = closestAxis(geometry, point, axisThreshold);
+    if (axisHit.type != HitType::None)
+        return axisHit;
+
+    constexpr int planeIds[3] = {kPlaneXY, kPlaneXZ, kPlaneYZ};  // ArrowPlaneIndex order
+    for (size_t i = 0; i < 3; ++i) {
+        if (pointInQuad(point, geometry.planes[i]))
+            return {HitType::Plane, 0, planeIds[i], 0.0f};
+    }
+    return {};
+}
+
+HitResult hitTestHandles(const HandleGeometry &geometry, Vec2 point, float axisThreshold,
+                         float centerThreshold)
+{
+    const float centerDistance = length(Vec2{point.x - geometry.center.x, point.y - geometry.center.y});
+    if (centerDistance <= centerThreshold)
+        return {HitType::Center, kAxisUniform, 0, centerDistance};
+
+    return closestAxis(geometry, point, axisThreshold);
+}
+
+HitResult hitTestCircles(const CircleGeometry &geometry, Vec2 point, float circleThreshold)
+{
+    // Rotation axis of each circle, in CirclePlaneIndex order (xy, yz, zx)
+    constexpr int axisIds[3] = {kAxisZ, kAxisX, kAxisY};
+
+    HitResult result;
+    float closest = std::numeric_limits<float>::infinity();
+    for (size_t i = 0; i < 3; ++i) {
+        if (geometry.circles[i].size() < 2)
+            continue;
+        const float distance = distanceToPolyline(point, geometry.circles[i]);
+        if (distance <= circleThreshold && distance < closest) {
+            closest = distance;
+            result = {HitType::Circle, axisIds[i], 0, distance};
+        }
+    }
+    return result;
+}
+
+} // namespace gizmo3d::core
@@ -0,0 +1,46 @@
+#ifndef GIZMO3D_CORE_HITTEST_H
+#define GIZMO3D_CORE_HITTEST_H
+
+#include "gizmogeometry.h"
+#include "vecmath.h"
+
+#include <vector>
+
+// Native ports of the HitTester combined tests. Identifier values are the
+// GizmoEnums ones from gizmoids.h.
+
+namespace gizmo3d::core {
+
+enum class HitType { None, Axis, Plane, Center, Circle };
+
+struct HitResult
+{
+    HitType type = HitType::None;
+    int axis = 0;   // GizmoEnums.Axis
+    int plane = 0;  // GizmoEnums.Plane
+    float distance = 0.0f;
+};
+
+float distanceToSegment(Vec2 point, Vec2 start, Vec2 end);
+float distanceToPolyline(Vec2 point, const std::vector<Vec2> &points);
+bool pointInQuad(Vec2 point, const std::array<Vec3, 4> &corners);
+
+/**
+ * Axes first, then planes (HitTester.testTranslationGizmoHit)
+ */
+HitResult hitTestArrows(const ArrowGeometry &geometry, Vec2 point, float axisThreshold);
+
+/**
+ * Center handle first (uniform scale), then axes (HitTester.testScaleGizmoHit)
+ */
+HitResult hitTestHandles(const HandleGeometry &geometry, Vec2 point, float axisThreshold,
+                         float centerThreshold);
+
+/**
+ * Closest circle within threshold, ignoring arc ranges (HitTester.testRotationGizmoHit)
+ */
+HitResult hitTestCircles(const CircleGeometry &geometry, Vec2 point, float circleThreshold);
+
+} // namespace gizmo3d::core
+
+#endif // GIZMO3D_CORE_HITTEST_H
@@ -0,0 +1,316 @@
+#include "interaction.h"
+
+#include "gizmoids.h"
+#include "snap.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace gizmo3d::core {
+
+namespace {
+
+constexpr float kRadiansToDegrees = 57.29577951308232f;
+constexpr float kDegreesToRadians = 0.017453292519943295f;
+
+Vec3 axisDirection(const Axes &axes, int axis)
+{
+    switch (axis) {
+    case kAxisX: return axes.x;
+    case kAxisY: return axes.y;
+    case kAxisZ: return axes.z;
+    default: return {};
+    }
+}
+
+float component(Vec3 v, int axis)
+{
+    switch (axis) {
+    case kAxisX: return v.x;
+    case kAxisY: return v.y;
+    case kAxisZ: return v.z;
+    default: return 0.0f;
+    }
+}
+
+// Clamp prevents negative/zero scale
+float clampScaleFactor(float factor)
+{
+    return std::max(0.01f, factor);
+}
+
+} // namespace
+
+bool DragCamera::capture(const CameraSnapshot &camera)
+{
+    m_camera = camera;
+    return invert(camera.viewProjection, &m_inverseViewProjection);
+}
+
+Ray DragCamera::ray(Vec2 screenPos) const
+{
+    return cameraRay(m_camera, m_inverseViewProjection, screenPos);
+}
+
+// ========================================
+// Translation
+// ========================================
+
+HitResult TranslationInteraction::press(const CameraSnapshot &camera, const ArrowGeometry &geometry,
+                                        const ArrowParams &params, Vec2 point, float axisThreshold)
+{
+    const HitResult hit = hitTestArrows(geometry, point, axisThreshold);
+    return begin(camera, hit, params, point) ? hit : HitResult{};
+}
+
+bool TranslationInteraction::begin(const CameraSnapshot &camera, const HitResult &hit,
+                                   const ArrowParams &params, Vec2 point)
+{
+    m_hit = {};
+    if ((hit.type != HitType::Axis && hit.type != HitType::Plane) || !m_camera.capture(camera))
+        return false;
+
+    m_startPosition = params.targetPosition;
+    m_axes = params.axes;
+    const Ray ray = m_camera.ray(point);
+
+    if (hit.type == HitType::Axis) {
+        m_axisDir = axisDirection(m_axes, hit.axis);
+        m_initialT = closestPointOnAxisToRay(ray, m_startPosition, m_axisDir);
+    } else {
+        // Plane normal is the remaining axis
+        m_planeNormal = hit.plane == kPlaneXY ? m_axes.z
+                      : hit.plane == kPlaneXZ ? m_axes.y
+                                              : m_axes.x;
+        if (!intersectRayPlane(ray, m_startPosition, m_planeNormal, &m_startIntersection))
+            m_startIntersection = m_startPosition;
+    }
+
+    m_hit = hit;
+    return true;
+}
+
+bool TranslationInteraction::move(Vec2 point, TranslationDelta *delta) const
+{
+    if (!isActive())
+        return false;
+
+    const Ray ray = m_camera.ray(point);
+    *delta = {};
+    delta->snapped = snap.enabled;
+
+    if (m_hit.type == HitType::Axis) {
+        const float rawDelta = closestPointOnAxisToRay(ray, m_startPosition, m_axisDir) - m_initialT;
+        float distance = rawDelta;
+        if (snap.enabled) {
+            if (snap.toAbsolute) {
+                // Snap the absolute position to the world grid, then compute the delta
+                const float start = component(m_startPosition, m_hit.axis);
+                distance = snapValueAbsolute(start + rawDelta, snap.increment) - start;
+            } else {
+                distance = snapValue(rawDelta, snap.increment);
+            }
+        }
+        delta->axis = m_hit.axis;
+        delta->distance = distance;
+        return true;
+    }
+
+    Vec3 intersection;
+    if (!intersectRayPlane(ray, m_startPosition, m_planeNormal, &intersection))
+        return false;
+
+    const Vec3 worldDelta = intersection - m_startIntersection;
+    Vec3 planeDelta = worldDelta;
+    if (localMode) {
+        // Project the world delta onto the local axes of the dragged plane
+        const float dx = dot(worldDelta, m_axes.x);
+        const float dy = dot(worldDelta, m_axes.y);
+        const float dz = dot(worldDelta, m_axes.z);
+        planeDelta = m_hit.plane == kPlaneXY ? Vec3{dx, dy, 0.0f}
+                   : m_hit.plane == kPlaneXZ ? Vec3{dx, 0.0f, dz}
+                                             : Vec3{0.0f, dy, dz};
+    }
+
+    if (snap.enabled)
+        planeDelta = snapPlaneMovement(planeDelta, m_hit.plane, m_startPosition, snap.increment,
+                                       snap.toAbsolute);
+
+    delta->plane = m_hit.plane;
+    delta->planeDelta = planeDelta;
+    return true;
+}
+
+HitResult TranslationInteraction::release()
+{
+    const HitResult hit = m_hit;
+    m_hit = {};
+    return hit;
+}
+
+// ========================================
+// Rotation
+// ========================================
+
+HitResult RotationInteraction::press(const CameraSnapshot &camera, const CircleGeometry &geometry,
+                                     const CircleParams &params, Vec2 point, float circleThreshold)
+{
+    const HitResult hit = hitTestCircles(geometry, point, circleThreshold);
+    return begin(camera, hit, params, point) ? hit : HitResult{};
+}
+
+bool RotationInteraction::begin(const CameraSnapshot &camera, const HitResult &hit,
+                                const CircleParams &params, Vec2 point)
+{
+    m_hit = {};
+    if (hit.type != HitType::Circle || !m_camera.capture(camera))
+        return false;
+
+    // Reference axes align with cos(0) in the circle parametrization
+    const Axes &axes = params.axes;
+    switch (hit.axis) {
+    case kAxisX:  // YZ plane
+        m_planeNormal = axes.x;
+        m_referenceAxis = axes.y;
+        break;
+    case kAxisY:  // ZX plane
+        m_planeNormal = axes.y;
+        m_referenceAxis = axes.z;
+        break;
+    default:      // XY plane
+        m_planeNormal = axes.z;
+        m_referenceAxis = axes.x;
+        break;
+    }
+    m_center = params.targetPosition;
+
+    Vec3 intersection;
+    m_startAngle = intersectRayPlane(m_camera.ray(point), m_center, m_planeNormal, &intersection)
+        ? planeAngle(intersection, m_center, m_planeNormal, m_referenceAxis)
+        : 0.0f;
+    m_currentAngle = m_startAngle;
+
+    m_hit = hit;
+    return true;
+}
+
+bool RotationInteraction::move(Vec2 point, RotationDelta *delta)
+{
+    if (!isActive())
+        return false;
+
+    Vec3 intersection;
+    if (!intersectRayPlane(m_camera.ray(point), m_center, m_planeNormal, &intersection))
+        return false;  // Ray parallel to the rotation plane
+
+    m_currentAngle = planeAngle(intersection, m_center, m_planeNormal, m_referenceAxis);
+    const float degrees = normalizeAngleDelta(m_currentAngle - m_startAngle) * kRadiansToDegrees;
+
+    float snappedDegrees = degrees;
+    if (snap.enabled) {
+        if (snap.toAbsolute) {
+            // Snap the absolute angle, then compute the delta
+            const float startDegrees = m_startAngle * kRadiansToDegrees;
+            snappedDegrees = snapValueAbsolute(startDegrees + degrees, snap.increment) - startDegrees;
+        } else {
+            snappedDegrees = snapValue(degrees, snap.increment);
+        }
+        // Wedge feedback follows the snapped rotation
+        m_currentAngle = m_startAngle + snappedDegrees * kDegreesToRadians;
+    }
+
+    *delta = {m_hit.axis, snappedDegrees, m_currentAngle, snap.enabled};
+    return true;
+}
+
+HitResult RotationInteraction::release()
+{
+    const HitResult hit = m_hit;
+    m_hit = {};
+    m_startAngle = 0.0f;
+    m_currentAngle = 0.0f;
+    return hit;
+}
+
+// ========================================
+// Scale
+// ========================================
+
+HitResult ScaleInteraction::press(const CameraSnapshot &camera, const HandleGeometry &geometry,
+                                  const ArrowParams &params, Vec3 startScale, Vec2 point,
+                                  float axisThreshold, float centerThreshold)
+{
+    const HitResult hit = hitTestHandles(geometry, point, axisThreshold, centerThreshold);
+    return begin(camera, hit, params, startScale, point) ? hit : HitResult{};
+}
+
+bool ScaleInteraction::begin(const CameraSnapshot &camera, const HitResult &hit,
+                             const ArrowParams &params, Vec3 startScale, Vec2 point)
+{
+    m_hit = {};
+    if ((hit.type != HitType::Axis && hit.type != HitType::Center) || !m_camera.capture(camera))
+        return false;
+
+    m_startPosition = params.targetPosition;
+    m_startScale = startScale;
+    m_startPoint = point;
+
+    if (hit.type == HitType::Axis) {
+        // Screen-space axis direction and visual arrow length
+        const Vec3 center = camera.project(m_startPosition);
+        const Vec3 end = camera.project(m_startPosition + axisDirection(params.axes, hit.axis));
+        const Vec2 dir{end.x - center.x, end.y - center.y};
+        const float len = length(dir);
+        if (len > 0.0f) {
+            m_screenAxisDir = {dir.x / len, dir.y / len};
+            m_arrowScreenLength = len * params.gizmoSize * params.arrowEndRatio;
+        } else {
+            m_screenAxisDir = {1.0f, 0.0f};
+            m_arrowScreenLength = params.gizmoSize;
+        }
+    }
+
+    m_hit = hit;
+    return true;
+}
+
+bool ScaleInteraction::move(Vec2 point, ScaleDelta *delta) const
+{
+    if (!isActive())
+        return false;
+
+    float factor = 1.0f;
+    float startScale = m_startScale.x;  // Uniform: all components are equal
+    if (m_hit.type == HitType::Center) {
+        // Uniform scaling from vertical movement: 100 pixels up = 2x
+        const Vec3 center = m_camera.snapshot().project(m_startPosition);
+        factor = clampScaleFactor(1.0f + (center.y - point.y) / 100.0f);
+    } else {
+        // Project the pointer displacement onto the screen-space axis
+        const float projected = (point.x - m_startPoint.x) * m_screenAxisDir.x
+                              + (point.y - m_startPoint.y) * m_screenAxisDir.y;
+        if (m_arrowScreenLength > 0.0f)
+            factor = 1.0f + projected / m_arrowScreenLength;
+        factor = clampScaleFactor(factor);
+        startScale = component(m_startScale, m_hit.axis);
+    }
+
+    if (snap.enabled) {
+        if (snap.toAbsolute && startScale != 0.0f)
+            factor = snapValueAbsolute(startScale * factor, snap.increment) / startScale;
+        else if (!snap.toAbsolute)
+            factor = snapValue(factor, snap.increment);
+    }
+
+    *delta = {m_hit.axis, factor, snap.enabled};
+    return true;
+}
+
+HitResult ScaleInteraction::release()
+{
+    const HitResult hit = m_hit;
+    m_hit = {};
+    return hit;
+}
+
+} // namespace gizmo3d::core
@@ -0,0 +1,176 @@
+#ifndef GIZMO3D_CORE_INTERACTION_H
+#define GIZMO3D_CORE_INTERACTION_H
+
+#include "camerasnapshot.h"
+#include "gizmogeometry.h"
+#include "hittest.h"
+#include "ray.h"
+#include "vecmath.h"
+
+// Headless interaction engine: native ports of the TranslationGizmo, RotationGizmo
+// and ScaleGizmo drag handlers. Driven by a CameraSnapshot, the gizmo's screen-space
+// geometry and pointer coordinates only, so the same press/move/release sequence
+// works without a QQmlEngine or a View3D.
+//
+// Each interaction follows the MouseArea protocol: press() hit-tests and starts a
+// drag, move() reports the delta relative to the drag start, release() ends it.
+// Axis and plane identifiers are the GizmoEnums ones (gizmoids.h).
+
+namespace gizmo3d::core {
+
+struct SnapSettings
+{
+    bool enabled = false;
+    float increment = 1.0f;
+    bool toAbsolute = true;  // true = snap to the world grid, false = relative to drag start
+};
+
+/**
+ * Camera captured at drag start, like the QML handlers' cachedProjector
+ */
+class DragCamera
+{
+public:
+    bool capture(const CameraSnapshot &camera);
+    Ray ray(Vec2 screenPos) const;
+    const CameraSnapshot &snapshot() const { return m_camera; }
+
+private:
+    CameraSnapshot m_camera;
+    Mat4 m_inverseViewProjection;
+};
+
+struct TranslationDelta
+{
+    int axis = 0;            // Set for axis drags
+    int plane = 0;           // Set for plane drags
+    float distance = 0.0f;   // Axis drags: displacement along the axis
+    Vec3 planeDelta;         // Plane drags: world delta, or local components in local mode
+    bool snapped = false;
+};
+
+class TranslationInteraction
+{
+public:
+    SnapSettings snap;
+    bool localMode = false;  // GizmoEnums.TransformMode.Local
+
+    /**
+     * Hit-tests the arrows (axes first, then planes) and starts a drag on a hit
+     * @returns the grabbed handle; HitType::None leaves the interaction idle
+     */
+    HitResult press(const CameraSnapshot &camera, const ArrowGeometry &geometry,
+                    const ArrowParams &params, Vec2 point, float axisThreshold = 10.0f);
+
+    /**
+     * Starts a drag on a handle found by another hit test (e.g. GizmoGeometryTask)
+     */
+    bool begin(const CameraSnapshot &camera, const HitResult &hit, const ArrowParams &params,
+               Vec2 point);
+
+    /**
+     * @returns false when idle or when the pointer ray misses the drag plane
+     */
+    bool move(Vec2 point, TranslationDelta *delta) const;
+
+    /**
+     * Ends the drag
+     * @returns the handle that was being dragged
+     */
+    HitResult release();
+
+    bool isActive() const { return m_hit.type != HitType::None; }
+    const HitResult &activeHandle() const { return m_hit; }
+
+private:
+    HitResult m_hit;
+    DragCamera m_camera;
+    Vec3 m_startPosition;
+    Axes m_axes;
+    Vec3 m_axisDir;
+    float m_initialT = 0.0f;
+    Vec3 m_planeNormal;
+    Vec3 m_startIntersection;
+};
+
+struct RotationDelta
+{
+    int axis = 0;
+    float degrees = 0.0f;       // Rotation since drag start, snapped when enabled
+    float currentAngle = 0.0f;  // Plane angle in radians for the wedge feedback
+    bool snapped = false;
+};
+
+class RotationInteraction
+{
+public:
+    SnapSettings snap{false, 15.0f, true};  // increment in degrees
+
+    /**
+     * Hit-tests the circles and starts a drag on a hit
+     * @param params - targetPosition and axes of the circles (drag-start axes)
+     */
+    HitResult press(const CameraSnapshot &camera, const CircleGeometry &geometry,
+                    const CircleParams &params, Vec2 point, float circleThreshold = 8.0f);
+
+    bool begin(const CameraSnapshot &camera, const HitResult &hit, const CircleParams &params,
+               Vec2 point);
+    bool move(Vec2 point, RotationDelta *delta);
+    HitResult release();
+
+    bool isActive() const { return m_hit.type != HitType::None; }
+    const HitResult &activeHandle() const { return m_hit; }
+    float dragStartAngle() const { return m_startAngle; }
+    float currentAngle() const { return m_currentAngle; }
+
+private:
+    HitResult m_hit;
+    DragCamera m_camera;
+    Vec3 m_center;
+    Vec3 m_planeNormal;
+    Vec3 m_referenceAxis;
+    float m_startAngle = 0.0f;
+    float m_currentAngle = 0.0f;
+};
+
+struct ScaleDelta
+{
+    int axis = 0;          // kAxisX..kAxisZ, or kAxisUniform
+    float factor = 1.0f;   // Scale factor relative to drag start
+    bool snapped = false;
+};
+
+class ScaleInteraction
+{
+public:
+    SnapSettings snap;
+
+    /**
+     * Hit-tests the handles (center first, then axes) and starts a drag on a hit
+     * @param startScale - Target scale at drag start, for absolute snapping
+     */
+    HitResult press(const CameraSnapshot &camera, const HandleGeometry &geometry,
+                    const ArrowParams &params, Vec3 startScale, Vec2 point,
+                    float axisThreshold = 10.0f, float centerThreshold = 12.0f);
+
+    bool begin(const CameraSnapshot &camera, const HitResult &hit, const ArrowParams &params,
+               Vec3 startScale, Vec2 point);
+    bool move(Vec2 point, ScaleDelta *delta) const;
+    HitResult release();
+
+    bool isActive() const { return m_hit.type != HitType::None; }
+    const HitResult &activeHandle() const { return m_hit; }
+
+private:
+    HitResult m_hit;
+    DragCamera m_camera;
+    Vec3 m_startPosition;
+    Vec3 m_startScale{1.0f, 1.0f, 1.0f};
+    Vec2 m_startPoint;
+    Vec2 m_screenAxisDir{1.0f, 0.0f};
+    float m_arrowScreenLength = 0.0f;
+};
+
+} // namespace gizmo3d::core
+
+#endif // GIZMO3D_CORE_INTERACTION_H
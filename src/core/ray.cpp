@@ -0,0 +1,82 @@
+#include "ray.h"
+
+#include <cmath>
+
+namespace gizmo3d::core {
+
+namespace {
+
+constexpr float kPi = 3.14159265358979323846f;
+
+} // namespace
+
+Ray cameraRay(const CameraSnapshot &camera, const Mat4 &inverseViewProjection, Vec2 screenPos)
+{
+    if (camera.viewportWidth <= 0.0f || camera.viewportHeight <= 0.0f)
+        return {camera.position, camera.forward};
+
+    // Unproject onto the near plane (NDC z = -1)
+    const float ndcX = 2.0f * screenPos.x / camera.viewportWidth - 1.0f;
+    const float ndcY = 1.0f - 2.0f * screenPos.y / camera.viewportHeight;
+    const Vec4 h = inverseViewProjection.map({ndcX, ndcY, -1.0f});
+    if (std::fabs(h.w) < 1e-12f)
+        return {camera.position, camera.forward};
+    const Vec3 nearPoint{h.x / h.w, h.y / h.w, h.z / h.w};
+
+    if (camera.orthographic)
+        return {nearPoint, camera.forward};
+
+    const Vec3 direction = nearPoint - camera.position;
+    return {camera.position, length(direction) > 0.0001f ? normalized(direction) : camera.forward};
+}
+
+float closestPointOnAxisToRay(const Ray &ray, Vec3 axisOrigin, Vec3 axisDir)
+{
+    const Vec3 w = ray.origin - axisOrigin;
+    const float a = dot(ray.direction, ray.direction);
+    const float b = dot(ray.direction, axisDir);
+    const float c = dot(axisDir, axisDir);
+    const float d = dot(ray.direction, w);
+    const float e = dot(axisDir, w);
+
+    const float denom = a * c - b * b;
+
+    // Parallel: project the ray origin onto the axis
+    if (std::fabs(denom) < 0.001f)
+        return c > 0.0f ? e / c : 0.0f;
+
+    return (a * e - b * d) / denom;
+}
+
+bool intersectRayPlane(const Ray &ray, Vec3 planeOrigin, Vec3 planeNormal, Vec3 *intersection)
+{
+    const float denom = dot(ray.direction, planeNormal);
+    if (std::fabs(denom) < 0.0001f)
+        return false;
+
+    const float t = dot(planeOrigin - ray.origin, planeNormal) / denom;
+    *intersection = ray.origin + ray.direction * t;
+    return true;
+}
+
+float planeAngle(Vec3 point, Vec3 center, Vec3 planeNormal, Vec3 referenceAxis)
+{
+    const Vec3 toPoint = point - center;
+    const Vec3 projected = toPoint - planeNormal * dot(toPoint, planeNormal);
+
+    // Orthonormal basis of the plane
+    const Vec3 xAxis = normalized(referenceAxis);
+    const Vec3 yAxis = normalized(cross(planeNormal, xAxis));
+    return std::atan2(dot(projected, yAxis), dot(projected, xAxis));
+}
+
+float normalizeAngleDelta(float delta)
+{
+    while (delta > kPi)
+        delta -= 2.0f * kPi;
+    while (delta < -kPi)
+        delta += 2.0f * kPi;
+    return delta;
+}
+
+} // namespace gizmo3d::core
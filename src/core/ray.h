@@ -0,0 +1,49 @@
+#ifndef GIZMO3D_CORE_RAY_H
+#define GIZMO3D_CORE_RAY_H
+
+#include "camerasnapshot.h"
+#include "vecmath.h"
+
+// Native ports of the GizmoMath ray helpers used by the drag handlers.
+
+namespace gizmo3d::core {
+
+struct Ray
+{
+    Vec3 origin;
+    Vec3 direction{0.0f, 0.0f, -1.0f};
+};
+
+/**
+ * World-space ray through a view pixel, pointing away from the camera
+ * Perspective rays start at the camera; orthographic rays start on the near plane
+ * and run along the view direction (same convention as GizmoProjector.getCameraRay).
+ * @param inverseViewProjection - Inverse of camera.viewProjection
+ */
+Ray cameraRay(const CameraSnapshot &camera, const Mat4 &inverseViewProjection, Vec2 screenPos);
+
+/**
+ * Parameter t such that axisOrigin + t * axisDir is closest to the ray
+ */
+float closestPointOnAxisToRay(const Ray &ray, Vec3 axisOrigin, Vec3 axisDir);
+
+/**
+ * Ray-plane intersection
+ * @returns false when the ray is parallel to the plane
+ */
+bool intersectRayPlane(const Ray &ray, Vec3 planeOrigin, Vec3 planeNormal, Vec3 *intersection);
+
+/**
+ * Angle of a point around center in a plane, measured from referenceAxis
+ * @returns angle in radians in (-π, π]
+ */
+float planeAngle(Vec3 point, Vec3 center, Vec3 planeNormal, Vec3 referenceAxis);
+
+/**
+ * Wraps an angle delta into [-π, π]
+ */
+float normalizeAngleDelta(float delta);
+
+} // namespace gizmo3d::core
+
+#endif // GIZMO3D_CORE_RAY_H
@@ -0,0 +1,109 @@
+#include "selectionpivot.h"
+
+#include <algorithm>
+
+namespace gizmo3d::core {
+
+void SelectionPivot::assign(const Vec3 *positions, size_t count)
+{
+    m_positions.assign(positions, positions + count);
+    m_sum[0] = m_sum[1] = m_sum[2] = 0.0;
+    for (const Vec3 &p : m_positions) {
+        m_sum[0] += p.x;
+        m_sum[1] += p.y;
+        m_sum[2] += p.z;
+    }
+    m_boundsValid = false;
+}
+
+void SelectionPivot::clear()
+{
+    assign(nullptr, 0);
+}
+
+void SelectionPivot::move(size_t index, Vec3 position)
+{
+    const Vec3 previous = m_positions[index];
+    m_positions[index] = position;
+    m_sum[0] += double(position.x) - double(previous.x);
+    m_sum[1] += double(position.y) - double(previous.y);
+    m_sum[2] += double(position.z) - double(previous.z);
+
+    if (!m_boundsValid)
+        return;
+    // A position that defined a face may have been the only one there
+    if (onBoundary(previous)) {
+        m_boundsValid = false;
+        return;
+    }
+    m_min = {std::min(m_min.x, position.x), std::min(m_min.y, position.y), std::min(m_min.z, position.z)};
+    m_max = {std::max(m_max.x, position.x), std::max(m_max.y, position.y), std::max(m_max.z, position.z)};
+}
+
+Vec3 SelectionPivot::pivot(PivotMode mode) const
+{
+    if (m_positions.empty())
+        return {};
+    switch (mode) {
+    case PivotMode::BoundsCenter:
+        return boundsCenter();
+    case PivotMode::FirstSelected:
+        return m_positions.front();
+    case PivotMode::Centroid:
+    case PivotMode::IndividualOrigins:
+        break;
+    }
+    return centroid();
+}
+
+Vec3 SelectionPivot::centroid() const
+{
+    if (m_positions.empty())
+        return {};
+    const double n = double(m_positions.size());
+    return {float(m_sum[0] / n), float(m_sum[1] / n), float(m_sum[2] / n)};
+}
+
+Vec3 SelectionPivot::boundsCenter() const
+{
+    if (m_positions.empty())
+        return {};
+    ensureBounds();
+    return (m_min + m_max) * 0.5f;
+}
+
+Vec3 SelectionPivot::boundsMin() const
+{
+    ensureBounds();
+    return m_min;
+}
+
+Vec3 SelectionPivot::boundsMax() const
+{
+    ensureBounds();
+    return m_max;
+}
+
+void SelectionPivot::ensureBounds() const
+{
+    if (m_boundsValid)
+        return;
+    m_boundsValid = true;
+    if (m_positions.empty()) {
+        m_min = m_max = {};
+        return;
+    }
+    m_min = m_max = m_positions.front();
+    for (const Vec3 &p : m_positions) {
+        m_min = {std::min(m_min.x, p.x), std::min(m_min.y, p.y), std::min(m_min.z, p.z)};
+        m_max = {std::max(m_max.x, p.x), std::max(m_max.y, p.y), std::max(m_max.z, p.z)};
+    }
+}
+
+bool SelectionPivot::onBoundary(Vec3 p) const
+{
+    return p.x == m_min.x || p.y == m_min.y || p.z == m_min.z ||
+           p.x == m_max.x || p.y == m_max.y || p.z == m_max.z;
+}
+
+} // namespace gizmo3d::core
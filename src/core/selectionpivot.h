@@ -0,0 +1,62 @@
+#ifndef GIZMO3D_CORE_SELECTIONPIVOT_H
+#define GIZMO3D_CORE_SELECTIONPIVOT_H
+
+#include <cstddef>
+#include <vector>
+
+#include "vecmath.h"
+
+namespace gizmo3d::core {
+
+// Where a multi-selection gizmo sits (values match GizmoSelection.PivotMode)
+enum class PivotMode {
+    Centroid,          // Mean of the node origins
+    BoundsCenter,      // Center of the origins' axis-aligned bounds
+    FirstSelected,     // Origin of the first node
+    IndividualOrigins  // Drawn at the centroid; rotation and scale use each node's origin
+};
+
+/**
+ * Incrementally maintained pivot of a set of positions
+ *
+ * Moving one position is O(1): the centroid keeps a running sum, and the bounds are
+ * only widened, or marked stale when a position leaves the boundary it defined.
+ * Stale bounds are rebuilt once on the next query, so a group move of n positions
+ * costs O(n) in total rather than O(n) per position.
+ */
+class SelectionPivot
+{
+public:
+    // Replaces the set
+    void assign(const Vec3 *positions, size_t count);
+    void clear();
+
+    // Updates one position
+    void move(size_t index, Vec3 position);
+
+    size_t size() const { return m_positions.size(); }
+    bool empty() const { return m_positions.empty(); }
+    Vec3 position(size_t index) const { return m_positions[index]; }
+
+    // Origin for the mode, or the origin of space when empty
+    Vec3 pivot(PivotMode mode) const;
+    Vec3 centroid() const;
+    Vec3 boundsCenter() const;
+    Vec3 boundsMin() const;
+    Vec3 boundsMax() const;
+
+private:
+    void ensureBounds() const;
+    bool onBoundary(Vec3 position) const;
+
+    std::vector<Vec3> m_positions;
+    // Double keeps long runs of incremental updates from drifting
+    double m_sum[3] = {0.0, 0.0, 0.0};
+    mutable Vec3 m_min;
+    mutable Vec3 m_max;
+    mutable bool m_boundsValid = false;
+};
+
+} // namespace gizmo3d::core
+
+#endif // GIZMO3D_CORE_SELECTIONPIVOT_H
@@ -0,0 +1,130 @@
+#include "sessionlog.h"
+
+#include <cstring>
+
+namespace gizmo3d::core {
+
+namespace {
+
+bool supported(const SessionHeader &header)
+{
+    const SessionHeader expected;
+    return std::memcmp(header.magic, expected.magic, sizeof(header.magic)) == 0
+        && header.byteOrder == expected.byteOrder && header.version == expected.version
+        && header.recordSize == sizeof(SessionRecord);
+}
+
+} // namespace
+
+SessionWriter::~SessionWriter()
+{
+    close();
+}
+
+bool SessionWriter::open(const char *path)
+{
+    close();
+
+    std::FILE *file = std::fopen(path, "ab+");
+    if (!file)
+        return false;
+
+    // Append mode writes at the end whatever the position; reads start at 0
+    std::fseek(file, 0, SEEK_END);
+    const long size = std::ftell(file);
+    if (size <= 0) {
+        const SessionHeader header;
+        if (std::fwrite(&header, sizeof(header), 1, file) != 1 || std::fflush(file) != 0) {
+            std::fclose(file);
+            return false;
+        }
+    } else {
+        SessionHeader header;
+        std::rewind(file);
+        if (std::fread(&header, sizeof(header), 1, file) != 1 || !supported(header)) {
+            std::fclose(file);
+            return false;
+        }
+        // A record cut short by a crash would shift every later one
+        const long tail = (size - long(sizeof(SessionHeader))) % long(sizeof(SessionRecord));
+        if (tail != 0) {
+            std::fclose(file);
+            return false;
+        }
+    }
+
+    m_file = file;
+    m_buffer.reserve(kBufferRecords);
+    m_recordCount = 0;
+    return true;
+}
+
+void SessionWriter::close()
+{
+    if (!m_file)
+        return;
+    flush();
+    std::fclose(m_file);
+    m_file = nullptr;
+    m_buffer.clear();
+}
+
+void SessionWriter::append(const SessionRecord &record)
+{
+    if (!m_file)
+        return;
+    m_buffer.push_back(record);
+    ++m_recordCount;
+    if (m_buffer.size() >= kBufferRecords)
+        flush();
+}
+
+bool SessionWriter::flush()
+{
+    if (!m_file)
+        return false;
+    const size_t written = m_buffer.empty()
+            ? 0 : std::fwrite(m_buffer.data(), sizeof(SessionRecord), m_buffer.size(), m_file);
+    const bool complete = written == m_buffer.size();
+    m_buffer.clear();
+    if (std::fflush(m_file) == 0 && complete)
+        return true;
+
+    // Part of a record may have reached the file, and every record appended after it
+    // would be misaligned: stop writing, as open() refuses such a file
+    std::fclose(m_file);
+    m_file = nullptr;
+    return false;
+}
+
+bool SessionReader::open(const void *data, size_t size)
+{
+    close();
+    if (!data || size < sizeof(SessionHeader))
+        return false;
+
+    SessionHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (!supported(header))
+        return false;
+
+    m_records = static_cast<const unsigned char *>(data) + sizeof(SessionHeader);
+    m_count = (size - sizeof(SessionHeader)) / sizeof(SessionRecord);
+    return true;
+}
+
+void SessionReader::close()
+{
+    m_records = nullptr;
+    m_count = 0;
+}
+
+SessionRecord SessionReader::record(size_t index) const
+{
+    // Copied out: the mapping gives no alignment guarantee to rely on
+    SessionRecord record;
+    std::memcpy(&record, m_records + index * sizeof(SessionRecord), sizeof(record));
+    return record;
+}
+
+} // namespace gizmo3d::core
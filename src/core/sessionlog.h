@@ -0,0 +1,134 @@
+#ifndef GIZMO3D_CORE_SESSIONLOG_H
+#define GIZMO3D_CORE_SESSIONLOG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// Binary log of gizmo manipulation sessions
+//
+// A log is a 16-byte header followed by fixed-size 48-byte records, appended in time
+// order. Fixed-size records make a mapped file an array: record i sits at
+// sizeof(SessionHeader) + i * sizeof(SessionRecord). A record cut short by a crash is
+// ignored by readers; writers refuse to append after it. Values are stored in the
+// writer's byte order, which the header records; readers reject logs of the other
+// order.
+
+namespace gizmo3d::core {
+
+struct SessionHeader
+{
+    char magic[4] = {'G', '3', 'D', 'S'};
+    uint32_t byteOrder = 0x01020304;
+    uint16_t version = 1;
+    uint16_t recordSize = 48;
+    uint32_t reserved = 0;
+};
+static_assert(sizeof(SessionHeader) == 16);
+
+enum class SessionRecordType : uint8_t {
+    Begin = 1,    // A recording starts; times restart from 0
+    Started = 2,  // *Started signal
+    Delta = 3,    // *Delta signal
+    Ended = 4,    // *Ended signal
+    Camera = 5    // Camera pose of one frame, when it changed
+};
+
+// Signal group of a Started, Delta or Ended record
+enum class SessionSignal : uint8_t {
+    AxisTranslation = 0,
+    PlaneTranslation = 1,
+    Rotation = 2,
+    Scale = 3
+};
+
+enum SessionFlag : uint8_t {
+    SessionFlagLocal = 0x1,        // Delta: transformMode is Local
+    SessionFlagSnap = 0x2,         // Delta: snapActive
+    SessionFlagOrthographic = 0x4  // Camera: values[6..7] are magnifications
+};
+
+/**
+ * One log entry
+ *
+ * Started/Ended: handle is the axis (GizmoEnums.Axis) or plane (GizmoEnums.Plane).
+ * Delta: values[0] is the distance, angle in degrees or scale factor; plane
+ * translations use values[0..2].
+ * Camera: scene position in values[0..2], scene rotation x, y, z in values[3..5]
+ * (w is recovered as non-negative), then the field of view in degrees or, with
+ * SessionFlagOrthographic, the horizontal and vertical magnification.
+ */
+struct SessionRecord
+{
+    int64_t time = 0;  // Nanoseconds since the Begin record
+    SessionRecordType type = SessionRecordType::Begin;
+    SessionSignal signal = SessionSignal::AxisTranslation;
+    uint8_t handle = 0;
+    uint8_t flags = 0;
+    uint32_t reserved = 0;  // Written as 0 and not read, so no padding bytes reach the file
+    float values[8] = {};
+};
+static_assert(sizeof(SessionRecord) == 48);
+
+/**
+ * Appends records to a log file
+ *
+ * Records are buffered and written whole, by flush() or once the buffer is full, so a
+ * drag costs no system call per delta. A failed write closes the writer; later
+ * append() calls are dropped.
+ */
+class SessionWriter
+{
+public:
+    SessionWriter() = default;
+    ~SessionWriter();
+    SessionWriter(const SessionWriter &) = delete;
+    SessionWriter &operator=(const SessionWriter &) = delete;
+
+    /**
+     * Opens path for appending, writing the header if the file is new or empty
+     * @returns false when the file cannot be opened or is not a log this writer can
+     *          append to
+     */
+    bool open(const char *path);
+    void close();
+    bool isOpen() const { return m_file != nullptr; }
+
+    void append(const SessionRecord &record);
+    // @returns false, and closes the writer, when the records could not all be written
+    bool flush();
+
+    // Records appended since open()
+    size_t recordCount() const { return m_recordCount; }
+
+private:
+    static constexpr size_t kBufferRecords = 4096;
+
+    std::FILE *m_file = nullptr;
+    std::vector<SessionRecord> m_buffer;
+    size_t m_recordCount = 0;
+};
+
+/**
+ * Reads a log held in memory, typically a mapped file; the memory must outlive the
+ * reader
+ */
+class SessionReader
+{
+public:
+    // @returns false when data does not start with a supported header
+    bool open(const void *data, size_t size);
+    void close();
+
+    size_t size() const { return m_count; }
+    SessionRecord record(size_t index) const;
+
+private:
+    const unsigned char *m_records = nullptr;
+    size_t m_count = 0;
+};
+
+} // namespace gizmo3d::core
+
+#endif // GIZMO3D_CORE_SESSIONLOG_H
@@ -0,0 +1,61 @@
+#ifndef GIZMO3D_CORE_SNAP_H
+#define GIZMO3D_CORE_SNAP_H
+
+#include "gizmoids.h"
+#include "vecmath.h"
+
+#include <cmath>
+
+// Native ports of the GizmoMath snap helpers and
+// TranslationGeometryCalculator.snapPlaneMovement.
+
+namespace gizmo3d::core {
+
+/**
+ * Snaps a delta/relative value to the nearest increment (snapToAbsolute: false)
+ * Rounds halves up like JavaScript's Math.round, so both paths agree on ties.
+ */
+inline float snapValue(float value, float increment)
+{
+    if (increment <= 0.0f)
+        return value;
+    return std::floor(value / increment + 0.5f) * increment;
+}
+
+/**
+ * Snaps an absolute value to the nearest world grid position (snapToAbsolute: true)
+ */
+inline float snapValueAbsolute(float value, float increment)
+{
+    return snapValue(value, increment);
+}
+
+/**
+ * Snaps a planar translation delta; the component along the plane normal becomes 0
+ * @param plane - GizmoEnums.Plane identifier (kPlaneXY, kPlaneXZ, kPlaneYZ)
+ * @param startPos - World position at drag start, used for absolute snapping
+ */
+inline Vec3 snapPlaneMovement(Vec3 delta, int plane, Vec3 startPos, float increment,
+                              bool toAbsolute)
+{
+    const auto snap = [&](float startComponent, float deltaComponent) {
+        return toAbsolute
+            ? snapValueAbsolute(startComponent + deltaComponent, increment) - startComponent
+            : snapValue(deltaComponent, increment);
+    };
+
+    switch (plane) {
+    case kPlaneXY:
+        return {snap(startPos.x, delta.x), snap(startPos.y, delta.y), 0.0f};
+    case kPlaneXZ:
+        return {snap(startPos.x, delta.x), 0.0f, snap(startPos.z, delta.z)};
+    case kPlaneYZ:
+        return {0.0f, snap(startPos.y, delta.y), snap(startPos.z, delta.z)};
+    default:
+        return delta;
+    }
+}
+
+} // namespace gizmo3d::core
+
+#endif // GIZMO3D_CORE_SNAP_H
@@ -0,0 +1,123 @@
+#include "transformbatch.h"
+
+namespace gizmo3d::core {
+
+namespace {
+
+inline Vec3 mapPoint(const Mat4 &m, Vec3 p)
+{
+    // Parent scene transforms are affine, so w stays 1
+    return {m.m[0] * p.x + m.m[4] * p.y + m.m[8] * p.z + m.m[12],
+            m.m[1] * p.x + m.m[5] * p.y + m.m[9] * p.z + m.m[13],
+            m.m[2] * p.x + m.m[6] * p.y + m.m[10] * p.z + m.m[14]};
+}
+
+} // namespace
+
+void TransformBatch::assign(const NodeSnapshot *nodes, size_t count)
+{
+    m_scenePositions.resize(count);
+    m_sceneRotations.resize(count);
+    m_startPositions.resize(count);
+    m_startRotations.resize(count);
+    m_startScales.resize(count);
+    m_parentInverses.resize(count);
+    m_parentRotationInverses.resize(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        const NodeSnapshot &node = nodes[i];
+        m_scenePositions[i] = node.scenePosition;
+        m_sceneRotations[i] = node.sceneRotation;
+        m_startPositions[i] = node.position;
+        m_startRotations[i] = node.rotation;
+        m_startScales[i] = node.scale;
+        // A degenerate (zero-scale) parent leaves its children where they are
+        m_parentInverses[i] = Mat4{};
+        invert(node.parentSceneTransform, &m_parentInverses[i]);
+        m_parentRotationInverses[i] = conjugated(node.parentSceneRotation);
+    }
+
+    reset();
+}
+
+void TransformBatch::clear()
+{
+    assign(nullptr, 0);
+}
+
+void TransformBatch::reset()
+{
+    m_positions = m_startPositions;
+    m_rotations = m_startRotations;
+    m_scales = m_startScales;
+}
+
+void TransformBatch::translate(Vec3 worldDelta)
+{
+    const size_t count = size();
+    const Vec3 *start = m_scenePositions.data();
+    const Mat4 *parentInverse = m_parentInverses.data();
+    Vec3 *out = m_positions.data();
+    for (size_t i = 0; i < count; ++i)
+        out[i] = mapPoint(parentInverse[i], start[i] + worldDelta);
+}
+
+void TransformBatch::rotate(Quat worldRotation, Vec3 pivot, bool aboutOrigins)
+{
+    const size_t count = size();
+    const Quat *startRotation = m_sceneRotations.data();
+    const Quat *parentRotationInverse = m_parentRotationInverses.data();
+    Quat *rotations = m_rotations.data();
+    for (size_t i = 0; i < count; ++i)
+        rotations[i] = parentRotationInverse[i] * (worldRotation * startRotation[i]);
+
+    if (aboutOrigins) {
+        m_positions = m_startPositions;
+        return;
+    }
+
+    const Vec3 *start = m_scenePositions.data();
+    const Mat4 *parentInverse = m_parentInverses.data();
+    Vec3 *positions = m_positions.data();
+    for (size_t i = 0; i < count; ++i)
+        positions[i] = mapPoint(parentInverse[i], pivot + core::rotate(worldRotation, start[i] - pivot));
+}
+
+void TransformBatch::scale(int axis, Vec3 worldAxis, float factor, Vec3 pivot, bool aboutOrigins)
+{
+    const size_t count = size();
+    const Vec3 *startScale = m_startScales.data();
+    Vec3 *scales = m_scales.data();
+    const Vec3 componentFactor{axis < 0 || axis == 0 ? factor : 1.0f,
+                               axis < 0 || axis == 1 ? factor : 1.0f,
+                               axis < 0 || axis == 2 ? factor : 1.0f};
+    for (size_t i = 0; i < count; ++i) {
+        scales[i] = {startScale[i].x * componentFactor.x,
+                     startScale[i].y * componentFactor.y,
+                     startScale[i].z * componentFactor.z};
+    }
+
+    if (aboutOrigins) {
+        m_positions = m_startPositions;
+        return;
+    }
+
+    // Offsets from the pivot grow with the nodes: v*f uniformly, or v + (f-1)(v.d)d
+    // along one direction
+    const Vec3 *start = m_scenePositions.data();
+    const Mat4 *parentInverse = m_parentInverses.data();
+    Vec3 *positions = m_positions.data();
+    if (axis < 0) {
+        for (size_t i = 0; i < count; ++i)
+            positions[i] = mapPoint(parentInverse[i], pivot + (start[i] - pivot) * factor);
+        return;
+    }
+    const float stretch = factor - 1.0f;
+    for (size_t i = 0; i < count; ++i) {
+        const Vec3 offset = start[i] - pivot;
+        positions[i] = mapPoint(parentInverse[i],
+                                pivot + offset + worldAxis * (stretch * dot(offset, worldAxis)));
+    }
+}
+
+} // namespace gizmo3d::core
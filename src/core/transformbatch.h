@@ -0,0 +1,83 @@
+#ifndef GIZMO3D_CORE_TRANSFORMBATCH_H
+#define GIZMO3D_CORE_TRANSFORMBATCH_H
+
+#include <cstddef>
+#include <vector>
+
+#include "vecmath.h"
+
+namespace gizmo3d::core {
+
+// Start state of one node, as read from the scene when a drag begins
+struct NodeSnapshot
+{
+    Vec3 position;              // Parent-relative (Node.position)
+    Quat rotation;              // Parent-relative (Node.rotation)
+    Vec3 scale{1.0f, 1.0f, 1.0f};
+    Vec3 scenePosition;
+    Quat sceneRotation;
+    Mat4 parentSceneTransform;  // Identity for nodes without a parent node
+    Quat parentSceneRotation;
+};
+
+/**
+ * Applies one gizmo delta to a set of nodes, from their drag-start state
+ *
+ * Deltas are solved in scene space and converted back into each node's parent space,
+ * so nodes under transformed parents move along the gizmo's axes rather than their
+ * parents'. Every solve restarts from the snapshot: deltas are cumulative, as the
+ * gizmos emit them, and rounding does not build up over a drag.
+ *
+ * The start state is kept as contiguous per-field arrays and each solve is one
+ * branch-free pass over them, writing the parent-relative results to positions(),
+ * rotations() and scales(). A solve leaves the fields it does not change as they
+ * were; reset() restores all of them to the start values.
+ */
+class TransformBatch
+{
+public:
+    void assign(const NodeSnapshot *nodes, size_t count);
+    void clear();
+
+    size_t size() const { return m_scenePositions.size(); }
+    bool empty() const { return m_scenePositions.empty(); }
+
+    // Moves every node by worldDelta
+    void translate(Vec3 worldDelta);
+
+    // Rotates every node by worldRotation, about pivot or (aboutOrigins) each node's origin
+    void rotate(Quat worldRotation, Vec3 pivot, bool aboutOrigins);
+
+    /**
+     * Scales every node by factor
+     * @param axis 0-2 scales that Node.scale component, -1 all three (uniform)
+     * @param worldAxis Scene-space direction of axis; node offsets from pivot are
+     *        stretched along it (ignored for uniform scaling and aboutOrigins)
+     */
+    void scale(int axis, Vec3 worldAxis, float factor, Vec3 pivot, bool aboutOrigins);
+
+    // Restores the start values
+    void reset();
+
+    // Parent-relative results of the last solve
+    const Vec3 *positions() const { return m_positions.data(); }
+    const Quat *rotations() const { return m_rotations.data(); }
+    const Vec3 *scales() const { return m_scales.data(); }
+
+private:
+    std::vector<Vec3> m_scenePositions;
+    std::vector<Quat> m_sceneRotations;
+    std::vector<Vec3> m_startPositions;
+    std::vector<Quat> m_startRotations;
+    std::vector<Vec3> m_startScales;
+    std::vector<Mat4> m_parentInverses;
+    std::vector<Quat> m_parentRotationInverses;
+
+    std::vector<Vec3> m_positions;
+    std::vector<Quat> m_rotations;
+    std::vector<Vec3> m_scales;
+};
+
+} // namespace gizmo3d::core
+
+#endif // GIZMO3D_CORE_TRANSFORMBATCH_H
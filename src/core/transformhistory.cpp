@@ -0,0 +1,249 @@
+#include "transformhistory.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace gizmo3d::core {
+
+namespace {
+
+// Largest rounding error accepted from a shared delta, relative to the value
+constexpr float kDeltaTolerance = 1.0e-5f;
+
+bool near(float actual, float expected)
+{
+    return std::abs(actual - expected) <= kDeltaTolerance * std::max(1.0f, std::abs(expected));
+}
+
+bool near(Vec3 actual, Vec3 expected)
+{
+    return near(actual.x, expected.x) && near(actual.y, expected.y) && near(actual.z, expected.z);
+}
+
+bool near(Quat actual, Quat expected)
+{
+    // q and -q are the same rotation
+    const float sign = actual.w * expected.w + actual.x * expected.x + actual.y * expected.y
+                     + actual.z * expected.z < 0.0f ? -1.0f : 1.0f;
+    return near(sign * actual.w, expected.w) && near(sign * actual.x, expected.x)
+        && near(sign * actual.y, expected.y) && near(sign * actual.z, expected.z);
+}
+
+bool operator==(Vec3 a, Vec3 b) { return a.x == b.x && a.y == b.y && a.z == b.z; }
+bool operator==(Quat a, Quat b) { return a.w == b.w && a.x == b.x && a.y == b.y && a.z == b.z; }
+
+// Delta encodings, one per field
+struct Offset {};
+struct LeftRotation {};
+struct Factor {};
+
+Vec3 deltaOf(Vec3 before, Vec3 after, Offset) { return after - before; }
+Vec3 applyDelta(Vec3 before, Vec3 delta, Offset) { return before + delta; }
+
+// Rotations are applied on the left, as the gizmos do
+Quat deltaOf(Quat before, Quat after, LeftRotation) { return after * conjugated(before); }
+Quat applyDelta(Quat before, Quat delta, LeftRotation) { return delta * before; }
+
+// Scales change by per-component factors
+Vec3 deltaOf(Vec3 before, Vec3 after, Factor)
+{
+    return {before.x != 0.0f ? after.x / before.x : 1.0f,
+            before.y != 0.0f ? after.y / before.y : 1.0f,
+            before.z != 0.0f ? after.z / before.z : 1.0f};
+}
+Vec3 applyDelta(Vec3 before, Vec3 delta, Factor)
+{
+    return {before.x * delta.x, before.y * delta.y, before.z * delta.z};
+}
+
+/**
+ * Stores one field of an edit in track: the before values, then either one delta
+ * reproducing every after value or the after values themselves
+ * @returns false (storing nothing) when no node's value changed
+ */
+template<typename T, typename Track, typename Field>
+bool encode(Track *track, const T *before, const T *after, size_t count, Field field)
+{
+    size_t changed = 0;
+    while (changed < count && before[changed] == after[changed])
+        ++changed;
+    if (changed == count)
+        return false;
+
+    track->before.assign(before, before + count);
+    track->delta = deltaOf(before[changed], after[changed], field);
+    for (size_t i = 0; i < count; ++i) {
+        if (!near(applyDelta(before[i], track->delta, field), after[i])) {
+            track->after.assign(after, after + count);
+            return true;
+        }
+    }
+    return true;
+}
+
+template<typename T, typename Track, typename Field>
+void decodeTrack(const Track &track, bool after, T NodeTransform::*member, NodeTransform *out,
+                 Field field)
+{
+    const size_t count = track.before.size();
+    if (!after) {
+        for (size_t i = 0; i < count; ++i)
+            out[i].*member = track.before[i];
+    } else if (!track.after.empty()) {
+        for (size_t i = 0; i < count; ++i)
+            out[i].*member = track.after[i];
+    } else {
+        for (size_t i = 0; i < count; ++i)
+            out[i].*member = applyDelta(track.before[i], track.delta, field);
+    }
+}
+
+template<typename Track>
+size_t trackMemory(const Track &track)
+{
+    using T = typename decltype(track.before)::value_type;
+    return (track.before.capacity() + track.after.capacity()) * sizeof(T);
+}
+
+} // namespace
+
+std::unique_ptr<TransformCommand> TransformCommand::create(const uint32_t *nodes,
+                                                           const NodeTransform *before,
+                                                           const NodeTransform *after, size_t count)
+{
+    // Split into per-field arrays once; each field is encoded on its own
+    std::vector<Vec3> beforeVec(count);
+    std::vector<Vec3> afterVec(count);
+    std::vector<Quat> beforeQuat(count);
+    std::vector<Quat> afterQuat(count);
+
+    auto command = std::unique_ptr<TransformCommand>(new TransformCommand);
+
+    for (size_t i = 0; i < count; ++i) {
+        beforeVec[i] = before[i].position;
+        afterVec[i] = after[i].position;
+    }
+    if (encode(&command->m_positions, beforeVec.data(), afterVec.data(), count, Offset{}))
+        command->m_fields |= PositionField;
+
+    for (size_t i = 0; i < count; ++i) {
+        beforeQuat[i] = before[i].rotation;
+        afterQuat[i] = after[i].rotation;
+    }
+    if (encode(&command->m_rotations, beforeQuat.data(), afterQuat.data(), count, LeftRotation{}))
+        command->m_fields |= RotationField;
+
+    for (size_t i = 0; i < count; ++i) {
+        beforeVec[i] = before[i].scale;
+        afterVec[i] = after[i].scale;
+    }
+    if (encode(&command->m_scales, beforeVec.data(), afterVec.data(), count, Factor{}))
+        command->m_fields |= ScaleField;
+
+    if (!command->m_fields)
+        return nullptr;
+
+    // Nodes selected together are usually numbered consecutively: keep the first id only
+    command->m_firstNode = count > 0 ? nodes[0] : 0;
+    command->m_count = count;
+    for (size_t i = 1; i < count; ++i) {
+        if (nodes[i] != command->m_firstNode + i) {
+            command->m_nodes.assign(nodes, nodes + count);
+            break;
+        }
+    }
+    return command;
+}
+
+void TransformCommand::decode(bool after, NodeTransform *out) const
+{
+    if (m_fields & PositionField)
+        decodeTrack(m_positions, after, &NodeTransform::position, out, Offset{});
+    if (m_fields & RotationField)
+        decodeTrack(m_rotations, after, &NodeTransform::rotation, out, LeftRotation{});
+    if (m_fields & ScaleField)
+        decodeTrack(m_scales, after, &NodeTransform::scale, out, Factor{});
+}
+
+size_t TransformCommand::memoryUsage() const
+{
+    return sizeof(*this) + m_nodes.capacity() * sizeof(uint32_t) + trackMemory(m_positions)
+         + trackMemory(m_rotations) + trackMemory(m_scales);
+}
+
+void TransformHistory::push(std::unique_ptr<TransformCommand> command)
+{
+    if (!command)
+        return;
+
+    // A new edit replaces whatever was undone
+    while (m_commands.size() > m_index) {
+        dropped(*m_commands.back());
+        m_commands.pop_back();
+    }
+
+    m_memoryUsage += command->memoryUsage();
+    m_commands.push_back(std::move(command));
+    m_index = m_commands.size();
+    trim();
+}
+
+void TransformHistory::clear()
+{
+    if (m_dropHandler) {
+        for (const std::unique_ptr<TransformCommand> &command : m_commands)
+            m_dropHandler(*command);
+    }
+    m_commands.clear();
+    m_index = 0;
+    m_memoryUsage = 0;
+}
+
+const TransformCommand *TransformHistory::undo()
+{
+    if (!canUndo())
+        return nullptr;
+    return m_commands[--m_index].get();
+}
+
+const TransformCommand *TransformHistory::redo()
+{
+    if (!canRedo())
+        return nullptr;
+    return m_commands[m_index++].get();
+}
+
+void TransformHistory::setLimit(size_t limit)
+{
+    m_limit = limit;
+    trim();
+}
+
+void TransformHistory::trim()
+{
+    if (m_limit == 0 || m_commands.size() <= m_limit)
+        return;
+
+    // Oldest applied commands go first, then (after a lowered limit) the newest undone
+    // ones, so redo never skips a command
+    const size_t excess = m_commands.size() - m_limit;
+    const size_t oldest = std::min(excess, m_index);
+    for (size_t i = 0; i < oldest; ++i)
+        dropped(*m_commands[i]);
+    m_commands.erase(m_commands.begin(), m_commands.begin() + std::ptrdiff_t(oldest));
+    m_index -= oldest;
+
+    while (m_commands.size() > m_limit) {
+        dropped(*m_commands.back());
+        m_commands.pop_back();
+    }
+}
+
+void TransformHistory::dropped(const TransformCommand &command)
+{
+    m_memoryUsage -= command.memoryUsage();
+    if (m_dropHandler)
+        m_dropHandler(command);
+}
+
+} // namespace gizmo3d::core
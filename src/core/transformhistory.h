@@ -0,0 +1,135 @@
+#ifndef GIZMO3D_CORE_TRANSFORMHISTORY_H
+#define GIZMO3D_CORE_TRANSFORMHISTORY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "vecmath.h"
+
+namespace gizmo3d::core {
+
+// Parent-relative transform of one node (Node.position, rotation and scale)
+struct NodeTransform
+{
+    Vec3 position;
+    Quat rotation;
+    Vec3 scale{1.0f, 1.0f, 1.0f};
+};
+
+// Fields a TransformCommand changes
+enum TransformField : uint8_t {
+    PositionField = 0x1,
+    RotationField = 0x2,
+    ScaleField = 0x4
+};
+
+/**
+ * One undoable edit of a set of nodes: their transforms before and after
+ *
+ * Only the fields that changed are stored, one array per field. The before values
+ * are kept as they are, so undo restores them exactly. The after values are
+ * delta-encoded when one delta explains every node (a group translated, turned or
+ * scaled together under a common parent): one offset for positions, one left-applied
+ * rotation, one per-component factor for scales. Redo then reproduces the after
+ * values to within float rounding. Any other edit stores the after array as well.
+ * Consecutive node ids are stored as a range.
+ */
+class TransformCommand
+{
+public:
+    /**
+     * @param nodes Caller-defined node ids, count entries
+     * @returns nullptr when no field of any node changed
+     */
+    static std::unique_ptr<TransformCommand> create(const uint32_t *nodes, const NodeTransform *before,
+                                                    const NodeTransform *after, size_t count);
+
+    size_t size() const { return m_count; }
+    uint32_t node(size_t index) const
+    {
+        return m_nodes.empty() ? m_firstNode + uint32_t(index) : m_nodes[index];
+    }
+    uint8_t fields() const { return m_fields; }
+
+    /**
+     * Writes every node's transform before (after = false) or after the edit into
+     * out[0..size()). Only fields() are written; the others are left as they were.
+     */
+    void decode(bool after, NodeTransform *out) const;
+
+    // Bytes held by the command, including its arrays
+    size_t memoryUsage() const;
+
+private:
+    template<typename T>
+    struct Track
+    {
+        std::vector<T> before;
+        std::vector<T> after;  // Empty when delta holds the shared delta
+        T delta{};
+    };
+
+    // Ids m_firstNode + i unless listed in m_nodes
+    uint32_t m_firstNode = 0;
+    size_t m_count = 0;
+    std::vector<uint32_t> m_nodes;
+    uint8_t m_fields = 0;
+    Track<Vec3> m_positions;
+    Track<Quat> m_rotations;
+    Track<Vec3> m_scales;
+};
+
+/**
+ * Linear undo history of TransformCommands
+ *
+ * Pushing a command discards everything that was undone. With a limit set, the
+ * oldest commands are dropped once there are more.
+ */
+class TransformHistory
+{
+public:
+    // Called with each command the history drops, just before it is destroyed
+    using DropHandler = std::function<void(const TransformCommand &)>;
+
+    // Takes ownership; a null command is ignored
+    void push(std::unique_ptr<TransformCommand> command);
+    void clear();
+
+    bool canUndo() const { return m_index > 0; }
+    bool canRedo() const { return m_index < m_commands.size(); }
+
+    // The command to revert (decode its before values), and moves back
+    const TransformCommand *undo();
+    // The command to re-apply (decode its after values), and moves forward
+    const TransformCommand *redo();
+
+    size_t size() const { return m_commands.size(); }
+    // Commands currently applied
+    size_t index() const { return m_index; }
+
+    // Maximum number of commands kept; 0 keeps all
+    size_t limit() const { return m_limit; }
+    void setLimit(size_t limit);
+
+    size_t memoryUsage() const { return m_memoryUsage; }
+
+    // Lets the owner release what the dropped commands refer to (e.g. node ids)
+    void setDropHandler(DropHandler handler) { m_dropHandler = std::move(handler); }
+
+private:
+    void trim();
+    void dropped(const TransformCommand &command);
+
+    std::vector<std::unique_ptr<TransformCommand>> m_commands;
+    size_t m_index = 0;
+    size_t m_limit = 0;
+    size_t m_memoryUsage = 0;
+    DropHandler m_dropHandler;
+};
+
+} // namespace gizmo3d::core
+
+#endif // GIZMO3D_CORE_TRANSFORMHISTORY_H
@@ -0,0 +1,74 @@
+#ifndef GIZMO3D_CORE_TRIPLEBUFFER_H
+#define GIZMO3D_CORE_TRIPLEBUFFER_H
+
+#include <atomic>
+#include <cstdint>
+
+namespace gizmo3d::core {
+
+/**
+ * Lock-free single-producer/single-consumer triple buffer
+ *
+ * The producer fills writeBuffer() and publish()es it; the consumer fetch()es and
+ * then reads readBuffer(). Three slots rotate through the roles write, ready and
+ * read, swapped with one atomic exchange each, so neither side ever blocks or waits:
+ * the producer can always write (overwriting an unread ready slot), and the consumer
+ * always holds a complete value that stays untouched until its next fetch().
+ *
+ * Everything written into one slot before publish() is seen together by the
+ * consumer; values are never mixed across publishes.
+ */
+template <typename T>
+class TripleBuffer
+{
+public:
+    TripleBuffer() = default;
+    TripleBuffer(const TripleBuffer &) = delete;
+    TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+    // Producer side
+    T &writeBuffer() { return m_slots[m_write]; }
+
+    void publish()
+    {
+        // Release: the slot's contents happen-before the consumer's acquire in fetch()
+        const uint8_t previous = m_ready.exchange(uint8_t(m_write | kFreshBit),
+                                                  std::memory_order_acq_rel);
+        m_write = uint8_t(previous & kIndexMask);
+    }
+
+    // Consumer side
+    /**
+     * Makes the latest published value current
+     * @returns true if a value newer than the current one was published
+     */
+    bool fetch()
+    {
+        if (!(m_ready.load(std::memory_order_relaxed) & kFreshBit))
+            return false;
+
+        const uint8_t previous = m_ready.exchange(m_read, std::memory_order_acq_rel);
+        m_read = uint8_t(previous & kIndexMask);
+        return true;
+    }
+
+    const T &readBuffer() const { return m_slots[m_read]; }
+
+    /**
+     * Whether a value is waiting for fetch() (safe from either side)
+     */
+    bool hasFresh() const { return m_ready.load(std::memory_order_relaxed) & kFreshBit; }
+
+private:
+    static constexpr uint8_t kIndexMask = 0x3;
+    static constexpr uint8_t kFreshBit = 0x4;
+
+    T m_slots[3]{};
+    uint8_t m_write = 0;             // Producer-owned
+    uint8_t m_read = 1;              // Consumer-owned
+    std::atomic<uint8_t> m_ready{2}; // Shared: index of the ready slot | kFreshBit
+};
+
+} // namespace gizmo3d::core
+
+#endif // GIZMO3D_CORE_TRIPLEBUFFER_H
@@ -0,0 +1,148 @@
+#ifndef GIZMO3D_CORE_VECMATH_H
+#define GIZMO3D_CORE_VECMATH_H
+
+#include <cmath>
+
+// Minimal Qt-free vector math for the native core. Layouts match Qt's
+// (QVector3D components, QQuaternion scalar-first, QMatrix4x4 column-major storage)
+// so values can be copied across without conversion.
+
+namespace gizmo3d::core {
+
+struct Vec2
+{
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+struct Vec3
+{
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+struct Vec4
+{
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+    float w = 0.0f;
+};
+
+inline Vec3 operator+(Vec3 a, Vec3 b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+inline Vec3 operator-(Vec3 a, Vec3 b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+inline Vec3 operator-(Vec3 a) { return {-a.x, -a.y, -a.z}; }
+inline Vec3 operator*(Vec3 a, float s) { return {a.x * s, a.y * s, a.z * s}; }
+
+inline float dot(Vec3 a, Vec3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+inline Vec3 cross(Vec3 a, Vec3 b)
+{
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+inline float length(Vec3 a) { return std::sqrt(dot(a, a)); }
+inline float length(Vec2 a) { return std::sqrt(a.x * a.x + a.y * a.y); }
+
+inline Vec3 normalized(Vec3 a)
+{
+    const float len = length(a);
+    return len > 0.0001f ? a * (1.0f / len) : a;
+}
+
+// Unit rotation quaternion, scalar first like QQuaternion
+struct Quat
+{
+    float w = 1.0f;
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+// Hamilton product: applies b first, then a (QQuaternion's operator*)
+inline Quat operator*(Quat a, Quat b)
+{
+    return {a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+            a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+            a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+            a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w};
+}
+
+inline Quat conjugated(Quat q) { return {q.w, -q.x, -q.y, -q.z}; }
+
+// Rotates v by the unit quaternion q
+inline Vec3 rotate(Quat q, Vec3 v)
+{
+    const Vec3 u{q.x, q.y, q.z};
+    const Vec3 t = cross(u, v) * 2.0f;
+    return v + t * q.w + cross(u, t);
+}
+
+// Rotation of angleDegrees about a unit axis (QQuaternion::fromAxisAndAngle)
+inline Quat fromAxisAngle(Vec3 axis, float angleDegrees)
+{
+    const float half = angleDegrees * 0.5f * 3.14159265358979f / 180.0f;
+    const float s = std::sin(half);
+    return {std::cos(half), axis.x * s, axis.y * s, axis.z * s};
+}
+
+// Column-major 4x4 matrix (same storage order as QMatrix4x4::constData())
+struct Mat4
+{
+    float m[16] = {1, 0, 0, 0,
+                   0, 1, 0, 0,
+                   0, 0, 1, 0,
+                   0, 0, 0, 1};
+
+    Vec4 map(Vec3 p) const
+    {
+        return {m[0] * p.x + m[4] * p.y + m[8] * p.z + m[12],
+                m[1] * p.x + m[5] * p.y + m[9] * p.z + m[13],
+                m[2] * p.x + m[6] * p.y + m[10] * p.z + m[14],
+                m[3] * p.x + m[7] * p.y + m[11] * p.z + m[15]};
+    }
+
+    Vec3 column3(int column) const
+    {
+        return {m[column * 4], m[column * 4 + 1], m[column * 4 + 2]};
+    }
+};
+
+inline Mat4 operator*(const Mat4 &a, const Mat4 &b)
+{
+    Mat4 r;
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            r.m[col * 4 + row] = a.m[row] * b.m[col * 4]
+                               + a.m[4 + row] * b.m[col * 4 + 1]
+                               + a.m[8 + row] * b.m[col * 4 + 2]
+                               + a.m[12 + row] * b.m[col * 4 + 3];
+        }
+    }
+    return r;
+}
+
+/**
+ * General 4x4 inverse
+ * @returns false (leaving inverse untouched) when the matrix is singular
+ */
+bool invert(const Mat4 &matrix, Mat4 *inverse);
+
+// Orthonormal gizmo axes (world or target-local)
+struct Axes
+{
+    Vec3 x{1.0f, 0.0f, 0.0f};
+    Vec3 y{0.0f, 1.0f, 0.0f};
+    Vec3 z{0.0f, 0.0f, 1.0f};
+};
+
+// Columns of q's rotation matrix (GizmoMath.getLocalAxes)
+inline Axes axesOf(Quat q)
+{
+    return {rotate(q, {1.0f, 0.0f, 0.0f}), rotate(q, {0.0f, 1.0f, 0.0f}), rotate(q, {0.0f, 0.0f, 1.0f})};
+}
+
+} // namespace gizmo3d::core
+
+#endif // GIZMO3D_CORE_VECMATH_H
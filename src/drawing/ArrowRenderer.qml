@@ -3,6 +3,7 @@
 
 import QtQuick
 import QtQuick.Shapes
+import Gizmo3D
 
 /**
  * ArrowRenderer - Hardware-accelerated arrow rendering using QtQuick.Shapes
@@ -29,24 +30,37 @@ Item {
     property color color: "#ff0000"
     property real lineWidth: 4
     property real headLength: 15
-    property real headAngle: Math.PI / 6
+    property real headAngle: GizmoTemplates.arrowHeadAngle
     property int capStyle: ShapePath.RoundCap
     property int joinStyle: ShapePath.RoundJoin
     property bool antialiasing: true
 
     // Computed properties
-    readonly property real angle: Math.atan2(endPoint.y - startPoint.y, endPoint.x - startPoint.x)
+    // Unit direction from start to end (+X for a zero-length arrow, like atan2(0, 0))
+    readonly property real _length: Math.sqrt((endPoint.x - startPoint.x) * (endPoint.x - startPoint.x) +
+                                              (endPoint.y - startPoint.y) * (endPoint.y - startPoint.y))
+    readonly property point direction: _length > 0
+        ? Qt.point((endPoint.x - startPoint.x) / _length, (endPoint.y - startPoint.y) / _length)
+        : Qt.point(1, 0)
+
+    // Head side rotation: the compile-time constants for the default angle
+    readonly property real _headCos: headAngle === GizmoTemplates.arrowHeadAngle
+        ? GizmoTemplates.arrowHeadCos : Math.cos(headAngle)
+    readonly property real _headSin: headAngle === GizmoTemplates.arrowHeadAngle
+        ? GizmoTemplates.arrowHeadSin : Math.sin(headAngle)
+
+    // Head sides: the direction rotated by -headAngle and +headAngle
     readonly property point shaftEnd: Qt.point(
-        endPoint.x - headLength / 2.0 * Math.cos(angle),
-        endPoint.y - headLength / 2.0 * Math.sin(angle)
+        endPoint.x - headLength / 2.0 * direction.x,
+        endPoint.y - headLength / 2.0 * direction.y
     )
     readonly property point headLeft: Qt.point(
-        endPoint.x - headLength * Math.cos(angle - headAngle),
-        endPoint.y - headLength * Math.sin(angle - headAngle)
+        endPoint.x - headLength * (direction.x * _headCos + direction.y * _headSin),
+        endPoint.y - headLength * (direction.y * _headCos - direction.x * _headSin)
     )
     readonly property point headRight: Qt.point(
-        endPoint.x - headLength * Math.cos(angle + headAngle),
-        endPoint.y - headLength * Math.sin(angle + headAngle)
+        endPoint.x - headLength * (direction.x * _headCos - direction.y * _headSin),
+        endPoint.y - headLength * (direction.y * _headCos + direction.x * _headSin)
     )
 
     // Combined arrow shape (shaft + head) - single Shape for performance
@@ -33,10 +33,15 @@ Item {
     property bool antialiasing: true
 
     // Computed properties
-    readonly property real angle: Math.atan2(endPoint.y - startPoint.y, endPoint.x - startPoint.x)
+    // Unit direction from start to end (+X for a zero-length arrow, like atan2(0, 0))
+    readonly property real _length: Math.sqrt((endPoint.x - startPoint.x) * (endPoint.x - startPoint.x) +
+                                              (endPoint.y - startPoint.y) * (endPoint.y - startPoint.y))
+    readonly property point direction: _length > 0
+        ? Qt.point((endPoint.x - startPoint.x) / _length, (endPoint.y - startPoint.y) / _length)
+        : Qt.point(1, 0)
     readonly property point shaftEnd: Qt.point(
-        endPoint.x - squareSize / 2.0 * Math.cos(angle),
-        endPoint.y - squareSize / 2.0 * Math.sin(angle)
+        endPoint.x - squareSize / 2.0 * direction.x,
+        endPoint.y - squareSize / 2.0 * direction.y
     )
     readonly property real halfSize: squareSize / 2
 
@@ -1,41 +1,30 @@
 // GeometryTemplates.qml - Precomputed geometry templates for performance optimization
-// Precomputes static shape geometry (unit circles, etc.) to avoid per-frame trig calculations
+// Serves the compile-time unit circles of GizmoTemplates (core/geometrytemplates.h), so
+// neither startup nor per-frame geometry does any trigonometry
 
 pragma Singleton
 import QtQuick
+import Gizmo3D
 
 QtObject {
-    // Default segment count for circles (matches RotationGizmo's request, so the
-    // precomputed unitCircle below is the one actually used at runtime — the cache hit)
-    readonly property int defaultSegments: 48
+    // Default segment count for circles (matches RotationGizmo's request)
+    readonly property int defaultSegments: GizmoTemplates.defaultSegments
 
-    // Precomputed unit circle with cos/sin values for each segment
+    // Unit circle with cos/sin values for each segment
     // 49 points for 48 segments (includes closing point at angle 2π = 0)
-    readonly property var unitCircle: _generateUnitCircle(defaultSegments)
-
-    // Internal: generates unit circle template at initialization time
-    function _generateUnitCircle(segments) {
-        var points = []
-        for (var i = 0; i <= segments; i++) {
-            var angle = (i / segments) * Math.PI * 2
-            points.push({
-                cos: Math.cos(angle),
-                sin: Math.sin(angle)
-            })
-        }
-        return points
-    }
+    readonly property var unitCircle: GizmoTemplates.unitCircle(defaultSegments)
 
     /**
-     * Gets unit circle template, optionally generating custom segment count
-     * @param segments - Number of segments (default: 48, returns the cached template)
-     * @returns Array of {cos, sin} objects for each point
+     * Gets unit circle template, optionally for a custom segment count
+     * @param segments - Number of segments (omitted uses defaultSegments)
+     * @returns Array of {cos, sin} objects for each point, shared between callers
      */
-    function getUnitCircle(segments) {
-        if (segments === undefined || segments === defaultSegments) {
+    function getUnitCircle(segments: int): var {
+        // An omitted argument arrives as 0 in a typed function
+        if (segments <= 0 || segments === defaultSegments) {
             return unitCircle
         }
-        // Generate custom segment count (not cached, use sparingly)
-        return _generateUnitCircle(segments)
+        // Compile-time table for common counts, otherwise built once and cached
+        return GizmoTemplates.unitCircle(segments)
     }
 }
@@ -13,7 +13,7 @@ QtObject {
      * @param threshold - real hit distance threshold in pixels
      * @returns {hit: bool, axis: int, distance: real}
      */
-    function testAxisHit(mousePos, axisGeometry, threshold) {
+    function testAxisHit(mousePos: point, axisGeometry: var, threshold: real): var {
         var closestAxis = GizmoEnums.Axis.None
         var closestDistance = Infinity
 
@@ -40,7 +40,7 @@ QtObject {
      * @param planeGeometry - Array of {plane: int, corners: [point, point, point, point]}
      * @returns {hit: bool, plane: int}
      */
-    function testPlaneHit(mousePos, planeGeometry) {
+    function testPlaneHit(mousePos: point, planeGeometry: var): var {
         for (var i = 0; i < planeGeometry.length; i++) {
             var test = planeGeometry[i]
             if (test.corners && test.corners.length === 4) {
@@ -68,7 +68,8 @@ QtObject {
      *                       to test if hit is within valid arc range
      * @returns {hit: bool, axis: int, distance: real}
      */
-    function testCircleHit(mousePos, circleGeometry, threshold, arcRangeFunc) {
+    function testCircleHit(mousePos: point, circleGeometry: var, threshold: real,
+                           arcRangeFunc: var): var {
         var closestAxis = GizmoEnums.Axis.None
         var closestDistance = Infinity
 
@@ -103,7 +104,7 @@ QtObject {
      * @param threshold - real hit distance threshold in pixels
      * @returns {hit: bool, distance: real}
      */
-    function testCenterHandleHit(mousePos, handlePos, threshold) {
+    function testCenterHandleHit(mousePos: point, handlePos: var, threshold: real): var {
         var dx = mousePos.x - handlePos.x
         var dy = mousePos.y - handlePos.y
         var distance = Math.sqrt(dx * dx + dy * dy)
@@ -121,7 +122,7 @@ QtObject {
      * @param axisThreshold - real axis hit threshold in pixels
      * @returns {type: "none"|"axis"|"plane", axis: int, plane: int}
      */
-    function testTranslationGizmoHit(mousePos, geometry, axisThreshold) {
+    function testTranslationGizmoHit(mousePos: point, geometry: var, axisThreshold: real): var {
         if (!geometry) {
             return {type: "none"}
         }
@@ -161,7 +162,8 @@ QtObject {
      * @param arcRangeFunc - Optional arc range validation function
      * @returns {type: "none"|"circle", axis: int}
      */
-    function testRotationGizmoHit(mousePos, geometry, circleThreshold, arcRangeFunc) {
+    function testRotationGizmoHit(mousePos: point, geometry: var, circleThreshold: real,
+                                  arcRangeFunc: var): var {
         if (!geometry || !geometry.circles) {
             return {type: "none"}
         }
@@ -188,7 +190,8 @@ QtObject {
      * @param centerThreshold - real center handle hit threshold in pixels
      * @returns {type: "none"|"axis"|"center", axis: int}
      */
-    function testScaleGizmoHit(mousePos, geometry, axisThreshold, centerThreshold) {
+    function testScaleGizmoHit(mousePos: point, geometry: var, axisThreshold: real,
+                               centerThreshold: real): var {
         if (!geometry) {
             return {type: "none"}
         }
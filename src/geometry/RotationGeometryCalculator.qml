@@ -13,12 +13,13 @@ QtObject {
      * @param t - Interpolation factor (0-1)
      * @returns Interpolated value
      */
-    function lerp(a, b, t) {
+    function lerp(a: real, b: real, t: real): real {
         return a + (b - a) * t
     }
 
     /**
      * Calculates circle geometry for rotation gizmo
+     * Builds a one-off frame context; per-frame callers share one through circleGeometry()
      * @param config - Configuration object:
      *   {
      *     projector: Projector object implementing GizmoProjection interface
@@ -45,28 +46,47 @@ QtObject {
      *     }
      *   }
      */
-    function calculateCircleGeometry(config) {
+    function calculateCircleGeometry(config: var): var {
         if (!config || !config.projector || !config.targetPosition || !config.axes) {
             console.error("RotationGeometryCalculator: Invalid config")
             return null
         }
 
-        var projector = config.projector
-        var targetPosition = config.targetPosition
-        var axes = config.axes
-        var gizmoSize = config.gizmoSize || 80.0
-        var maxScreenRadius = config.maxScreenRadius || 100.0
-        var segments = config.segments || 48
-        var previousRadii = config.previousRadii || null
-        var smoothingFactor = config.smoothingFactor !== undefined ? config.smoothingFactor : 0.3
+        var context = GizmoFrameContext.create(config.projector, config.targetPosition, config.axes)
+        if (!context) return null
+
+        return circleGeometry(
+            context,
+            config.axes,
+            config.gizmoSize || 80.0,
+            config.maxScreenRadius || 100.0,
+            config.segments || 48,
+            config.previousRadii || null,
+            config.smoothingFactor !== undefined ? config.smoothingFactor : 0.3
+        )
+    }
 
-        // Project target position to screen
-        var center = GizmoProjection.projectWorldToScreen(targetPosition, projector)
+    /**
+     * Calculates circle geometry from a shared frame context
+     * @param context - Frame context from GizmoFrameContext.create
+     * @param axes - {x, y, z} circle axes; may differ from context.axes (drag start axes)
+     * @param gizmoSize - real base screen-space size in pixels
+     * @param maxScreenRadius - real maximum screen-space radius in pixels
+     * @param segments - int number of segments for circle polylines
+     * @param previousRadii - {xy, yz, zx} previous frame radii for smoothing, or null
+     * @param smoothingFactor - real lerp factor for temporal smoothing
+     * @returns Geometry object (see calculateCircleGeometry)
+     */
+    function circleGeometry(context: var, axes: var, gizmoSize: real, maxScreenRadius: real,
+                            segments: int, previousRadii: var, smoothingFactor: real): var {
+        var projector = context.projector
+        var targetPosition = context.targetPosition
+        var center = context.center
 
-        // Calculate per-plane scales by measuring both axes of each plane
-        var xAxisScale = projectAxisToScreen(targetPosition, Qt.vector3d(1, 0, 0), projector, center)
-        var yAxisScale = projectAxisToScreen(targetPosition, Qt.vector3d(0, 1, 0), projector, center)
-        var zAxisScale = projectAxisToScreen(targetPosition, Qt.vector3d(0, 0, 1), projector, center)
+        // Per-plane scales from the world axis probes shared through the context
+        var xAxisScale = context.worldAxisLengths.x
+        var yAxisScale = context.worldAxisLengths.y
+        var zAxisScale = context.worldAxisLengths.z
 
         // Average the two axes that define each plane
         var xyPlaneScale = (xAxisScale + yAxisScale) / 2
@@ -143,14 +163,42 @@ QtObject {
         }
     }
 
+    /**
+     * Shifts previously calculated circle geometry by a screen-space offset
+     * (world-space radii are kept)
+     * @param geometry - Geometry object returned by calculateCircleGeometry
+     * @param dx - real horizontal offset in pixels
+     * @param dy - real vertical offset in pixels
+     * @returns New geometry object with every point shifted, or null if geometry is null
+     */
+    function offsetGeometry(geometry: var, dx: real, dy: real): var {
+        if (!geometry) return null
+
+        function shiftPoint(p) {
+            return Qt.point(p.x + dx, p.y + dy)
+        }
+
+        return {
+            center: Qt.vector3d(geometry.center.x + dx, geometry.center.y + dy, geometry.center.z),
+            circles: {
+                xy: geometry.circles.xy.map(shiftPoint),
+                yz: geometry.circles.yz.map(shiftPoint),
+                zx: geometry.circles.zx.map(shiftPoint)
+            },
+            radii: geometry.radii
+        }
+    }
+
     /**
      * Projects a unit axis vector to screen space and measures its length
      * @param center - vector3d world-space center point
      * @param axis - vector3d unit axis direction
      * @param projector - Projector object
+     * @param centerScreen - vector3d projected center
      * @returns real screen-space length
      */
-    function projectAxisToScreen(center, axis, projector, centerScreen) {
+    function projectAxisToScreen(center: vector3d, axis: vector3d, projector: var,
+                                 centerScreen: vector3d): real {
         var testPoint = Qt.vector3d(
             center.x + axis.x,
             center.y + axis.y,
@@ -175,7 +223,8 @@ QtObject {
      * @param projector - Projector object
      * @returns Array of screen-space points
      */
-    function generateCirclePoints(center, axis1, axis2, radius, segments, projector) {
+    function generateCirclePoints(center: vector3d, axis1: vector3d, axis2: vector3d,
+                                  radius: real, segments: int, projector: var): var {
         var points = []
         var template = GeometryTemplates.getUnitCircle(segments)
 
@@ -188,7 +237,7 @@ QtObject {
             // Project to a 2D point: only x/y are used downstream (rendering, hit-testing),
             // and returning Qt.point lets CircleRenderer pass the array straight to
             // PathPolyline without re-wrapping every element each frame.
-            var screen = GizmoProjection.projectWorldToScreen(Qt.vector3d(wx, wy, wz), projector)
+            var screen = projector.projectWorldToScreen(Qt.vector3d(wx, wy, wz))
             points.push(Qt.point(screen.x, screen.y))
         }
 
@@ -207,7 +256,8 @@ QtObject {
      * @param projector - Projector object
      * @returns Array of screen-space points
      */
-    function generateCirclePointsZX(center, axisX, axisZ, radius, segments, projector) {
+    function generateCirclePointsZX(center: vector3d, axisX: vector3d, axisZ: vector3d,
+                                    radius: real, segments: int, projector: var): var {
         var points = []
         var template = GeometryTemplates.getUnitCircle(segments)
 
@@ -219,7 +269,7 @@ QtObject {
             var wy = center.y + axisX.y * s * radius + axisZ.y * c * radius
             var wz = center.z + axisX.z * s * radius + axisZ.z * c * radius
             // Project to a 2D point (see generateCirclePoints) for zero-copy rendering.
-            var screen = GizmoProjection.projectWorldToScreen(Qt.vector3d(wx, wy, wz), projector)
+            var screen = projector.projectWorldToScreen(Qt.vector3d(wx, wy, wz))
             points.push(Qt.point(screen.x, screen.y))
         }
 
@@ -234,15 +284,37 @@ QtObject {
      * @param projector - Projector object
      * @returns real angle in radians (0 to 2π)
      */
-    function calculateCameraFacingAngle(targetPosition, planeNormal, referenceAxis, projector) {
-        // Get direction from target to camera
-        var cameraPos = GizmoProjection.getCameraPosition(projector)
-        var targetToCamera = Qt.vector3d(
-            cameraPos.x - targetPosition.x,
-            cameraPos.y - targetPosition.y,
-            cameraPos.z - targetPosition.z
-        )
+    function calculateCameraFacingAngle(targetPosition: vector3d, planeNormal: vector3d,
+                                       referenceAxis: vector3d, projector: var): real {
+        // Get direction from target to camera. An orthographic camera views everything
+        // along the same direction, so use the reversed view direction instead: it does
+        // not change when the camera or target pans
+        var targetToCamera
+        if (GizmoProjection.isOrthographic(projector)) {
+            var forward = GizmoProjection.getCameraForward(projector)
+            targetToCamera = Qt.vector3d(-forward.x, -forward.y, -forward.z)
+        } else {
+            var cameraPos = GizmoProjection.getCameraPosition(projector)
+            targetToCamera = Qt.vector3d(
+                cameraPos.x - targetPosition.x,
+                cameraPos.y - targetPosition.y,
+                cameraPos.z - targetPosition.z
+            )
+        }
+
+        return facingAngle(targetToCamera, planeNormal, referenceAxis)
+    }
 
+    /**
+     * Calculates the angle on a rotation plane that faces the viewer
+     * @param targetToCamera - vector3d from the gizmo center towards the viewer
+     *                         (GizmoFrameContext toCamera)
+     * @param planeNormal - vector3d plane normal direction
+     * @param referenceAxis - vector3d reference axis for angle measurement
+     * @returns real angle in radians (0 to 2π)
+     */
+    function facingAngle(targetToCamera: vector3d, planeNormal: vector3d,
+                         referenceAxis: vector3d): real {
         // Project onto the rotation plane by removing normal component
         var dotProduct = targetToCamera.x * planeNormal.x +
                         targetToCamera.y * planeNormal.y +
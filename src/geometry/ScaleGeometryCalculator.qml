@@ -8,6 +8,7 @@ import Gizmo3D
 QtObject {
     /**
      * Calculates arrow and handle geometry for scale gizmo
+     * Builds a one-off frame context; per-frame callers share one through handleGeometry()
      * @param config - Configuration object:
      *   {
      *     projector: Projector object implementing GizmoProjection interface
@@ -26,42 +27,44 @@ QtObject {
      *     zStart: point, zEnd: point - Z arrow endpoints
      *   }
      */
-    function calculateHandleGeometry(config) {
+    function calculateHandleGeometry(config: var): var {
         if (!config || !config.projector || !config.targetPosition || !config.axes) {
             console.error("ScaleGeometryCalculator: Invalid config")
             return null
         }
 
-        var projector = config.projector
-        var targetPosition = config.targetPosition
-        var axes = config.axes
-        var gizmoSize = config.gizmoSize || 100.0
-        var maxScreenSize = config.maxScreenSize || 150.0
-        var arrowStartRatio = config.arrowStartRatio !== undefined ? config.arrowStartRatio : 0.0
-        var arrowEndRatio = config.arrowEndRatio !== undefined ? config.arrowEndRatio : 1.0
-
-        // Project target position to screen
-        var center = GizmoProjection.projectWorldToScreen(targetPosition, projector)
-
-        // Calculate world-space axis endpoints
-        var xEnd = GizmoMath.vectorAdd(targetPosition, axes.x)
-        var yEnd = GizmoMath.vectorAdd(targetPosition, axes.y)
-        var zEnd = GizmoMath.vectorAdd(targetPosition, axes.z)
-
-        // Project endpoints to screen space
-        var xScreen = GizmoProjection.projectWorldToScreen(xEnd, projector)
-        var yScreen = GizmoProjection.projectWorldToScreen(yEnd, projector)
-        var zScreen = GizmoProjection.projectWorldToScreen(zEnd, projector)
-
-        // Calculate screen-space directions
-        var xDir = Qt.point(xScreen.x - center.x, xScreen.y - center.y)
-        var yDir = Qt.point(yScreen.x - center.x, yScreen.y - center.y)
-        var zDir = Qt.point(zScreen.x - center.x, zScreen.y - center.y)
-
-        // Normalize and scale to gizmoSize
-        var xLen = Math.sqrt(xDir.x * xDir.x + xDir.y * xDir.y)
-        var yLen = Math.sqrt(yDir.x * yDir.x + yDir.y * yDir.y)
-        var zLen = Math.sqrt(zDir.x * zDir.x + zDir.y * zDir.y)
+        var context = GizmoFrameContext.create(config.projector, config.targetPosition, config.axes)
+        if (!context) return null
+
+        return handleGeometry(
+            context,
+            config.gizmoSize || 100.0,
+            config.maxScreenSize || 150.0,
+            config.arrowStartRatio !== undefined ? config.arrowStartRatio : 0.0,
+            config.arrowEndRatio !== undefined ? config.arrowEndRatio : 1.0
+        )
+    }
+
+    /**
+     * Calculates arrow and handle geometry from a shared frame context
+     * @param context - Frame context from GizmoFrameContext.create
+     * @param gizmoSize - real base screen-space size in pixels
+     * @param maxScreenSize - real maximum screen-space extent in pixels
+     * @param arrowStartRatio - real start ratio for arrows (0.0-1.0)
+     * @param arrowEndRatio - real end ratio for arrows (0.0-1.0)
+     * @returns Geometry object (see calculateHandleGeometry)
+     */
+    function handleGeometry(context: var, gizmoSize: real, maxScreenSize: real,
+                            arrowStartRatio: real, arrowEndRatio: real): var {
+        var center = context.center
+
+        // Screen-space axis directions, normalized and scaled to gizmoSize
+        var xDir = context.axisDirs.x
+        var yDir = context.axisDirs.y
+        var zDir = context.axisDirs.z
+        var xLen = context.axisLengths.x
+        var yLen = context.axisLengths.y
+        var zLen = context.axisLengths.z
 
         if (xLen > 0) xDir = Qt.point(xDir.x / xLen * gizmoSize, xDir.y / xLen * gizmoSize)
         if (yLen > 0) yDir = Qt.point(yDir.x / yLen * gizmoSize, yDir.y / yLen * gizmoSize)
@@ -120,4 +123,29 @@ QtObject {
             zEnd: zActualEnd
         }
     }
+
+    /**
+     * Shifts previously calculated handle geometry by a screen-space offset
+     * @param geometry - Geometry object returned by calculateHandleGeometry
+     * @param dx - real horizontal offset in pixels
+     * @param dy - real vertical offset in pixels
+     * @returns New geometry object with every point shifted, or null if geometry is null
+     */
+    function offsetGeometry(geometry: var, dx: real, dy: real): var {
+        if (!geometry) return null
+
+        function shiftPoint(p) {
+            return Qt.point(p.x + dx, p.y + dy)
+        }
+
+        return {
+            center: Qt.vector3d(geometry.center.x + dx, geometry.center.y + dy, geometry.center.z),
+            xStart: shiftPoint(geometry.xStart),
+            xEnd: shiftPoint(geometry.xEnd),
+            yStart: shiftPoint(geometry.yStart),
+            yEnd: shiftPoint(geometry.yEnd),
+            zStart: shiftPoint(geometry.zStart),
+            zEnd: shiftPoint(geometry.zEnd)
+        }
+    }
 }
@@ -8,6 +8,7 @@ import Gizmo3D
 QtObject {
     /**
      * Calculates arrow and plane geometry for translation gizmo
+     * Builds a one-off frame context; per-frame callers share one through arrowGeometry()
      * @param config - Configuration object:
      *   {
      *     projector: Projector object implementing GizmoProjection interface
@@ -31,42 +32,47 @@ QtObject {
      *     }
      *   }
      */
-    function calculateArrowGeometry(config) {
+    function calculateArrowGeometry(config: var): var {
         if (!config || !config.projector || !config.targetPosition || !config.axes) {
             console.error("TranslationGeometryCalculator: Invalid config")
             return null
         }
 
-        var projector = config.projector
-        var targetPosition = config.targetPosition
-        var axes = config.axes
-        var gizmoSize = config.gizmoSize || 100.0
-        var maxScreenSize = config.maxScreenSize || 150.0
-        var arrowStartRatio = config.arrowStartRatio !== undefined ? config.arrowStartRatio : 0.0
-        var arrowEndRatio = config.arrowEndRatio !== undefined ? config.arrowEndRatio : 1.0
-
-        // Project target position to screen
-        var center = GizmoProjection.projectWorldToScreen(targetPosition, projector)
-
-        // Calculate world-space axis endpoints
-        var xEnd = GizmoMath.vectorAdd(targetPosition, axes.x)
-        var yEnd = GizmoMath.vectorAdd(targetPosition, axes.y)
-        var zEnd = GizmoMath.vectorAdd(targetPosition, axes.z)
-
-        // Project endpoints to screen space
-        var xScreen = GizmoProjection.projectWorldToScreen(xEnd, projector)
-        var yScreen = GizmoProjection.projectWorldToScreen(yEnd, projector)
-        var zScreen = GizmoProjection.projectWorldToScreen(zEnd, projector)
-
-        // Calculate screen-space directions
-        var xDir = Qt.point(xScreen.x - center.x, xScreen.y - center.y)
-        var yDir = Qt.point(yScreen.x - center.x, yScreen.y - center.y)
-        var zDir = Qt.point(zScreen.x - center.x, zScreen.y - center.y)
-
-        // Normalize and scale to gizmoSize
-        var xLen = Math.sqrt(xDir.x * xDir.x + xDir.y * xDir.y)
-        var yLen = Math.sqrt(yDir.x * yDir.x + yDir.y * yDir.y)
-        var zLen = Math.sqrt(zDir.x * zDir.x + zDir.y * zDir.y)
+        var context = GizmoFrameContext.create(config.projector, config.targetPosition, config.axes)
+        if (!context) return null
+
+        return arrowGeometry(
+            context,
+            config.gizmoSize || 100.0,
+            config.maxScreenSize || 150.0,
+            config.arrowStartRatio !== undefined ? config.arrowStartRatio : 0.0,
+            config.arrowEndRatio !== undefined ? config.arrowEndRatio : 1.0
+        )
+    }
+
+    /**
+     * Calculates arrow and plane geometry from a shared frame context
+     * @param context - Frame context from GizmoFrameContext.create
+     * @param gizmoSize - real base screen-space size in pixels
+     * @param maxScreenSize - real maximum screen-space extent in pixels
+     * @param arrowStartRatio - real start ratio for arrows (0.0-1.0)
+     * @param arrowEndRatio - real end ratio for arrows (0.0-1.0)
+     * @returns Geometry object (see calculateArrowGeometry)
+     */
+    function arrowGeometry(context: var, gizmoSize: real, maxScreenSize: real,
+                           arrowStartRatio: real, arrowEndRatio: real): var {
+        var projector = context.projector
+        var targetPosition = context.targetPosition
+        var axes = context.axes
+        var center = context.center
+
+        // Screen-space axis directions, normalized and scaled to gizmoSize
+        var xDir = context.axisDirs.x
+        var yDir = context.axisDirs.y
+        var zDir = context.axisDirs.z
+        var xLen = context.axisLengths.x
+        var yLen = context.axisLengths.y
+        var zLen = context.axisLengths.z
 
         if (xLen > 0) xDir = Qt.point(xDir.x / xLen * gizmoSize, xDir.y / xLen * gizmoSize)
         if (yLen > 0) yDir = Qt.point(yDir.x / yLen * gizmoSize, yDir.y / yLen * gizmoSize)
@@ -161,6 +167,41 @@ QtObject {
         }
     }
 
+    /**
+     * Shifts previously calculated arrow geometry by a screen-space offset
+     * @param geometry - Geometry object returned by calculateArrowGeometry
+     * @param dx - real horizontal offset in pixels
+     * @param dy - real vertical offset in pixels
+     * @returns New geometry object with every point shifted, or null if geometry is null
+     */
+    function offsetGeometry(geometry: var, dx: real, dy: real): var {
+        if (!geometry) return null
+
+        function shiftPoint(p) {
+            return Qt.point(p.x + dx, p.y + dy)
+        }
+
+        // Projected points (center, plane corners) keep their depth component
+        function shiftProjected(p) {
+            return Qt.vector3d(p.x + dx, p.y + dy, p.z)
+        }
+
+        return {
+            center: shiftProjected(geometry.center),
+            xStart: shiftPoint(geometry.xStart),
+            xEnd: shiftPoint(geometry.xEnd),
+            yStart: shiftPoint(geometry.yStart),
+            yEnd: shiftPoint(geometry.yEnd),
+            zStart: shiftPoint(geometry.zStart),
+            zEnd: shiftPoint(geometry.zEnd),
+            planes: {
+                xy: geometry.planes.xy.map(shiftProjected),
+                xz: geometry.planes.xz.map(shiftProjected),
+                yz: geometry.planes.yz.map(shiftProjected)
+            }
+        }
+    }
+
     /**
      * Calculates plane corners in world space and projects to screen space
      * @param center - vector3d plane center in world space
@@ -170,7 +211,8 @@ QtObject {
      * @param projector - Projector object
      * @returns Array of 4 screen-space points (corners)
      */
-    function calculatePlaneCorners(center, axis1, axis2, size, projector) {
+    function calculatePlaneCorners(center: vector3d, axis1: vector3d, axis2: vector3d,
+                                   size: real, projector: var): var {
         var halfSize = size / 2
 
         // Calculate world-space corners
@@ -193,9 +235,9 @@ QtObject {
             )
         ]
 
-        // Project to screen space
+        // Project to screen space (the projector was validated by GizmoFrameContext)
         return corners.map(function(corner) {
-            return GizmoProjection.projectWorldToScreen(corner, projector)
+            return projector.projectWorldToScreen(corner)
         })
     }
 
@@ -208,7 +250,8 @@ QtObject {
      * @param snapToAbsolute - bool true for world grid, false for relative
      * @returns vector3d snapped delta
      */
-    function snapPlaneMovement(delta, plane, startPos, snapIncrement, snapToAbsolute) {
+    function snapPlaneMovement(delta: vector3d, plane: int, startPos: vector3d,
+                               snapIncrement: real, snapToAbsolute: bool): vector3d {
         var snappedX = delta.x
         var snappedY = delta.y
         var snappedZ = delta.z
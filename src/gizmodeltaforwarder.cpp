@@ -0,0 +1,294 @@
+#include "gizmodeltaforwarder.h"
+
+#include <QJSEngine>
+#include <QMetaMethod>
+
+using gizmo3d::core::PositionField;
+using gizmo3d::core::Quat;
+using gizmo3d::core::RotationField;
+using gizmo3d::core::ScaleField;
+using gizmo3d::core::Vec3;
+
+namespace {
+
+// GizmoEnums values the gizmo signals carry
+constexpr int kAxisX = 1;
+constexpr int kAxisY = 2;
+constexpr int kAxisZ = 3;
+constexpr int kTransformModeLocal = 1;
+constexpr int kModeTranslate = 0;
+constexpr int kModeRotate = 1;
+constexpr int kModeScale = 2;
+
+// Gizmo signal -> forwarder slot
+struct SignalRoute
+{
+    const char *signal;
+    const char *slot;
+};
+
+constexpr SignalRoute kRoutes[] = {
+    {"axisTranslationStarted(int)", "begin()"},
+    {"axisTranslationDelta(int,int,double,bool)", "axisTranslationDelta(int,int,double,bool)"},
+    {"planeTranslationStarted(int)", "begin()"},
+    {"planeTranslationDelta(int,int,QVector3D,bool)", "planeTranslationDelta(int,int,QVector3D,bool)"},
+    {"rotationStarted(int)", "begin()"},
+    {"rotationDelta(int,int,double,bool)", "rotationDelta(int,int,double,bool)"},
+    {"scaleStarted(int)", "begin()"},
+    {"scaleDelta(int,int,double,bool)", "scaleDelta(int,int,double,bool)"},
+};
+
+QVector3D toQVector3D(const Vec3 &v)
+{
+    return {v.x, v.y, v.z};
+}
+
+QQuaternion toQQuaternion(const Quat &q)
+{
+    return {q.w, q.x, q.y, q.z};
+}
+
+} // namespace
+
+GizmoDeltaForwarder::GizmoDeltaForwarder(QObject *parent)
+    : QObject(parent)
+{
+}
+
+QList<QObject *> GizmoDeltaForwarder::sources() const
+{
+    return m_sources;
+}
+
+void GizmoDeltaForwarder::setSources(const QList<QObject *> &sources)
+{
+    if (m_sources == sources)
+        return;
+    m_sources = sources;
+    connectSources();
+    emit sourcesChanged();
+}
+
+QObject *GizmoDeltaForwarder::targetNode() const
+{
+    return m_targetNode;
+}
+
+void GizmoDeltaForwarder::setTargetNode(QObject *node)
+{
+    if (m_targetNode == node)
+        return;
+    m_targetNode = node;
+    // The snapshot belongs to the previous target; wait for the next drag
+    m_batch.clear();
+    emit targetNodeChanged();
+}
+
+bool GizmoDeltaForwarder::isEnabled() const
+{
+    return m_enabled;
+}
+
+void GizmoDeltaForwarder::setEnabled(bool enabled)
+{
+    if (m_enabled == enabled)
+        return;
+    m_enabled = enabled;
+    connectSources();
+    emit enabledChanged();
+}
+
+bool GizmoDeltaForwarder::applyToTarget() const
+{
+    return m_applyToTarget;
+}
+
+void GizmoDeltaForwarder::setApplyToTarget(bool apply)
+{
+    if (m_applyToTarget == apply)
+        return;
+    m_applyToTarget = apply;
+    connectSources();
+    emit applyToTargetChanged();
+}
+
+QJSValue GizmoDeltaForwarder::validator() const
+{
+    return m_validator;
+}
+
+void GizmoDeltaForwarder::setValidator(const QJSValue &validator)
+{
+    if (m_validator.strictlyEquals(validator))
+        return;
+    m_validator = validator;
+    emit validatorChanged();
+}
+
+void GizmoDeltaForwarder::begin()
+{
+    m_batch.clear();
+    m_pivot = {};
+    m_localAxes = {};
+    if (!m_targetNode)
+        return;
+
+    const gizmo3d::core::NodeSnapshot snapshot = GizmoNodeAccess::snapshot(m_targetNode);
+    m_batch.assign(&snapshot, 1);
+    m_pivot = snapshot.scenePosition;
+    m_localAxes = gizmo3d::core::axesOf(snapshot.sceneRotation);
+}
+
+void GizmoDeltaForwarder::axisTranslationDelta(int axis, int transformMode, double delta, bool snapActive)
+{
+    GizmoTransformDelta result;
+    result.mode = kModeTranslate;
+    result.axis = axis;
+    result.transformMode = transformMode;
+    result.snapActive = snapActive;
+    result.value = delta;
+
+    const Vec3 translation = axisDirection(axis, transformMode) * float(delta);
+    result.translation = toQVector3D(translation);
+    if (!m_batch.empty())
+        m_batch.translate(translation);
+    emitDelta(result, PositionField);
+}
+
+void GizmoDeltaForwarder::planeTranslationDelta(int plane, int transformMode, const QVector3D &delta,
+                                                bool snapActive)
+{
+    GizmoTransformDelta result;
+    result.mode = kModeTranslate;
+    result.plane = plane;
+    result.transformMode = transformMode;
+    result.snapActive = snapActive;
+
+    // Local deltas are components along the drag-start local axes
+    const Vec3 translation = transformMode == kTransformModeLocal
+            ? m_localAxes.x * delta.x() + m_localAxes.y * delta.y() + m_localAxes.z * delta.z()
+            : Vec3{delta.x(), delta.y(), delta.z()};
+    result.translation = toQVector3D(translation);
+    if (!m_batch.empty())
+        m_batch.translate(translation);
+    emitDelta(result, PositionField);
+}
+
+void GizmoDeltaForwarder::rotationDelta(int axis, int transformMode, double angleDegrees, bool snapActive)
+{
+    GizmoTransformDelta result;
+    result.mode = kModeRotate;
+    result.axis = axis;
+    result.transformMode = transformMode;
+    result.snapActive = snapActive;
+    result.value = angleDegrees;
+
+    const Quat rotation = gizmo3d::core::fromAxisAngle(axisDirection(axis, transformMode),
+                                                       float(angleDegrees));
+    result.rotation = toQQuaternion(rotation);
+    if (!m_batch.empty())
+        m_batch.rotate(rotation, m_pivot, true);
+    emitDelta(result, RotationField);
+}
+
+void GizmoDeltaForwarder::scaleDelta(int axis, int transformMode, double scaleFactor, bool snapActive)
+{
+    GizmoTransformDelta result;
+    result.mode = kModeScale;
+    result.axis = axis;
+    result.transformMode = transformMode;
+    result.snapActive = snapActive;
+    result.value = scaleFactor;
+
+    const float factor = float(scaleFactor);
+    const bool uniform = axis < kAxisX || axis > kAxisZ;
+    result.scale = uniform ? QVector3D(factor, factor, factor)
+                 : axis == kAxisX ? QVector3D(factor, 1.0f, 1.0f)
+                 : axis == kAxisY ? QVector3D(1.0f, factor, 1.0f)
+                                  : QVector3D(1.0f, 1.0f, factor);
+    if (!m_batch.empty()) {
+        m_batch.scale(uniform ? -1 : axis - kAxisX, uniform ? Vec3{} : axisDirection(axis, transformMode),
+                      factor, m_pivot, true);
+    }
+    emitDelta(result, ScaleField);
+}
+
+void GizmoDeltaForwarder::connectSources()
+{
+    for (const QMetaObject::Connection &connection : std::as_const(m_connections))
+        disconnect(connection);
+    m_connections.clear();
+    if (!m_enabled && !m_applyToTarget)
+        return;
+
+    // Looked up by signature, like GizmoTransformController: each gizmo has only its
+    // own groups of signals
+    const QMetaObject *meta = metaObject();
+    for (QObject *source : std::as_const(m_sources)) {
+        if (!source)
+            continue;
+        const QMetaObject *sourceMeta = source->metaObject();
+        for (const SignalRoute &route : kRoutes) {
+            const int signalIndex = sourceMeta->indexOfSignal(route.signal);
+            if (signalIndex < 0)
+                continue;
+            m_connections.append(connect(source, sourceMeta->method(signalIndex),
+                                         this, meta->method(meta->indexOfSlot(route.slot))));
+        }
+    }
+}
+
+Vec3 GizmoDeltaForwarder::axisDirection(int axis, int transformMode) const
+{
+    if (transformMode == kTransformModeLocal) {
+        return axis == kAxisX ? m_localAxes.x
+             : axis == kAxisY ? m_localAxes.y
+                              : m_localAxes.z;
+    }
+    return axis == kAxisX ? Vec3{1.0f, 0.0f, 0.0f}
+         : axis == kAxisY ? Vec3{0.0f, 1.0f, 0.0f}
+                          : Vec3{0.0f, 0.0f, 1.0f};
+}
+
+bool GizmoDeltaForwarder::validate(GizmoTransformDelta &delta)
+{
+    if (!m_validator.isCallable())
+        return true;
+    QJSEngine *engine = qjsEngine(this);
+    if (!engine)
+        return true;
+
+    const QJSValue result = m_validator.call({engine->toScriptValue(delta)});
+    if (result.isError()) {
+        qWarning("GizmoDeltaForwarder: validator threw %s", qPrintable(result.toString()));
+        return false;
+    }
+    if (result.isBool())
+        return result.toBool();
+    const QVariant adjusted = result.toVariant();
+    if (adjusted.metaType() == QMetaType::fromType<GizmoTransformDelta>())
+        delta = adjusted.value<GizmoTransformDelta>();
+    return true;
+}
+
+void GizmoDeltaForwarder::emitDelta(GizmoTransformDelta &delta, int field)
+{
+    // Without a target the fields stay identity
+    if (!m_batch.empty()) {
+        delta.targetPosition = toQVector3D(m_batch.positions()[0]);
+        delta.targetRotation = toQQuaternion(m_batch.rotations()[0]);
+        delta.targetScale = toQVector3D(m_batch.scales()[0]);
+    }
+    if (!validate(delta))
+        return;
+
+    if (m_applyToTarget && m_targetNode && !m_batch.empty()) {
+        const QVector3D &p = delta.targetPosition;
+        const QQuaternion &q = delta.targetRotation;
+        const QVector3D &s = delta.targetScale;
+        GizmoNodeAccess::write(m_targetNode, m_access.propertiesOf(m_targetNode), field,
+                               {{p.x(), p.y(), p.z()}, {q.scalar(), q.x(), q.y(), q.z()},
+                                {s.x(), s.y(), s.z()}});
+    }
+    emit transformDelta(delta);
+}
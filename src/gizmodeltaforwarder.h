@@ -0,0 +1,103 @@
+#ifndef GIZMODELTAFORWARDER_H
+#define GIZMODELTAFORWARDER_H
+
+#include <QJSValue>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QVector3D>
+#include <QtQml/qqmlregistration.h>
+
+#include "core/transformbatch.h"
+#include "gizmonodeaccess.h"
+#include "gizmotransformdelta.h"
+
+/**
+ * Folds the delta signals of one or more gizmos into a single typed signal
+ *
+ * Connects natively to each source's axisTranslationDelta, planeTranslationDelta,
+ * rotationDelta and scaleDelta and emits transformDelta() for every one of them, so a
+ * controller needs one handler instead of four, and no drag-start state: the delta
+ * carries the target's resulting transform. The target is snapshot on each *Started.
+ *
+ * With applyToTarget the forwarder also writes the result to targetNode itself, one
+ * property write per delta, so a drag needs no controller at all. validator, when set,
+ * sees each delta first and may veto or adjust it.
+ *
+ * GlobalGizmo forwards its child gizmos' signals through one of these as deltas,
+ * disabled until asked for (or directManipulation is set). Connected there, a delta
+ * reaches its handler straight from the child gizmo, without GlobalGizmo's QML relay.
+ */
+class GizmoDeltaForwarder : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+    Q_PROPERTY(QList<QObject *> sources READ sources WRITE setSources NOTIFY sourcesChanged)
+    Q_PROPERTY(QObject *targetNode READ targetNode WRITE setTargetNode NOTIFY targetNodeChanged)
+    Q_PROPERTY(bool enabled READ isEnabled WRITE setEnabled NOTIFY enabledChanged)
+    Q_PROPERTY(bool applyToTarget READ applyToTarget WRITE setApplyToTarget NOTIFY applyToTargetChanged)
+    Q_PROPERTY(QJSValue validator READ validator WRITE setValidator NOTIFY validatorChanged)
+
+public:
+    explicit GizmoDeltaForwarder(QObject *parent = nullptr);
+
+    // Gizmos whose signals are forwarded; null entries are skipped
+    QList<QObject *> sources() const;
+    void setSources(const QList<QObject *> &sources);
+
+    // Node the target fields are computed for; without one they stay identity
+    QObject *targetNode() const;
+    void setTargetNode(QObject *node);
+
+    // Nothing is connected while disabled (the default) and not applying
+    bool isEnabled() const;
+    void setEnabled(bool enabled);
+
+    // Write each delta's result to targetNode
+    bool applyToTarget() const;
+    void setApplyToTarget(bool apply);
+
+    /**
+     * Function called with each delta before it is applied and emitted. Returning false
+     * drops the delta; returning a gizmoTransformDelta applies and emits that instead
+     */
+    QJSValue validator() const;
+    void setValidator(const QJSValue &validator);
+
+signals:
+    void sourcesChanged();
+    void targetNodeChanged();
+    void enabledChanged();
+    void applyToTargetChanged();
+    void validatorChanged();
+    void transformDelta(const GizmoTransformDelta &delta);
+
+private slots:
+    void begin();
+    void axisTranslationDelta(int axis, int transformMode, double delta, bool snapActive);
+    void planeTranslationDelta(int plane, int transformMode, const QVector3D &delta, bool snapActive);
+    void rotationDelta(int axis, int transformMode, double angleDegrees, bool snapActive);
+    void scaleDelta(int axis, int transformMode, double scaleFactor, bool snapActive);
+
+private:
+    void connectSources();
+    gizmo3d::core::Vec3 axisDirection(int axis, int transformMode) const;
+    bool validate(GizmoTransformDelta &delta);
+    void emitDelta(GizmoTransformDelta &delta, int field);
+
+    QList<QObject *> m_sources;
+    QPointer<QObject> m_targetNode;
+    bool m_enabled = false;
+    bool m_applyToTarget = false;
+    QJSValue m_validator;
+    QList<QMetaObject::Connection> m_connections;
+
+    // Drag-start state of the target
+    gizmo3d::core::TransformBatch m_batch;
+    gizmo3d::core::Vec3 m_pivot;
+    gizmo3d::core::Axes m_localAxes;
+    GizmoNodeAccess m_access;
+};
+
+#endif // GIZMODELTAFORWARDER_H
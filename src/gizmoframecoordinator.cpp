@@ -0,0 +1,283 @@
+#include "gizmoframecoordinator.h"
+
+#include "gizmogeometrytask.h"
+#include "gizmoparallel.h"
+#include "gizmoprofiler.h"
+#include "gizmotrace.h"
+#include "gizmoprojector.h"
+
+#include <QAbstractAnimation>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QPointer>
+#include <QQmlEngine>
+#include <QThread>
+
+// Open-ended animation: ticked by the animation timer once per frame
+class GizmoFrameCoordinator::Ticker : public QAbstractAnimation
+{
+public:
+    explicit Ticker(GizmoFrameCoordinator *coordinator)
+        : QAbstractAnimation(coordinator)
+        , m_coordinator(coordinator)
+    {
+    }
+
+    int duration() const override { return -1; }
+
+protected:
+    void updateCurrentTime(int) override { m_coordinator->processFrame(); }
+
+private:
+    GizmoFrameCoordinator *m_coordinator;
+};
+
+GizmoFrameCoordinator::GizmoFrameCoordinator(QObject *parent)
+    : QObject(parent)
+    , m_ticker(new Ticker(this))
+{
+    // The GUI thread works alongside the pool, so leave one core for it
+    setWorkerCount(qMax(0, QThread::idealThreadCount() - 1));
+}
+
+GizmoFrameCoordinator::~GizmoFrameCoordinator()
+{
+    // A running frame job still reads the task list
+    waitForJob();
+}
+
+GizmoFrameCoordinator *GizmoFrameCoordinator::instance()
+{
+    static QPointer<GizmoFrameCoordinator> coordinator;
+    if (!coordinator)
+        coordinator = new GizmoFrameCoordinator(QCoreApplication::instance());
+    return coordinator;
+}
+
+GizmoFrameCoordinator *GizmoFrameCoordinator::create(QQmlEngine *, QJSEngine *)
+{
+    GizmoFrameCoordinator *coordinator = instance();
+    // Shared by every engine; QML must never take ownership
+    QQmlEngine::setObjectOwnership(coordinator, QQmlEngine::CppOwnership);
+    return coordinator;
+}
+
+void GizmoFrameCoordinator::registerTask(GizmoGeometryTask *task)
+{
+    if (!task || m_tasks.contains(task))
+        return;
+    m_tasks.insert(task);
+    updateTicking();
+    emit taskCountChanged();
+}
+
+void GizmoFrameCoordinator::unregisterTask(GizmoGeometryTask *task)
+{
+    if (!m_tasks.remove(task))
+        return;
+    // Destroying a task the frame job is computing is the one case that has to wait
+    if (m_jobRunning.load(std::memory_order_acquire) && m_dirtyTasks.contains(task))
+        waitForJob();
+    updateTicking();
+    emit taskCountChanged();
+}
+
+int GizmoFrameCoordinator::taskCount() const
+{
+    return int(m_tasks.size());
+}
+
+int GizmoFrameCoordinator::workerCount() const
+{
+    return m_workerCount;
+}
+
+void GizmoFrameCoordinator::setWorkerCount(int count)
+{
+    count = qMax(0, count);
+    if (m_workerCount == count)
+        return;
+    m_workerCount = count;
+    // The pool is unused without workers; QThreadPool needs at least one thread
+    m_pool.setMaxThreadCount(qMax(1, count));
+    emit workerCountChanged();
+}
+
+int GizmoFrameCoordinator::serialThreshold() const
+{
+    return m_serialThreshold;
+}
+
+void GizmoFrameCoordinator::setSerialThreshold(int threshold)
+{
+    if (m_serialThreshold == threshold)
+        return;
+    m_serialThreshold = threshold;
+    emit serialThresholdChanged();
+}
+
+int GizmoFrameCoordinator::chunkSize() const
+{
+    return m_chunkSize;
+}
+
+void GizmoFrameCoordinator::setChunkSize(int size)
+{
+    size = qMax(1, size);
+    if (m_chunkSize == size)
+        return;
+    m_chunkSize = size;
+    emit chunkSizeChanged();
+}
+
+bool GizmoFrameCoordinator::isAsynchronous() const
+{
+    return m_asynchronous;
+}
+
+void GizmoFrameCoordinator::setAsynchronous(bool asynchronous)
+{
+    if (m_asynchronous == asynchronous)
+        return;
+    m_asynchronous = asynchronous;
+    emit asynchronousChanged();
+}
+
+int GizmoFrameCoordinator::lastComputedCount() const
+{
+    return m_lastComputedCount;
+}
+
+qreal GizmoFrameCoordinator::lastComputeTime() const
+{
+    return m_lastComputeTime;
+}
+
+void GizmoFrameCoordinator::processFrame()
+{
+    // Without workers there is no thread to hand the job to: compute it inline
+    if (!m_asynchronous || m_workerCount == 0) {
+        // A job may be left over from asynchronous mode
+        waitForJob();
+        prepareFrame();
+
+        QElapsedTimer timer;
+        timer.start();
+        computeDirtyTasks(poolFor(int(m_dirtyTasks.size())), m_chunkSize);
+        const qint64 computeNs = timer.nsecsElapsed();
+        m_lastComputeTime = computeNs / 1.0e6;
+        GIZMO3D_PROFILE_TIME(GeometryBuild, computeNs);
+
+        for (GizmoGeometryTask *task : std::as_const(m_dirtyTasks)) {
+            if (m_tasks.contains(task))
+                task->publish();
+        }
+        emit frameCompleted();
+        return;
+    }
+
+    // Publish whatever the workers completed since the last tick; tasks without a new
+    // result keep their current geometry
+    m_frameTasks.clear();
+    for (GizmoGeometryTask *task : std::as_const(m_tasks))
+        m_frameTasks.append(task);
+    for (GizmoGeometryTask *task : std::as_const(m_frameTasks)) {
+        if (m_tasks.contains(task))
+            task->publish();
+    }
+
+    // Never wait for the workers: the next job starts once the current one is done
+    if (m_jobRunning.load(std::memory_order_acquire))
+        return;
+
+    // Each finished job is picked up once; without a new job the last time stands
+    if (const qint64 jobNs = m_jobNanoseconds.exchange(0, std::memory_order_relaxed)) {
+        m_lastComputeTime = jobNs / 1.0e6;
+        GIZMO3D_PROFILE_TIME(GeometryBuild, jobNs);
+    }
+    prepareFrame();
+    if (!m_dirtyTasks.isEmpty()) {
+        m_jobRunning.store(true, std::memory_order_relaxed);
+        // Settings are read here: the job must not touch GUI-thread state
+        QThreadPool *pool = poolFor(int(m_dirtyTasks.size()));
+        const int chunkSize = m_chunkSize;
+        m_pool.start([this, pool, chunkSize]() {
+            QElapsedTimer timer;
+            timer.start();
+            computeDirtyTasks(pool, chunkSize);
+            m_jobNanoseconds.store(timer.nsecsElapsed(), std::memory_order_relaxed);
+            m_jobRunning.store(false, std::memory_order_release);
+        });
+    }
+    emit frameCompleted();
+}
+
+void GizmoFrameCoordinator::prepareFrame()
+{
+    // Preparing runs QML handlers that may register or destroy tasks, so work on a
+    // copy and re-check membership before touching a task
+    m_frameTasks.clear();
+    for (GizmoGeometryTask *task : std::as_const(m_tasks))
+        m_frameTasks.append(task);
+
+    // One snapshot per view, captured before any pointer into the hash is handed out
+    m_snapshots.clear();
+    {
+        GIZMO3D_PROFILE_SCOPE(Projection);
+        for (GizmoGeometryTask *task : std::as_const(m_frameTasks)) {
+            QQuickItem *view = task->view3d();
+            if (!m_snapshots.contains(view)) {
+                ViewSnapshot &entry = m_snapshots[view];
+                entry.valid = GizmoProjector::captureSnapshot(view, &entry.snapshot);
+            }
+        }
+    }
+    GIZMO3D_PROFILE_COUNT(Projections, int(m_snapshots.size()));
+
+    GIZMO3D_PROFILE_SCOPE(DirtyCheck);
+    m_dirtyTasks.clear();
+    for (GizmoGeometryTask *task : std::as_const(m_frameTasks)) {
+        if (!m_tasks.contains(task))
+            continue;
+        const ViewSnapshot &entry = m_snapshots[task->view3d()];
+        if (task->prepare(entry.valid ? &entry.snapshot : nullptr))
+            m_dirtyTasks.append(task);
+    }
+    m_lastComputedCount = int(m_dirtyTasks.size());
+    GIZMO3D_PROFILE_COUNT(GeometryUpdates, m_lastComputedCount);
+    GIZMO3D_PROFILE_COUNT(SkippedUpdates, int(m_frameTasks.size()) - m_lastComputedCount);
+}
+
+QThreadPool *GizmoFrameCoordinator::poolFor(int count)
+{
+    return (m_workerCount > 0 && count >= m_serialThreshold) ? &m_pool : nullptr;
+}
+
+void GizmoFrameCoordinator::computeDirtyTasks(QThreadPool *pool, int chunkSize)
+{
+    gizmo3d::forEachChunk(pool, int(m_dirtyTasks.size()), chunkSize, [this](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            GizmoGeometryTask *task = m_dirtyTasks.at(i);
+            // Tagged like the QML stages: the owning gizmo and its GizmoEnums.Mode
+            GIZMO3D_TRACE_SCOPE(GizmoProfiler::GeometryBuild, task->parent(),
+                                task->kind() == GizmoGeometryTask::Arrow    ? 0
+                                : task->kind() == GizmoGeometryTask::Circle ? 1
+                                                                            : 2);
+            task->compute();
+        }
+    });
+}
+
+void GizmoFrameCoordinator::waitForJob()
+{
+    if (m_jobRunning.load(std::memory_order_acquire))
+        m_pool.waitForDone();
+}
+
+void GizmoFrameCoordinator::updateTicking()
+{
+    if (m_tasks.isEmpty())
+        m_ticker->stop();
+    else if (m_ticker->state() != QAbstractAnimation::Running)
+        m_ticker->start();
+}
@@ -0,0 +1,128 @@
+#ifndef GIZMOFRAMECOORDINATOR_H
+#define GIZMOFRAMECOORDINATOR_H
+
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QQuickItem>
+#include <QSet>
+#include <QThreadPool>
+#include <QtQml/qqmlregistration.h>
+
+#include <atomic>
+
+#include "core/camerasnapshot.h"
+
+class QQmlEngine;
+class QJSEngine;
+class GizmoGeometryTask;
+
+/**
+ * Drives every GizmoGeometryTask once per frame
+ *
+ * Each tick the coordinator captures one CameraSnapshot per view, collects the tasks
+ * whose inputs or snapshot changed, computes them on a dedicated worker pool (the GUI
+ * thread claims chunks too) and publishes the results on the GUI thread. Ticks come
+ * from the animation timer, like FrameAnimation, so results land before polish and
+ * scene graph sync of the same frame.
+ *
+ * Small batches below serialThreshold run inline: fanning out a handful of gizmos
+ * costs more in wake-ups than it saves. The coordinator only ticks while tasks are
+ * registered.
+ *
+ * With asynchronous set and at least one worker, the GUI thread never waits for the
+ * workers: a tick publishes whatever results have completed (through each task's
+ * triple buffer) and starts the next frame job only once the previous one has
+ * finished. Geometry then trails the camera by about a frame, in exchange for a GUI
+ * thread that is never held up by geometry work.
+ */
+class GizmoFrameCoordinator : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_SINGLETON
+
+    Q_PROPERTY(int taskCount READ taskCount NOTIFY taskCountChanged)
+    Q_PROPERTY(int workerCount READ workerCount WRITE setWorkerCount NOTIFY workerCountChanged)
+    Q_PROPERTY(int serialThreshold READ serialThreshold WRITE setSerialThreshold NOTIFY serialThresholdChanged)
+    Q_PROPERTY(int chunkSize READ chunkSize WRITE setChunkSize NOTIFY chunkSizeChanged)
+    Q_PROPERTY(bool asynchronous READ isAsynchronous WRITE setAsynchronous NOTIFY asynchronousChanged)
+    Q_PROPERTY(int lastComputedCount READ lastComputedCount NOTIFY frameCompleted)
+    Q_PROPERTY(qreal lastComputeTime READ lastComputeTime NOTIFY frameCompleted)
+
+public:
+    static GizmoFrameCoordinator *instance();
+    static GizmoFrameCoordinator *create(QQmlEngine *qmlEngine, QJSEngine *jsEngine);
+
+    void registerTask(GizmoGeometryTask *task);
+    void unregisterTask(GizmoGeometryTask *task);
+
+    int taskCount() const;
+
+    // Worker threads in addition to the GUI thread (0 computes everything inline and
+    // synchronously, even when asynchronous is set)
+    int workerCount() const;
+    void setWorkerCount(int count);
+
+    int serialThreshold() const;
+    void setSerialThreshold(int threshold);
+
+    int chunkSize() const;
+    void setChunkSize(int size);
+
+    bool isAsynchronous() const;
+    void setAsynchronous(bool asynchronous);
+
+    int lastComputedCount() const;
+    qreal lastComputeTime() const;  // ms spent computing the last frame's dirty tasks
+
+    /**
+     * Runs one frame immediately instead of waiting for the next tick
+     */
+    Q_INVOKABLE void processFrame();
+
+signals:
+    void taskCountChanged();
+    void workerCountChanged();
+    void serialThresholdChanged();
+    void chunkSizeChanged();
+    void asynchronousChanged();
+    void frameCompleted();
+
+private:
+    explicit GizmoFrameCoordinator(QObject *parent = nullptr);
+    ~GizmoFrameCoordinator() override;
+
+    void updateTicking();
+    void prepareFrame();
+    QThreadPool *poolFor(int count);
+    void computeDirtyTasks(QThreadPool *pool, int chunkSize);
+    void waitForJob();
+
+    struct ViewSnapshot
+    {
+        gizmo3d::core::CameraSnapshot snapshot;
+        bool valid = false;
+    };
+
+    class Ticker;
+    Ticker *m_ticker = nullptr;
+    QThreadPool m_pool;
+    int m_workerCount = 0;
+    int m_serialThreshold = 64;
+    int m_chunkSize = 16;
+    bool m_asynchronous = false;
+    std::atomic<bool> m_jobRunning{false};
+    std::atomic<qint64> m_jobNanoseconds{0};
+
+    QSet<GizmoGeometryTask *> m_tasks;
+    // Per-frame scratch storage, reused to avoid reallocating every frame
+    QList<GizmoGeometryTask *> m_frameTasks;
+    QList<GizmoGeometryTask *> m_dirtyTasks;  // Read by the frame job while it runs
+    QHash<QQuickItem *, ViewSnapshot> m_snapshots;
+
+    int m_lastComputedCount = 0;
+    qreal m_lastComputeTime = 0.0;
+};
+
+#endif // GIZMOFRAMECOORDINATOR_H
@@ -0,0 +1,439 @@
+#include "gizmogeometrytask.h"
+
+#include "gizmoframecoordinator.h"
+
+#include "core/hittest.h"
+
+#include <QJSValue>
+#include <QPointF>
+#include <QVariantList>
+
+using namespace gizmo3d::core;
+
+namespace {
+
+Vec3 toCore(const QVector3D &v)
+{
+    return {v.x(), v.y(), v.z()};
+}
+
+QVector3D toQt(const Vec3 &v)
+{
+    return QVector3D(v.x, v.y, v.z);
+}
+
+QPointF toPoint(const Vec2 &v)
+{
+    return QPointF(v.x, v.y);
+}
+
+// Accepts the {x, y, z} axes objects produced by GizmoMath.getLocalAxes()
+Axes toAxes(const QVariant &value)
+{
+    const QVariantMap map = value.canConvert<QJSValue>()
+        ? value.value<QJSValue>().toVariant().toMap()
+        : value.toMap();
+    if (map.isEmpty())
+        return {};
+
+    Axes axes;
+    axes.x = toCore(map.value(QStringLiteral("x")).value<QVector3D>());
+    axes.y = toCore(map.value(QStringLiteral("y")).value<QVector3D>());
+    axes.z = toCore(map.value(QStringLiteral("z")).value<QVector3D>());
+    return axes;
+}
+
+QVariantList toPointList(const std::vector<Vec2> &points)
+{
+    QVariantList list;
+    list.reserve(qsizetype(points.size()));
+    for (const Vec2 &p : points)
+        list.append(toPoint(p));
+    return list;
+}
+
+QVariantList toCornerList(const std::array<Vec3, 4> &corners)
+{
+    QVariantList list;
+    list.reserve(4);
+    for (const Vec3 &c : corners)
+        list.append(toQt(c));
+    return list;
+}
+
+void insertHandles(QVariantMap &map, const HandleGeometry &g)
+{
+    map.insert(QStringLiteral("center"), toQt(g.center));
+    map.insert(QStringLiteral("xStart"), toPoint(g.start[AxisX]));
+    map.insert(QStringLiteral("xEnd"), toPoint(g.end[AxisX]));
+    map.insert(QStringLiteral("yStart"), toPoint(g.start[AxisY]));
+    map.insert(QStringLiteral("yEnd"), toPoint(g.end[AxisY]));
+    map.insert(QStringLiteral("zStart"), toPoint(g.start[AxisZ]));
+    map.insert(QStringLiteral("zEnd"), toPoint(g.end[AxisZ]));
+}
+
+template <typename T>
+bool assign(T &field, const T &value)
+{
+    if (field == value)
+        return false;
+    field = value;
+    return true;
+}
+
+} // namespace
+
+GizmoGeometryTask::GizmoGeometryTask(QObject *parent)
+    : QObject(parent)
+{
+    m_circleParams.axes = m_arrowParams.axes = Axes{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    m_circleParams.facingAxes = m_circleParams.axes;
+}
+
+GizmoGeometryTask::~GizmoGeometryTask()
+{
+    // Not instance(): at shutdown that would create a coordinator just to unregister
+    if (m_coordinator)
+        m_coordinator->unregisterTask(this);
+}
+
+GizmoGeometryTask::Kind GizmoGeometryTask::kind() const
+{
+    return m_kind;
+}
+
+void GizmoGeometryTask::setKind(Kind kind)
+{
+    if (!assign(m_kind, kind))
+        return;
+    markDirty();
+    emit kindChanged();
+}
+
+bool GizmoGeometryTask::isEnabled() const
+{
+    return m_enabled;
+}
+
+void GizmoGeometryTask::setEnabled(bool enabled)
+{
+    if (!assign(m_enabled, enabled))
+        return;
+    // A re-enabled task must not smooth against radii from before it was paused
+    resetSmoothing();
+    updateRegistration();
+    emit enabledChanged();
+}
+
+QQuickItem *GizmoGeometryTask::view3d() const
+{
+    return m_view;
+}
+
+void GizmoGeometryTask::setView3d(QQuickItem *view3d)
+{
+    if (m_view == view3d)
+        return;
+
+    disconnect(m_windowConnection);
+    m_view = view3d;
+    if (view3d)
+        m_windowConnection = connect(view3d, &QQuickItem::windowChanged,
+                                     this, &GizmoGeometryTask::updateRegistration);
+
+    m_hasSnapshot = false;
+    resetSmoothing();
+    updateRegistration();
+    emit view3dChanged();
+}
+
+QVector3D GizmoGeometryTask::targetPosition() const
+{
+    return toQt(m_arrowParams.targetPosition);
+}
+
+void GizmoGeometryTask::setTargetPosition(const QVector3D &position)
+{
+    if (targetPosition() == position)
+        return;
+    m_arrowParams.targetPosition = m_circleParams.targetPosition = toCore(position);
+    markDirty();
+    emit targetPositionChanged();
+}
+
+QVariant GizmoGeometryTask::axes() const
+{
+    return m_axesValue;
+}
+
+void GizmoGeometryTask::setAxes(const QVariant &axes)
+{
+    m_axesValue = axes;
+    m_arrowParams.axes = m_circleParams.axes = toAxes(axes);
+    markDirty();
+    emit axesChanged();
+}
+
+QVariant GizmoGeometryTask::facingAxes() const
+{
+    return m_facingAxesValue;
+}
+
+void GizmoGeometryTask::setFacingAxes(const QVariant &axes)
+{
+    m_facingAxesValue = axes;
+    m_circleParams.facingAxes = toAxes(axes);
+    markDirty();
+    emit facingAxesChanged();
+}
+
+qreal GizmoGeometryTask::gizmoSize() const
+{
+    return m_kind == Circle ? m_circleParams.gizmoSize : m_arrowParams.gizmoSize;
+}
+
+void GizmoGeometryTask::setGizmoSize(qreal size)
+{
+    if (float(size) == m_arrowParams.gizmoSize && float(size) == m_circleParams.gizmoSize)
+        return;
+    m_arrowParams.gizmoSize = m_circleParams.gizmoSize = float(size);
+    markDirty();
+    emit gizmoSizeChanged();
+}
+
+qreal GizmoGeometryTask::maxScreenSize() const
+{
+    return m_arrowParams.maxScreenSize;
+}
+
+void GizmoGeometryTask::setMaxScreenSize(qreal size)
+{
+    if (!assign(m_arrowParams.maxScreenSize, float(size)))
+        return;
+    markDirty();
+    emit maxScreenSizeChanged();
+}
+
+qreal GizmoGeometryTask::arrowStartRatio() const
+{
+    return m_arrowParams.arrowStartRatio;
+}
+
+void GizmoGeometryTask::setArrowStartRatio(qreal ratio)
+{
+    if (!assign(m_arrowParams.arrowStartRatio, float(ratio)))
+        return;
+    markDirty();
+    emit arrowStartRatioChanged();
+}
+
+qreal GizmoGeometryTask::arrowEndRatio() const
+{
+    return m_arrowParams.arrowEndRatio;
+}
+
+void GizmoGeometryTask::setArrowEndRatio(qreal ratio)
+{
+    if (!assign(m_arrowParams.arrowEndRatio, float(ratio)))
+        return;
+    markDirty();
+    emit arrowEndRatioChanged();
+}
+
+qreal GizmoGeometryTask::maxScreenRadius() const
+{
+    return m_circleParams.maxScreenRadius;
+}
+
+void GizmoGeometryTask::setMaxScreenRadius(qreal radius)
+{
+    if (!assign(m_circleParams.maxScreenRadius, float(radius)))
+        return;
+    markDirty();
+    emit maxScreenRadiusChanged();
+}
+
+int GizmoGeometryTask::segments() const
+{
+    return m_circleParams.segments;
+}
+
+void GizmoGeometryTask::setSegments(int segments)
+{
+    if (!assign(m_circleParams.segments, segments))
+        return;
+    markDirty();
+    emit segmentsChanged();
+}
+
+QVariantMap GizmoGeometryTask::geometry() const
+{
+    return m_geometry;
+}
+
+bool GizmoGeometryTask::isActive() const
+{
+    return m_active;
+}
+
+void GizmoGeometryTask::resetSmoothing()
+{
+    // Applied by the next prepare(): the history itself belongs to the pending job
+    m_resetSmoothing = true;
+    markDirty();
+}
+
+QVariantMap GizmoGeometryTask::hitTest(qreal x, qreal y, qreal threshold, qreal centerThreshold) const
+{
+    const Result &result = m_results.readBuffer();
+    if (!result.valid)
+        return {{QStringLiteral("type"), QStringLiteral("none")}};
+
+    const Vec2 point{float(x), float(y)};
+    HitResult hit;
+    switch (result.kind) {
+    case Arrow:
+        hit = hitTestArrows(result.arrow, point, float(threshold));
+        break;
+    case Handle:
+        hit = hitTestHandles(result.arrow, point, float(threshold), float(centerThreshold));
+        break;
+    case Circle:
+        hit = hitTestCircles(result.circle, point, float(threshold));
+        break;
+    }
+
+    switch (hit.type) {
+    case HitType::Axis:
+        return {{QStringLiteral("type"), QStringLiteral("axis")}, {QStringLiteral("axis"), hit.axis}};
+    case HitType::Plane:
+        return {{QStringLiteral("type"), QStringLiteral("plane")}, {QStringLiteral("plane"), hit.plane}};
+    case HitType::Center:
+        return {{QStringLiteral("type"), QStringLiteral("center")}, {QStringLiteral("axis"), hit.axis}};
+    case HitType::Circle:
+        return {{QStringLiteral("type"), QStringLiteral("circle")}, {QStringLiteral("axis"), hit.axis}};
+    case HitType::None:
+        break;
+    }
+    return {{QStringLiteral("type"), QStringLiteral("none")}};
+}
+
+bool GizmoGeometryTask::prepare(const gizmo3d::core::CameraSnapshot *snapshot)
+{
+    setActive(snapshot != nullptr);
+    if (!snapshot)
+        return false;
+
+    if (!m_hasSnapshot || m_snapshot != *snapshot) {
+        m_snapshot = *snapshot;
+        m_hasSnapshot = true;
+        m_inputsDirty = true;
+    }
+
+    if (!m_inputsDirty)
+        return false;
+    m_inputsDirty = false;
+
+    // Smoothing continues from the radii the previous job produced
+    const bool keepHistory = m_job.circle.hasPreviousRadii && !m_resetSmoothing;
+    const std::array<float, 3> history = m_job.circle.previousRadii;
+    m_resetSmoothing = false;
+
+    m_job.kind = m_kind;
+    m_job.snapshot = m_snapshot;
+    m_job.arrow = m_arrowParams;
+    m_job.circle = m_circleParams;
+    m_job.circle.hasPreviousRadii = keepHistory;
+    m_job.circle.previousRadii = history;
+    return true;
+}
+
+void GizmoGeometryTask::compute()
+{
+    Result &result = m_results.writeBuffer();
+    result.kind = m_job.kind;
+    result.valid = true;
+
+    switch (m_job.kind) {
+    case Arrow:
+        computeArrowGeometry(m_job.snapshot, m_job.arrow, result.arrow);
+        break;
+    case Handle:
+        computeHandleGeometry(m_job.snapshot, m_job.arrow, result.arrow);
+        break;
+    case Circle:
+        computeCircleGeometry(m_job.snapshot, m_job.circle, result.circle);
+        // Feed this frame's radii into the next frame's temporal smoothing
+        m_job.circle.previousRadii = result.circle.radii;
+        m_job.circle.hasPreviousRadii = true;
+        break;
+    }
+
+    m_results.publish();
+}
+
+bool GizmoGeometryTask::publish()
+{
+    if (!m_results.fetch())
+        return false;
+
+    const Result &result = m_results.readBuffer();
+    const CircleGeometry &circle = result.circle;
+    const ArrowGeometry &arrow = result.arrow;
+
+    QVariantMap map;
+    if (result.kind == Circle) {
+        map.insert(QStringLiteral("center"), toQt(circle.center));
+        map.insert(QStringLiteral("circles"), QVariantMap{
+            {QStringLiteral("xy"), toPointList(circle.circles[CircleXY])},
+            {QStringLiteral("yz"), toPointList(circle.circles[CircleYZ])},
+            {QStringLiteral("zx"), toPointList(circle.circles[CircleZX])}});
+        map.insert(QStringLiteral("radii"), QVariantMap{
+            {QStringLiteral("xy"), circle.radii[CircleXY]},
+            {QStringLiteral("yz"), circle.radii[CircleYZ]},
+            {QStringLiteral("zx"), circle.radii[CircleZX]}});
+        map.insert(QStringLiteral("facing"), QVariantMap{
+            {QStringLiteral("yz"), circle.facingAngles[0]},
+            {QStringLiteral("zx"), circle.facingAngles[1]},
+            {QStringLiteral("xy"), circle.facingAngles[2]}});
+    } else {
+        insertHandles(map, arrow);
+        if (result.kind == Arrow)
+            map.insert(QStringLiteral("planes"), QVariantMap{
+                {QStringLiteral("xy"), toCornerList(arrow.planes[PlaneXY])},
+                {QStringLiteral("xz"), toCornerList(arrow.planes[PlaneXZ])},
+                {QStringLiteral("yz"), toCornerList(arrow.planes[PlaneYZ])}});
+    }
+
+    m_geometry = map;
+    emit geometryChanged();
+    return true;
+}
+
+void GizmoGeometryTask::setActive(bool active)
+{
+    if (!assign(m_active, active))
+        return;
+    emit activeChanged();
+}
+
+void GizmoGeometryTask::markDirty()
+{
+    m_inputsDirty = true;
+}
+
+void GizmoGeometryTask::updateRegistration()
+{
+    const bool shouldRegister = m_enabled && m_view && m_view->window();
+    if (shouldRegister == !m_coordinator.isNull())
+        return;
+
+    if (shouldRegister) {
+        m_coordinator = GizmoFrameCoordinator::instance();
+        m_coordinator->registerTask(this);
+    } else {
+        m_coordinator->unregisterTask(this);
+        m_coordinator = nullptr;
+        setActive(false);
+    }
+}
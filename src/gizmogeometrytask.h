@@ -0,0 +1,190 @@
+#ifndef GIZMOGEOMETRYTASK_H
+#define GIZMOGEOMETRYTASK_H
+
+#include <QObject>
+#include <QPointer>
+#include <QQuickItem>
+#include <QVariant>
+#include <QVariantMap>
+#include <QVector3D>
+#include <QtQml/qqmlregistration.h>
+
+#include "core/camerasnapshot.h"
+#include "core/gizmogeometry.h"
+#include "core/triplebuffer.h"
+
+class GizmoFrameCoordinator;
+
+/**
+ * Native geometry job for one gizmo
+ *
+ * Computes the same screen-space geometry as the QML calculators
+ * (TranslationGeometryCalculator, ScaleGeometryCalculator, RotationGeometryCalculator),
+ * but off the GUI thread: GizmoFrameCoordinator captures one CameraSnapshot per view
+ * each frame, fans the dirty tasks of all views out across its worker pool and
+ * publishes the results before the scene graph syncs.
+ *
+ * The geometry property has exactly the shape the matching calculator returns, so it
+ * can be assigned straight to a gizmo's geometry. Circle tasks additionally report
+ * the camera-facing angles as facing: {yz, zx, xy}.
+ *
+ * A task only recomputes when its inputs or its view's camera snapshot changed.
+ *
+ * Results are handed from the computing thread to the GUI thread through a lock-free
+ * triple buffer: compute() fills the newest slot while the GUI thread keeps reading
+ * the latest complete one, so neither side blocks and the arrows, planes and circles
+ * of one result are always seen together. The published geometry and hitTest() read
+ * the same slot.
+ */
+class GizmoGeometryTask : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+    Q_PROPERTY(Kind kind READ kind WRITE setKind NOTIFY kindChanged)
+    Q_PROPERTY(bool enabled READ isEnabled WRITE setEnabled NOTIFY enabledChanged)
+    Q_PROPERTY(QQuickItem *view3d READ view3d WRITE setView3d NOTIFY view3dChanged)
+    Q_PROPERTY(QVector3D targetPosition READ targetPosition WRITE setTargetPosition NOTIFY targetPositionChanged)
+    Q_PROPERTY(QVariant axes READ axes WRITE setAxes NOTIFY axesChanged)
+    Q_PROPERTY(QVariant facingAxes READ facingAxes WRITE setFacingAxes NOTIFY facingAxesChanged)
+    Q_PROPERTY(qreal gizmoSize READ gizmoSize WRITE setGizmoSize NOTIFY gizmoSizeChanged)
+    Q_PROPERTY(qreal maxScreenSize READ maxScreenSize WRITE setMaxScreenSize NOTIFY maxScreenSizeChanged)
+    Q_PROPERTY(qreal arrowStartRatio READ arrowStartRatio WRITE setArrowStartRatio NOTIFY arrowStartRatioChanged)
+    Q_PROPERTY(qreal arrowEndRatio READ arrowEndRatio WRITE setArrowEndRatio NOTIFY arrowEndRatioChanged)
+    Q_PROPERTY(qreal maxScreenRadius READ maxScreenRadius WRITE setMaxScreenRadius NOTIFY maxScreenRadiusChanged)
+    Q_PROPERTY(int segments READ segments WRITE setSegments NOTIFY segmentsChanged)
+    Q_PROPERTY(QVariantMap geometry READ geometry NOTIFY geometryChanged)
+    Q_PROPERTY(bool active READ isActive NOTIFY activeChanged)
+
+public:
+    enum Kind {
+        Arrow,   // TranslationGeometryCalculator.calculateArrowGeometry
+        Handle,  // ScaleGeometryCalculator.calculateHandleGeometry
+        Circle   // RotationGeometryCalculator.calculateCircleGeometry + facing angles
+    };
+    Q_ENUM(Kind)
+
+    explicit GizmoGeometryTask(QObject *parent = nullptr);
+    ~GizmoGeometryTask() override;
+
+    Kind kind() const;
+    void setKind(Kind kind);
+    bool isEnabled() const;
+    void setEnabled(bool enabled);
+    QQuickItem *view3d() const;
+    void setView3d(QQuickItem *view3d);
+    QVector3D targetPosition() const;
+    void setTargetPosition(const QVector3D &position);
+    QVariant axes() const;
+    void setAxes(const QVariant &axes);
+    QVariant facingAxes() const;
+    void setFacingAxes(const QVariant &axes);
+    qreal gizmoSize() const;
+    void setGizmoSize(qreal size);
+    qreal maxScreenSize() const;
+    void setMaxScreenSize(qreal size);
+    qreal arrowStartRatio() const;
+    void setArrowStartRatio(qreal ratio);
+    qreal arrowEndRatio() const;
+    void setArrowEndRatio(qreal ratio);
+    qreal maxScreenRadius() const;
+    void setMaxScreenRadius(qreal radius);
+    int segments() const;
+    void setSegments(int segments);
+
+    QVariantMap geometry() const;
+    bool isActive() const;
+
+    /**
+     * Drops the smoothing history so the next circle starts from unsmoothed radii
+     */
+    Q_INVOKABLE void resetSmoothing();
+
+    /**
+     * Hit-tests the currently published geometry natively (same rules as HitTester)
+     * @param x - real screen-space x
+     * @param y - real screen-space y
+     * @param threshold - real axis/circle hit distance in pixels
+     * @param centerThreshold - real center handle hit distance in pixels (Handle only)
+     * @returns {type: "none"|"axis"|"plane"|"center"|"circle", axis: int, plane: int}
+     *          like HitTester's combined tests; circle hits ignore arc ranges
+     */
+    Q_INVOKABLE QVariantMap hitTest(qreal x, qreal y, qreal threshold,
+                                    qreal centerThreshold = 12.0) const;
+
+    // Frame protocol driven by GizmoFrameCoordinator
+    /**
+     * Records this frame's snapshot (GUI thread)
+     * @returns true when the geometry must be recomputed
+     */
+    bool prepare(const gizmo3d::core::CameraSnapshot *snapshot);
+    void compute();  // Any thread: reads the prepared job, writes the result buffer
+    /**
+     * Picks up the latest computed result (GUI thread)
+     * @returns false when nothing new was computed since the last call
+     */
+    bool publish();
+    void setActive(bool active);
+
+signals:
+    void kindChanged();
+    void enabledChanged();
+    void view3dChanged();
+    void targetPositionChanged();
+    void axesChanged();
+    void facingAxesChanged();
+    void gizmoSizeChanged();
+    void maxScreenSizeChanged();
+    void arrowStartRatioChanged();
+    void arrowEndRatioChanged();
+    void maxScreenRadiusChanged();
+    void segmentsChanged();
+    void geometryChanged();
+    void activeChanged();
+
+private:
+    void markDirty();
+    void updateRegistration();
+
+    Kind m_kind = Arrow;
+    bool m_enabled = true;
+    bool m_active = false;
+    // Set while registered; cleared if the coordinator is destroyed first
+    QPointer<GizmoFrameCoordinator> m_coordinator;
+    QPointer<QQuickItem> m_view;
+    QMetaObject::Connection m_windowConnection;
+    QVariant m_axesValue;
+    QVariant m_facingAxesValue;
+
+    // Inputs as set from QML (GUI thread)
+    gizmo3d::core::ArrowParams m_arrowParams;
+    gizmo3d::core::CircleParams m_circleParams;
+    gizmo3d::core::CameraSnapshot m_snapshot;
+    bool m_hasSnapshot = false;
+    bool m_inputsDirty = true;
+    bool m_resetSmoothing = false;
+
+    // Inputs of the pending compute(), copied by prepare(); owned by the computing
+    // thread until the coordinator's frame job has finished
+    struct Job
+    {
+        Kind kind = Arrow;
+        gizmo3d::core::CameraSnapshot snapshot;
+        gizmo3d::core::ArrowParams arrow;
+        gizmo3d::core::CircleParams circle;  // Also carries the smoothing history
+    };
+    Job m_job;
+
+    struct Result
+    {
+        Kind kind = Arrow;
+        bool valid = false;
+        gizmo3d::core::ArrowGeometry arrow;
+        gizmo3d::core::CircleGeometry circle;
+    };
+    gizmo3d::core::TripleBuffer<Result> m_results;
+
+    QVariantMap m_geometry;
+};
+
+#endif // GIZMOGEOMETRYTASK_H
@@ -0,0 +1,204 @@
+#include "gizmolatency.h"
+
+#include <QMutexLocker>
+#include <QQuickWindow>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr qint64 kUnmarked = -1;
+
+constexpr std::array<const char *, GizmoLatency::StageCount> kStageKeys{
+    "total", "delta", "forwarded", "applied", "geometry", "presented"};
+
+double percentileMs(const std::vector<qint64> &sorted, double p)
+{
+    const auto rank = qint64(std::ceil(p / 100.0 * double(sorted.size()))) - 1;
+    return sorted[size_t(std::max<qint64>(0, rank))] / 1.0e6;
+}
+
+} // namespace
+
+void GizmoLatency::History::add(qint64 ns)
+{
+    if (values.size() < kHistory) {
+        values.push_back(ns);
+    } else {
+        values[next] = ns;
+        next = (next + 1) % kHistory;
+    }
+}
+
+QVariantMap GizmoLatency::History::summary() const
+{
+    if (values.empty())
+        return {{QStringLiteral("count"), 0}};
+
+    std::vector<qint64> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    qint64 total = 0;
+    for (qint64 ns : sorted)
+        total += ns;
+    return {
+        {QStringLiteral("count"), int(sorted.size())},
+        {QStringLiteral("avg_ms"), total / 1.0e6 / double(sorted.size())},
+        {QStringLiteral("p50_ms"), percentileMs(sorted, 50)},
+        {QStringLiteral("p95_ms"), percentileMs(sorted, 95)},
+        {QStringLiteral("p99_ms"), percentileMs(sorted, 99)},
+        {QStringLiteral("max_ms"), sorted.back() / 1.0e6},
+    };
+}
+
+GizmoLatency::GizmoLatency(QObject *parent)
+    : QObject(parent)
+    , m_enabled(qEnvironmentVariableIntValue("GIZMO3D_LATENCY") != 0)
+{
+    m_clock.start();
+    m_pending.fill(kUnmarked);
+    m_inFlight.fill(kUnmarked);
+}
+
+bool GizmoLatency::enabled() const
+{
+    return m_enabled;
+}
+
+void GizmoLatency::setEnabled(bool enabled)
+{
+    if (m_enabled == enabled)
+        return;
+    m_enabled = enabled;
+    emit enabledChanged();
+}
+
+int GizmoLatency::sampleCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_samples;
+}
+
+QVariantMap GizmoLatency::stats() const
+{
+    QMutexLocker locker(&m_mutex);
+    QVariantMap summary = m_history[Input].summary();
+    summary.remove(QStringLiteral("avg_ms"));
+    summary.remove(QStringLiteral("max_ms"));
+    return summary;
+}
+
+void GizmoLatency::markInput(QQuickWindow *window)
+{
+    if (!m_enabled)
+        return;
+    trackWindow(window);
+
+    QMutexLocker locker(&m_mutex);
+    if (m_hasPending) {
+        ++m_coalesced;
+        return;
+    }
+    m_pending.fill(kUnmarked);
+    m_pending[Input] = m_clock.nsecsElapsed();
+    m_hasPending = true;
+}
+
+void GizmoLatency::mark(GizmoLatency::Stage stage)
+{
+    if (!m_enabled || stage <= Input || stage >= Presented)
+        return;
+
+    QMutexLocker locker(&m_mutex);
+    if (m_hasPending && m_pending[stage] == kUnmarked)
+        m_pending[stage] = m_clock.nsecsElapsed();
+}
+
+QVariantMap GizmoLatency::report() const
+{
+    QMutexLocker locker(&m_mutex);
+    QVariantMap stages;
+    for (int stage = 0; stage < StageCount; ++stage)
+        stages.insert(QLatin1StringView(kStageKeys[size_t(stage)]), m_history[size_t(stage)].summary());
+    return {
+        {QStringLiteral("samples"), m_samples},
+        {QStringLiteral("coalesced"), m_coalesced},
+        {QStringLiteral("dropped"), m_dropped},
+        {QStringLiteral("stages"), stages},
+    };
+}
+
+void GizmoLatency::reset()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_hasPending = false;
+        m_hasInFlight = false;
+        m_coalesced = 0;
+        m_dropped = 0;
+        m_samples = 0;
+        for (History &history : m_history) {
+            history.values.clear();
+            history.next = 0;
+        }
+    }
+    emit statsChanged();
+}
+
+void GizmoLatency::trackWindow(QQuickWindow *window)
+{
+    if (!window)
+        return;
+    for (const QPointer<QQuickWindow> &tracked : m_windows) {
+        if (tracked == window)
+            return;
+    }
+    m_windows.emplace_back(window);
+
+    // Direct connections: with the threaded render loop both arrive on the render thread.
+    // Synchronization runs while the GUI thread is blocked, so it cleanly separates the
+    // input that reaches this frame from input that arrives while it renders.
+    connect(window, &QQuickWindow::afterSynchronizing, this, &GizmoLatency::onSynchronized,
+            Qt::DirectConnection);
+    connect(window, &QQuickWindow::afterFrameEnd, this, &GizmoLatency::onFrameEnd,
+            Qt::DirectConnection);
+}
+
+void GizmoLatency::onSynchronized()
+{
+    QMutexLocker locker(&m_mutex);
+    if (!m_hasPending)
+        return;
+    m_hasPending = false;
+
+    // Input that moved nothing will never be presented
+    if (m_pending[Applied] == kUnmarked) {
+        ++m_dropped;
+        return;
+    }
+    m_inFlight = m_pending;
+    m_hasInFlight = true;
+}
+
+void GizmoLatency::onFrameEnd()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        if (!m_hasInFlight)
+            return;
+        m_hasInFlight = false;
+
+        m_inFlight[Presented] = m_clock.nsecsElapsed();
+        qint64 previous = m_inFlight[Input];
+        for (int stage = Delta; stage < StageCount; ++stage) {
+            const qint64 at = m_inFlight[size_t(stage)];
+            if (at == kUnmarked)
+                continue;
+            m_history[size_t(stage)].add(at - previous);
+            previous = at;
+        }
+        m_history[Input].add(m_inFlight[Presented] - m_inFlight[Input]);
+        ++m_samples;
+    }
+    QMetaObject::invokeMethod(this, &GizmoLatency::statsChanged, Qt::QueuedConnection);
+}
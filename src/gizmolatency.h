@@ -0,0 +1,119 @@
+#ifndef GIZMOLATENCY_H
+#define GIZMOLATENCY_H
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QObject>
+#include <QPointer>
+#include <QVariantMap>
+#include <QtQml/qqmlregistration.h>
+
+#include <array>
+#include <vector>
+
+class QQuickWindow;
+
+/**
+ * Input-to-present latency instrumentation
+ *
+ * Timestamps each stage of the drag path, from the pointer event in a gizmo's
+ * onPositionChanged to the frame that shows the moved target:
+ *
+ *   Input      - gizmo MouseArea receives a drag move
+ *   Delta      - gizmo has computed the delta and emits its signal
+ *   Forwarded  - GlobalGizmo re-emits the delta (absent for standalone gizmos)
+ *   Applied    - the controller has written the target's position/rotation/scale
+ *   Geometry   - the next gizmo geometry update has finished
+ *   Presented  - the window has submitted the frame (afterFrameEnd)
+ *
+ * A sample starts at the first Input after the previous frame; later moves before the
+ * next frame are counted as coalesced. Samples whose input changed nothing by the time
+ * the scene graph synchronizes are dropped. Each stage reports the time since the
+ * previous stage that was marked, plus the input-to-present total.
+ *
+ * Disabled by default (GIZMO3D_LATENCY=1 enables it at startup). When disabled the
+ * gizmos skip every mark, so the drag path pays one property read.
+ */
+class GizmoLatency : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_SINGLETON
+
+    Q_PROPERTY(bool enabled READ enabled WRITE setEnabled NOTIFY enabledChanged)
+    Q_PROPERTY(int sampleCount READ sampleCount NOTIFY statsChanged)
+    Q_PROPERTY(QVariantMap stats READ stats NOTIFY statsChanged)
+
+public:
+    enum Stage { Input, Delta, Forwarded, Applied, Geometry, Presented, StageCount };
+    Q_ENUM(Stage)
+
+    explicit GizmoLatency(QObject *parent = nullptr);
+
+    bool enabled() const;
+    void setEnabled(bool enabled);
+
+    // Samples recorded since the last reset (saturates at the history size)
+    int sampleCount() const;
+
+    // Live summary for overlays: {count, p50_ms, p95_ms, p99_ms} of the total latency
+    QVariantMap stats() const;
+
+    /**
+     * Marks a drag move and starts a sample if none is pending
+     * @param window - Window presenting the gizmo; its frame signals end the sample
+     */
+    Q_INVOKABLE void markInput(QQuickWindow *window);
+
+    // Marks a later stage of the pending sample (the first mark of each stage counts)
+    Q_INVOKABLE void mark(GizmoLatency::Stage stage);
+
+    /**
+     * Full report for benchmarks:
+     *   {samples, coalesced, dropped,
+     *    stages: {delta, forwarded, applied, geometry, presented, total:
+     *             {count, avg_ms, p50_ms, p95_ms, p99_ms, max_ms}}}
+     */
+    Q_INVOKABLE QVariantMap report() const;
+
+    Q_INVOKABLE void reset();
+
+signals:
+    void enabledChanged();
+    void statsChanged();
+
+private:
+    static constexpr size_t kHistory = 1024;
+
+    // Per-stage history ring buffer of nanosecond intervals
+    struct History
+    {
+        std::vector<qint64> values;
+        size_t next = 0;
+
+        void add(qint64 ns);
+        QVariantMap summary() const;
+    };
+
+    void trackWindow(QQuickWindow *window);
+    void onSynchronized();
+    void onFrameEnd();
+
+    bool m_enabled = false;
+    QElapsedTimer m_clock;
+    std::vector<QPointer<QQuickWindow>> m_windows;
+
+    // Guards everything below: marks come from the GUI thread, frame signals may come
+    // from the render thread
+    mutable QMutex m_mutex;
+    std::array<qint64, StageCount> m_pending{};
+    std::array<qint64, StageCount> m_inFlight{};
+    bool m_hasPending = false;
+    bool m_hasInFlight = false;
+    int m_coalesced = 0;
+    int m_dropped = 0;
+    int m_samples = 0;
+    std::array<History, StageCount> m_history;  // [Input] holds the totals
+};
+
+#endif // GIZMOLATENCY_H
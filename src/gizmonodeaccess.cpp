@@ -0,0 +1,86 @@
+#include "gizmonodeaccess.h"
+
+#include <QMatrix4x4>
+#include <QQuaternion>
+#include <QVector3D>
+
+#include <cstring>
+
+using gizmo3d::core::Quat;
+using gizmo3d::core::Vec3;
+
+namespace {
+
+Vec3 toVec3(const QVector3D &v)
+{
+    return {v.x(), v.y(), v.z()};
+}
+
+Quat toQuat(const QQuaternion &q)
+{
+    return {q.scalar(), q.x(), q.y(), q.z()};
+}
+
+} // namespace
+
+const GizmoNodeAccess::Properties &GizmoNodeAccess::propertiesOf(const QObject *node)
+{
+    const QMetaObject *meta = node->metaObject();
+    auto it = m_properties.find(meta);
+    if (it == m_properties.end()) {
+        Properties properties;
+        properties.position = meta->property(meta->indexOfProperty("position"));
+        properties.rotation = meta->property(meta->indexOfProperty("rotation"));
+        properties.scale = meta->property(meta->indexOfProperty("scale"));
+        it = m_properties.emplace(meta, properties).first;
+    }
+    return it->second;
+}
+
+void GizmoNodeAccess::write(QObject *node, const Properties &properties, int fields,
+                            const gizmo3d::core::NodeTransform &transform)
+{
+    if (fields & gizmo3d::core::PositionField) {
+        const Vec3 p = transform.position;
+        properties.position.write(node, QVariant::fromValue(QVector3D(p.x, p.y, p.z)));
+    }
+    if (fields & gizmo3d::core::RotationField) {
+        const Quat q = transform.rotation;
+        properties.rotation.write(node, QVariant::fromValue(QQuaternion(q.w, q.x, q.y, q.z)));
+    }
+    if (fields & gizmo3d::core::ScaleField) {
+        const Vec3 s = transform.scale;
+        properties.scale.write(node, QVariant::fromValue(QVector3D(s.x, s.y, s.z)));
+    }
+}
+
+gizmo3d::core::NodeTransform GizmoNodeAccess::transform(const QObject *node)
+{
+    gizmo3d::core::NodeTransform transform;
+    transform.position = toVec3(node->property("position").value<QVector3D>());
+    transform.rotation = toQuat(node->property("rotation").value<QQuaternion>());
+    transform.scale = toVec3(node->property("scale").value<QVector3D>());
+    return transform;
+}
+
+gizmo3d::core::NodeSnapshot GizmoNodeAccess::snapshot(const QObject *node)
+{
+    const gizmo3d::core::NodeTransform local = transform(node);
+    gizmo3d::core::NodeSnapshot snapshot;
+    snapshot.position = local.position;
+    snapshot.rotation = local.rotation;
+    snapshot.scale = local.scale;
+    snapshot.scenePosition = toVec3(node->property("scenePosition").value<QVector3D>());
+    snapshot.sceneRotation = toQuat(node->property("sceneRotation").value<QQuaternion>());
+
+    // Scene roots (and nodes parented to something that is not a Node) keep identity
+    const QObject *parent = node->property("parent").value<QObject *>();
+    const QVariant parentTransform = parent ? parent->property("sceneTransform") : QVariant();
+    if (parentTransform.isValid()) {
+        const QMatrix4x4 matrix = parentTransform.value<QMatrix4x4>();
+        std::memcpy(snapshot.parentSceneTransform.m, matrix.constData(),
+                    sizeof(snapshot.parentSceneTransform.m));
+        snapshot.parentSceneRotation = toQuat(parent->property("sceneRotation").value<QQuaternion>());
+    }
+    return snapshot;
+}
@@ -0,0 +1,47 @@
+#ifndef GIZMONODEACCESS_H
+#define GIZMONODEACCESS_H
+
+#include <QMetaProperty>
+#include <QObject>
+
+#include <unordered_map>
+
+#include "core/transformbatch.h"
+#include "core/transformhistory.h"
+
+/**
+ * Reads and writes Node transforms through the meta-object system
+ *
+ * The plugin does not use QtQuick3D's private API, so nodes are plain QObjects. Reads
+ * go through QObject::property(); writes use the position, rotation and scale
+ * QMetaProperty of the node's class, looked up once per class, so writing a large
+ * selection costs one property write per field and node.
+ */
+class GizmoNodeAccess
+{
+public:
+    struct Properties
+    {
+        QMetaProperty position;
+        QMetaProperty rotation;
+        QMetaProperty scale;
+    };
+
+    // Stays valid for the lifetime of this GizmoNodeAccess
+    const Properties &propertiesOf(const QObject *node);
+
+    // Writes the core::TransformField bits in fields
+    static void write(QObject *node, const Properties &properties, int fields,
+                      const gizmo3d::core::NodeTransform &transform);
+
+    static gizmo3d::core::NodeTransform transform(const QObject *node);
+
+    // Local and scene transforms, and the parent's scene transform
+    static gizmo3d::core::NodeSnapshot snapshot(const QObject *node);
+
+private:
+    // Node-based, so references handed out stay valid as classes are added
+    std::unordered_map<const QMetaObject *, Properties> m_properties;
+};
+
+#endif // GIZMONODEACCESS_H
@@ -0,0 +1,69 @@
+#ifndef GIZMOPARALLEL_H
+#define GIZMOPARALLEL_H
+
+#include <QSemaphore>
+#include <QThreadPool>
+
+#include <algorithm>
+#include <atomic>
+
+namespace gizmo3d {
+
+/**
+ * Runs fn(begin, end) over [0, count) in chunks spread across a thread pool
+ *
+ * Chunks are claimed from a shared atomic index, so fast threads take more work
+ * (self-balancing without per-thread queues). The calling thread claims chunks too
+ * and returns only after every chunk has finished. Helpers are started with
+ * tryStart(), so a saturated pool degrades to running on the calling thread
+ * instead of queuing behind unrelated work.
+ *
+ * @param pool - Pool providing helper threads (null runs everything inline)
+ * @param count - Number of items
+ * @param chunkSize - Items claimed per step (clamped to at least 1)
+ * @param fn - Callable taking (int begin, int end); must be safe to run concurrently
+ */
+template <typename Fn>
+void forEachChunk(QThreadPool *pool, int count, int chunkSize, Fn &&fn)
+{
+    if (count <= 0)
+        return;
+    chunkSize = std::max(chunkSize, 1);
+
+    const int chunkCount = (count + chunkSize - 1) / chunkSize;
+    const int helperCount = pool ? std::min(pool->maxThreadCount(), chunkCount - 1) : 0;
+    if (helperCount <= 0) {
+        fn(0, count);
+        return;
+    }
+
+    std::atomic<int> next{0};
+    auto drain = [&]() {
+        for (;;) {
+            const int begin = next.fetch_add(chunkSize, std::memory_order_relaxed);
+            if (begin >= count)
+                return;
+            fn(begin, std::min(begin + chunkSize, count));
+        }
+    };
+
+    QSemaphore finished;
+    int started = 0;
+    for (int i = 0; i < helperCount; ++i) {
+        const bool ok = pool->tryStart([&]() {
+            drain();
+            finished.release();
+        });
+        if (!ok)
+            break;
+        ++started;
+    }
+
+    drain();
+    // Helpers reference this stack frame; wait for all of them before returning
+    finished.acquire(started);
+}
+
+} // namespace gizmo3d
+
+#endif // GIZMOPARALLEL_H
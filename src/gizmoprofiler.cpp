@@ -0,0 +1,248 @@
+#include "gizmoprofiler.h"
+
+#include "gizmotrace.h"
+
+#include <QJSEngine>
+#include <QQuickWindow>
+
+#include <algorithm>
+
+GizmoProfiler::GizmoProfiler(QObject *parent)
+    : QObject(parent)
+{
+#ifdef GIZMO3D_PROFILING
+    m_clock.start();
+    bool set = false;
+    const int profile = qEnvironmentVariableIntValue("GIZMO3D_PROFILE", &set);
+#ifdef GIZMO3D_TRACING
+    // The tracepoints sit behind the same QML guards as the timings
+    m_enabled = !set || profile != 0;
+#else
+    m_enabled = set && profile != 0;
+#endif
+#endif
+}
+
+GizmoProfiler *GizmoProfiler::instance()
+{
+    static GizmoProfiler *profiler = new GizmoProfiler;
+    return profiler;
+}
+
+GizmoProfiler *GizmoProfiler::create(QQmlEngine *, QJSEngine *)
+{
+    GizmoProfiler *profiler = instance();
+    // Shared by every engine and by native code, so no engine may delete it
+    QJSEngine::setObjectOwnership(profiler, QJSEngine::CppOwnership);
+    return profiler;
+}
+
+bool GizmoProfiler::isEnabled() const
+{
+    return m_enabled;
+}
+
+void GizmoProfiler::setEnabled(bool enabled)
+{
+    if (!isAvailable() || m_enabled == enabled)
+        return;
+    m_enabled = enabled;
+    emit enabledChanged();
+}
+
+int GizmoProfiler::historySize() const
+{
+    return m_historySize;
+}
+
+void GizmoProfiler::setHistorySize(int size)
+{
+    size = qMax(1, size);
+    if (m_historySize == size)
+        return;
+    m_historySize = size;
+    reset();
+    emit historySizeChanged();
+}
+
+#ifdef GIZMO3D_PROFILING
+
+namespace {
+
+constexpr std::array<const char *, GizmoProfiler::StageCount> kStageKeys{
+    "dirtyCheck", "projection", "geometryBuild", "hitTest", "dragSolve", "signalEmit"};
+constexpr std::array<const char *, GizmoProfiler::CounterCount> kCounterKeys{
+    "projections", "pointsGenerated", "skippedUpdates", "geometryUpdates"};
+
+constexpr qint64 kNotifyIntervalNs = 250 * 1000 * 1000;
+
+} // namespace
+
+int GizmoProfiler::frameCount() const
+{
+    return int(m_history.size());
+}
+
+qint64 GizmoProfiler::enter(Stage stage, const QObject *gizmo, int mode)
+{
+    GIZMO3D_TRACE_ENTER(stage, gizmo, mode);
+    return m_enabled ? m_clock.nsecsElapsed() : -1;
+}
+
+void GizmoProfiler::leave(Stage stage, qint64 start)
+{
+    GIZMO3D_TRACE_LEAVE(stage);
+    if (start >= 0)
+        addTime(stage, m_clock.nsecsElapsed() - start);
+}
+
+double GizmoProfiler::begin(GizmoProfiler::Stage stage, QObject *gizmo, int mode)
+{
+    if (!m_enabled)
+        return 0.0;
+    // Never 0, so QML can use the token as its own enabled flag
+    return double(enter(stage, gizmo, mode) + 1);
+}
+
+void GizmoProfiler::end(GizmoProfiler::Stage stage, double token)
+{
+    if (token > 0.0)
+        leave(stage, qint64(token) - 1);
+}
+
+void GizmoProfiler::addTime(Stage stage, qint64 ns)
+{
+    if (m_enabled && stage >= 0 && stage < StageCount)
+        m_current.ns[size_t(stage)] += ns;
+}
+
+void GizmoProfiler::count(GizmoProfiler::Counter counter, int amount)
+{
+    if (m_enabled && counter >= 0 && counter < CounterCount) {
+        m_current.counts[size_t(counter)] += amount;
+        GIZMO3D_TRACE_COUNT(counter, amount);
+    }
+}
+
+void GizmoProfiler::attach(QQuickWindow *window)
+{
+    if (!window)
+        return;
+    for (const QPointer<QQuickWindow> &attached : m_windows) {
+        if (attached == window)
+            return;
+    }
+    m_windows.emplace_back(window);
+    // Emitted on the GUI thread once per frame, after input and FrameAnimations ran
+    connect(window, &QQuickWindow::afterAnimating, this, &GizmoProfiler::endFrame);
+}
+
+void GizmoProfiler::endFrame()
+{
+    if (!m_enabled)
+        return;
+
+    GIZMO3D_TRACE_FRAME(m_frameIndex++);
+    if (m_history.size() < size_t(m_historySize)) {
+        m_history.push_back(m_current);
+    } else {
+        m_history[m_next] = m_current;
+        m_next = (m_next + 1) % m_history.size();
+    }
+    m_current = Frame();
+
+    const qint64 time = m_clock.nsecsElapsed();
+    if (time - m_lastNotify >= kNotifyIntervalNs) {
+        m_lastNotify = time;
+        emit updated();
+    }
+}
+
+QVariantMap GizmoProfiler::summary() const
+{
+    QVariantMap stages;
+    QVariantMap counters;
+    if (!m_history.empty()) {
+        const Frame &last = m_history[(m_next + m_history.size() - 1) % m_history.size()];
+        const double frames = double(m_history.size());
+
+        for (int stage = 0; stage < StageCount; ++stage) {
+            qint64 total = 0;
+            qint64 max = 0;
+            for (const Frame &frame : m_history) {
+                total += frame.ns[size_t(stage)];
+                max = std::max(max, frame.ns[size_t(stage)]);
+            }
+            stages.insert(QLatin1StringView(kStageKeys[size_t(stage)]), QVariantMap{
+                {QStringLiteral("avg_ms"), total / 1.0e6 / frames},
+                {QStringLiteral("max_ms"), max / 1.0e6},
+                {QStringLiteral("last_ms"), last.ns[size_t(stage)] / 1.0e6},
+            });
+        }
+
+        for (int counter = 0; counter < CounterCount; ++counter) {
+            qint64 total = 0;
+            int max = 0;
+            for (const Frame &frame : m_history) {
+                total += frame.counts[size_t(counter)];
+                max = std::max(max, frame.counts[size_t(counter)]);
+            }
+            counters.insert(QLatin1StringView(kCounterKeys[size_t(counter)]), QVariantMap{
+                {QStringLiteral("avg"), double(total) / frames},
+                {QStringLiteral("max"), max},
+                {QStringLiteral("last"), last.counts[size_t(counter)]},
+            });
+        }
+    }
+
+    return {
+        {QStringLiteral("frames"), int(m_history.size())},
+        {QStringLiteral("stages"), stages},
+        {QStringLiteral("counters"), counters},
+    };
+}
+
+QVariantList GizmoProfiler::frames() const
+{
+    QVariantList result;
+    result.reserve(qsizetype(m_history.size()));
+    for (size_t i = 0; i < m_history.size(); ++i) {
+        const Frame &frame = m_history[(m_next + i) % m_history.size()];
+        QVariantMap stages;
+        for (int stage = 0; stage < StageCount; ++stage)
+            stages.insert(QLatin1StringView(kStageKeys[size_t(stage)]), frame.ns[size_t(stage)] / 1.0e6);
+        QVariantMap counters;
+        for (int counter = 0; counter < CounterCount; ++counter)
+            counters.insert(QLatin1StringView(kCounterKeys[size_t(counter)]), frame.counts[size_t(counter)]);
+        result.append(QVariantMap{
+            {QStringLiteral("stages"), stages},
+            {QStringLiteral("counters"), counters},
+        });
+    }
+    return result;
+}
+
+void GizmoProfiler::reset()
+{
+    m_current = Frame();
+    m_history.clear();
+    m_next = 0;
+    emit updated();
+}
+
+#else
+
+int GizmoProfiler::frameCount() const { return 0; }
+qint64 GizmoProfiler::enter(Stage, const QObject *, int) { return -1; }
+void GizmoProfiler::leave(Stage, qint64) {}
+double GizmoProfiler::begin(GizmoProfiler::Stage, QObject *, int) { return 0.0; }
+void GizmoProfiler::end(GizmoProfiler::Stage, double) {}
+void GizmoProfiler::addTime(Stage, qint64) {}
+void GizmoProfiler::count(GizmoProfiler::Counter, int) {}
+void GizmoProfiler::attach(QQuickWindow *) {}
+void GizmoProfiler::endFrame() {}
+QVariantMap GizmoProfiler::summary() const { return {{QStringLiteral("frames"), 0}}; }
+QVariantList GizmoProfiler::frames() const { return {}; }
+void GizmoProfiler::reset() {}
+
+#endif
@@ -0,0 +1,187 @@
+#ifndef GIZMOPROFILER_H
+#define GIZMOPROFILER_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QPointer>
+#include <QVariantList>
+#include <QVariantMap>
+#include <QtQml/qqmlregistration.h>
+
+#include <array>
+#include <vector>
+
+class QJSEngine;
+class QQmlEngine;
+class QQuickWindow;
+
+/**
+ * Per-frame profiling of the gizmo pipeline
+ *
+ * The gizmos report stage timings and counters into this singleton. A frame closes on
+ * each afterAnimating of an attached window (GizmoStatsOverlay attaches its own), or
+ * on endFrame() for drivers without one. The last historySize frames are kept in a
+ * ring buffer and summarized for overlays and benchmarks.
+ *
+ * Stages:
+ *   DirtyCheck     - classifying camera/target changes (GizmoDirtyState)
+ *   Projection     - building the frame's projector and frame context
+ *   GeometryBuild  - the geometry calculators (or the native compute)
+ *   HitTest        - getHitRegion / getHitAxis
+ *   DragSolve      - ray math and snapping in a drag move
+ *   SignalEmit     - emitting a delta, which includes the controller's handler
+ *
+ * Counters: Projections (projectors built), PointsGenerated (screen points produced),
+ * SkippedUpdates (frames the dirty check skipped) and GeometryUpdates.
+ *
+ * Built without GIZMO3D_PROFILING the class keeps its QML API, reports available as
+ * false and every method is empty; native call sites use the GIZMO3D_PROFILE_* macros,
+ * which then expand to nothing. QML call sites are guarded by GizmoProfiler.enabled,
+ * so at runtime a disabled profiler costs one property read per site.
+ *
+ * Built with GIZMO3D_TRACING every timed stage is also emitted as a Q_TRACE
+ * entry/exit pair tagged with the gizmo and its mode (see gizmotrace.h), and the
+ * profiler starts enabled unless GIZMO3D_PROFILE=0.
+ *
+ * GUI thread only.
+ */
+class GizmoProfiler : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_SINGLETON
+
+    Q_PROPERTY(bool available READ isAvailable CONSTANT)
+    Q_PROPERTY(bool enabled READ isEnabled WRITE setEnabled NOTIFY enabledChanged)
+    Q_PROPERTY(int historySize READ historySize WRITE setHistorySize NOTIFY historySizeChanged)
+    Q_PROPERTY(int frameCount READ frameCount NOTIFY updated)
+
+public:
+    enum Stage { DirtyCheck, Projection, GeometryBuild, HitTest, DragSolve, SignalEmit, StageCount };
+    Q_ENUM(Stage)
+
+    enum Counter { Projections, PointsGenerated, SkippedUpdates, GeometryUpdates, CounterCount };
+    Q_ENUM(Counter)
+
+    // Process-wide instance shared by QML engines and native call sites
+    static GizmoProfiler *instance();
+    static GizmoProfiler *create(QQmlEngine *qmlEngine, QJSEngine *jsEngine);
+
+    static constexpr bool isAvailable()
+    {
+#ifdef GIZMO3D_PROFILING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool isEnabled() const;
+    void setEnabled(bool enabled);
+    int historySize() const;
+    void setHistorySize(int size);
+
+    // Frames in the history
+    int frameCount() const;
+
+    /**
+     * Starts timing a stage
+     * @param stage - Stage the matching end() closes
+     * @param gizmo - Gizmo the work belongs to, for the trace
+     * @param mode - The gizmo's GizmoEnums.Mode, for the trace
+     * @returns Token for end(), 0 when disabled
+     */
+    Q_INVOKABLE double begin(GizmoProfiler::Stage stage, QObject *gizmo = nullptr, int mode = -1);
+
+    // Adds the time since begin() to the stage of the current frame
+    Q_INVOKABLE void end(GizmoProfiler::Stage stage, double token);
+
+    Q_INVOKABLE void count(GizmoProfiler::Counter counter, int amount = 1);
+
+    // Closes a frame on every afterAnimating of the window
+    Q_INVOKABLE void attach(QQuickWindow *window);
+
+    // Closes the current frame
+    Q_INVOKABLE void endFrame();
+
+    /**
+     * Summary of the history:
+     *   {frames, stages: {dirtyCheck, ...: {avg_ms, max_ms, last_ms}},
+     *    counters: {projections, ...: {avg, max, last}}}
+     */
+    Q_INVOKABLE QVariantMap summary() const;
+
+    // The history, oldest first: [{stages: {name: ms}, counters: {name: n}}]
+    Q_INVOKABLE QVariantList frames() const;
+
+    Q_INVOKABLE void reset();
+
+    // Native call sites (see GIZMO3D_PROFILE_SCOPE and GIZMO3D_PROFILE_TIME).
+    // enter() returns the start time, or -1 when disabled
+    qint64 enter(Stage stage, const QObject *gizmo = nullptr, int mode = -1);
+    void leave(Stage stage, qint64 start);
+    void addTime(Stage stage, qint64 ns);
+
+signals:
+    void enabledChanged();
+    void historySizeChanged();
+    // Emitted at most every 250 ms while frames close
+    void updated();
+
+private:
+    explicit GizmoProfiler(QObject *parent = nullptr);
+
+    struct Frame
+    {
+        std::array<qint64, StageCount> ns{};
+        std::array<int, CounterCount> counts{};
+    };
+
+    bool m_enabled = false;
+    int m_historySize = 240;
+#ifdef GIZMO3D_PROFILING
+    QElapsedTimer m_clock;
+    qint64 m_lastNotify = 0;
+    Frame m_current;
+    std::vector<Frame> m_history;
+    size_t m_next = 0;
+    int m_frameIndex = 0;
+    std::vector<QPointer<QQuickWindow>> m_windows;
+#endif
+};
+
+#ifdef GIZMO3D_PROFILING
+
+// Times the enclosing scope into a GizmoProfiler stage
+class GizmoProfileScope
+{
+public:
+    explicit GizmoProfileScope(GizmoProfiler::Stage stage)
+        : m_stage(stage)
+        , m_start(GizmoProfiler::instance()->enter(stage))
+    {
+    }
+    ~GizmoProfileScope() { GizmoProfiler::instance()->leave(m_stage, m_start); }
+
+private:
+    GizmoProfiler::Stage m_stage;
+    qint64 m_start;
+};
+
+#define GIZMO3D_PROFILE_CONCAT_(a, b) a##b
+#define GIZMO3D_PROFILE_CONCAT(a, b) GIZMO3D_PROFILE_CONCAT_(a, b)
+#define GIZMO3D_PROFILE_SCOPE(stage) \
+    GizmoProfileScope GIZMO3D_PROFILE_CONCAT(gizmoProfileScope, __LINE__)(GizmoProfiler::stage)
+#define GIZMO3D_PROFILE_TIME(stage, ns) GizmoProfiler::instance()->addTime(GizmoProfiler::stage, ns)
+#define GIZMO3D_PROFILE_COUNT(counter, amount) \
+    GizmoProfiler::instance()->count(GizmoProfiler::counter, amount)
+
+#else
+
+#define GIZMO3D_PROFILE_SCOPE(stage) static_cast<void>(0)
+#define GIZMO3D_PROFILE_TIME(stage, ns) static_cast<void>(0)
+#define GIZMO3D_PROFILE_COUNT(counter, amount) static_cast<void>(0)
+
+#endif
+
+#endif // GIZMOPROFILER_H
@@ -0,0 +1,243 @@
+#include "gizmoprojector.h"
+
+#include <QMetaProperty>
+#include <QtMath>
+
+#include <cstring>
+
+namespace {
+
+// Camera properties whose changes alter the projection
+constexpr const char *kCameraProperties[] = {
+    "sceneTransform",
+    "fieldOfView",
+    "fieldOfViewOrientation",
+    "clipNear",
+    "clipFar",
+    "horizontalMagnification",
+    "verticalMagnification",
+};
+
+// Matches QQuick3DPerspectiveCamera::FieldOfViewOrientation
+constexpr int kHorizontalFieldOfView = 1;
+
+QMetaMethod notifySignalOf(const QObject *object, const char *name)
+{
+    const QMetaObject *meta = object->metaObject();
+    const int index = meta->indexOfProperty(name);
+    if (index < 0)
+        return {};
+    return meta->property(index).notifySignal();
+}
+
+float floatProperty(const QObject *object, const char *name, float fallback)
+{
+    bool ok = false;
+    const float value = object->property(name).toFloat(&ok);
+    return ok ? value : fallback;
+}
+
+gizmo3d::core::Vec3 toCore(const QVector3D &v)
+{
+    return {v.x(), v.y(), v.z()};
+}
+
+QVector3D toQt(const gizmo3d::core::Vec3 &v)
+{
+    return QVector3D(v.x, v.y, v.z);
+}
+
+} // namespace
+
+GizmoProjector::GizmoProjector(QQuickItem *view3d, QObject *parent)
+    : QObject(parent)
+    , m_view(view3d)
+{
+    if (!view3d)
+        return;
+
+    connect(view3d, &QQuickItem::widthChanged, this, &GizmoProjector::invalidate);
+    connect(view3d, &QQuickItem::heightChanged, this, &GizmoProjector::invalidate);
+
+    const QMetaMethod cameraChanged = notifySignalOf(view3d, "camera");
+    if (cameraChanged.isValid()) {
+        const QMetaMethod rebind = metaObject()->method(
+            metaObject()->indexOfSlot("rebindCamera()"));
+        connect(view3d, cameraChanged, this, rebind);
+    }
+
+    rebindCamera();
+}
+
+QQuickItem *GizmoProjector::view3d() const
+{
+    return m_view;
+}
+
+bool GizmoProjector::captureSnapshot(QQuickItem *view3d, gizmo3d::core::CameraSnapshot *snapshot)
+{
+    if (!view3d || !snapshot)
+        return false;
+
+    QObject *camera = view3d->property("camera").value<QObject *>();
+    if (!camera)
+        return false;
+
+    const QMatrix4x4 cameraTransform = camera->property("sceneTransform").value<QMatrix4x4>();
+    snapshot->position = toCore(cameraTransform.column(3).toVector3D());
+    // Qt Quick 3D cameras look down their local -Z axis
+    snapshot->forward = toCore(-cameraTransform.column(2).toVector3D().normalized());
+
+    // FrustumCamera derives from PerspectiveCamera but uses an off-center frustum,
+    // so only plain perspective and orthographic lenses can be reproduced natively
+    const bool orthographic = camera->inherits("QQuick3DOrthographicCamera");
+    const bool perspective = camera->inherits("QQuick3DPerspectiveCamera")
+        && !camera->inherits("QQuick3DFrustumCamera");
+    snapshot->orthographic = orthographic;
+
+    const float width = float(view3d->width());
+    const float height = float(view3d->height());
+    if ((!orthographic && !perspective) || width <= 0.0f || height <= 0.0f)
+        return false;
+
+    snapshot->viewportWidth = width;
+    snapshot->viewportHeight = height;
+    snapshot->clipNear = floatProperty(camera, "clipNear", 10.0f);
+    const float clipFar = floatProperty(camera, "clipFar", 10000.0f);
+
+    QMatrix4x4 projection;
+    if (orthographic) {
+        const float halfWidth = width / (2.0f * floatProperty(camera, "horizontalMagnification", 1.0f));
+        const float halfHeight = height / (2.0f * floatProperty(camera, "verticalMagnification", 1.0f));
+        projection.ortho(-halfWidth, halfWidth, -halfHeight, halfHeight, snapshot->clipNear, clipFar);
+    } else {
+        const float aspect = width / height;
+        float verticalFov = floatProperty(camera, "fieldOfView", 60.0f);
+        if (camera->property("fieldOfViewOrientation").toInt() == kHorizontalFieldOfView)
+            verticalFov = qRadiansToDegrees(
+                2.0f * std::atan(std::tan(qDegreesToRadians(verticalFov) / 2.0f) / aspect));
+        projection.perspective(verticalFov, aspect, snapshot->clipNear, clipFar);
+    }
+
+    const QMatrix4x4 viewProjection = projection * cameraTransform.inverted();
+    std::memcpy(snapshot->viewProjection.m, viewProjection.constData(),
+                sizeof(snapshot->viewProjection.m));
+    return true;
+}
+
+void GizmoProjector::invalidate()
+{
+    m_dirty = true;
+}
+
+void GizmoProjector::rebindCamera()
+{
+    for (const QMetaObject::Connection &connection : std::as_const(m_cameraConnections))
+        disconnect(connection);
+    m_cameraConnections.clear();
+
+    m_camera = m_view ? m_view->property("camera").value<QObject *>() : nullptr;
+    invalidate();
+
+    if (!m_camera)
+        return;
+
+    const QMetaMethod invalidateSlot = metaObject()->method(
+        metaObject()->indexOfSlot("invalidate()"));
+    for (const char *name : kCameraProperties) {
+        const QMetaMethod signal = notifySignalOf(m_camera, name);
+        if (signal.isValid())
+            m_cameraConnections.append(connect(m_camera, signal, this, invalidateSlot));
+    }
+    m_cameraConnections.append(
+        connect(m_camera, &QObject::destroyed, this, &GizmoProjector::invalidate));
+}
+
+void GizmoProjector::ensureMatrices() const
+{
+    if (!m_dirty)
+        return;
+    m_dirty = false;
+
+    m_valid = m_camera && captureSnapshot(m_view, &m_snapshot);
+    if (!m_valid)
+        return;
+
+    QMatrix4x4 viewProjection;
+    std::memcpy(viewProjection.data(), m_snapshot.viewProjection.m, sizeof(m_snapshot.viewProjection.m));
+    m_inverseViewProjection = viewProjection.inverted();
+}
+
+QVector3D GizmoProjector::projectWorldToScreen(const QVector3D &worldPos) const
+{
+    ensureMatrices();
+    if (!m_valid) {
+        QVector3D result;
+        if (m_view)
+            QMetaObject::invokeMethod(m_view, "mapFrom3DScene",
+                                      Q_RETURN_ARG(QVector3D, result),
+                                      Q_ARG(QVector3D, worldPos));
+        return result;
+    }
+
+    // z matches View3D.mapFrom3DScene: distance in front of the near clip plane
+    return toQt(m_snapshot.project(toCore(worldPos)));
+}
+
+QVector3D GizmoProjector::nearPlanePoint(const QPointF &screenPos) const
+{
+    const float ndcX = 2.0f * float(screenPos.x()) / m_snapshot.viewportWidth - 1.0f;
+    const float ndcY = 1.0f - 2.0f * float(screenPos.y()) / m_snapshot.viewportHeight;
+    return m_inverseViewProjection.map(QVector3D(ndcX, ndcY, -1.0f));
+}
+
+QVector3D GizmoProjector::projectScreenToWorld(const QPointF &screenPos) const
+{
+    ensureMatrices();
+    if (!m_valid) {
+        QVector3D result;
+        if (m_view)
+            QMetaObject::invokeMethod(m_view, "mapTo3DScene",
+                                      Q_RETURN_ARG(QVector3D, result),
+                                      Q_ARG(QVector3D, QVector3D(float(screenPos.x()),
+                                                                 float(screenPos.y()), 0.0f)));
+        return result;
+    }
+    return nearPlanePoint(screenPos);
+}
+
+QVariantMap GizmoProjector::getCameraRay(const QPointF &screenPos) const
+{
+    const QVector3D nearWorld = projectScreenToWorld(screenPos);
+    const QVector3D cameraPosition = toQt(m_snapshot.position);
+
+    // Orthographic rays are all parallel to the view direction: each pixel's ray
+    // starts at its own point on the near plane, not at the camera position
+    if (isOrthographic())
+        return {{QStringLiteral("origin"), nearWorld},
+                {QStringLiteral("direction"), toQt(m_snapshot.forward)}};
+
+    QVector3D direction = nearWorld - cameraPosition;
+    if (direction.length() > 0.0001f)
+        direction.normalize();
+    return {{QStringLiteral("origin"), cameraPosition},
+            {QStringLiteral("direction"), direction}};
+}
+
+QVector3D GizmoProjector::getCameraPosition() const
+{
+    ensureMatrices();
+    return toQt(m_snapshot.position);
+}
+
+QVector3D GizmoProjector::getCameraForward() const
+{
+    ensureMatrices();
+    return toQt(m_snapshot.forward);
+}
+
+bool GizmoProjector::isOrthographic() const
+{
+    ensureMatrices();
+    return m_camera && m_snapshot.orthographic;
+}
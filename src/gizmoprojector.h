@@ -0,0 +1,79 @@
+#ifndef GIZMOPROJECTOR_H
+#define GIZMOPROJECTOR_H
+
+#include <QMatrix4x4>
+#include <QMetaObject>
+#include <QObject>
+#include <QPointF>
+#include <QPointer>
+#include <QQuickItem>
+#include <QVariantMap>
+#include <QVector3D>
+#include <QtQml/qqmlregistration.h>
+
+#include "core/camerasnapshot.h"
+
+/**
+ * Native projector for one View3D
+ *
+ * Implements the GizmoProjection interface (projectWorldToScreen, getCameraRay, ...)
+ * with matrices built from the view's camera properties, so projecting a point is a
+ * single matrix multiply instead of a call through View3D.mapFrom3DScene().
+ *
+ * The matrices are rebuilt lazily: any change of the camera transform, lens
+ * parameters, active camera or view size only marks them dirty. Cameras whose
+ * projection is not a plain perspective/orthographic lens (FrustumCamera,
+ * CustomCamera) fall back to View3D's own mapping functions.
+ *
+ * Instances are owned by GizmoProjectorCache; obtain them through
+ * View3DProjectionAdapter.createProjector(). captureSnapshot() builds the same
+ * projection as an immutable core::CameraSnapshot for native geometry jobs.
+ */
+class GizmoProjector : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("GizmoProjector is obtained from View3DProjectionAdapter.createProjector()")
+
+    Q_PROPERTY(QQuickItem *view3d READ view3d CONSTANT)
+
+public:
+    explicit GizmoProjector(QQuickItem *view3d, QObject *parent = nullptr);
+
+    QQuickItem *view3d() const;
+
+    /**
+     * Captures a view's projection from its camera properties (GUI thread only)
+     * @returns false when the view has no camera, no size, or a camera without a plain
+     *          perspective/orthographic lens
+     */
+    static bool captureSnapshot(QQuickItem *view3d, gizmo3d::core::CameraSnapshot *snapshot);
+
+    Q_INVOKABLE QVector3D projectWorldToScreen(const QVector3D &worldPos) const;
+    Q_INVOKABLE QVector3D projectScreenToWorld(const QPointF &screenPos) const;
+    Q_INVOKABLE QVariantMap getCameraRay(const QPointF &screenPos) const;
+    Q_INVOKABLE QVector3D getCameraPosition() const;
+    Q_INVOKABLE QVector3D getCameraForward() const;
+    Q_INVOKABLE bool isOrthographic() const;
+
+public slots:
+    void invalidate();
+
+private slots:
+    void rebindCamera();
+
+private:
+    void ensureMatrices() const;
+    QVector3D nearPlanePoint(const QPointF &screenPos) const;
+
+    QPointer<QQuickItem> m_view;
+    QPointer<QObject> m_camera;
+    QList<QMetaObject::Connection> m_cameraConnections;
+
+    mutable bool m_dirty = true;
+    mutable bool m_valid = false;
+    mutable gizmo3d::core::CameraSnapshot m_snapshot;
+    mutable QMatrix4x4 m_inverseViewProjection;
+};
+
+#endif // GIZMOPROJECTOR_H
@@ -0,0 +1,44 @@
+#include "gizmoprojectorcache.h"
+
+#include "gizmoprojector.h"
+
+#include <QQmlEngine>
+
+GizmoProjectorCache::GizmoProjectorCache(QObject *parent)
+    : QObject(parent)
+{
+}
+
+GizmoProjector *GizmoProjectorCache::projectorFor(QQuickItem *view3d)
+{
+    if (!view3d)
+        return nullptr;
+
+    auto it = m_projectors.constFind(view3d);
+    if (it != m_projectors.constEnd())
+        return it.value();
+
+    auto *projector = new GizmoProjector(view3d, this);
+    // The cache owns projectors; QML must never garbage-collect one it was handed
+    QQmlEngine::setObjectOwnership(projector, QQmlEngine::CppOwnership);
+
+    m_projectors.insert(view3d, projector);
+    connect(view3d, &QObject::destroyed, this, &GizmoProjectorCache::evict);
+    emit countChanged();
+    return projector;
+}
+
+int GizmoProjectorCache::count() const
+{
+    return int(m_projectors.size());
+}
+
+void GizmoProjectorCache::evict(QObject *view3d)
+{
+    GizmoProjector *projector = m_projectors.take(view3d);
+    if (!projector)
+        return;
+
+    delete projector;
+    emit countChanged();
+}
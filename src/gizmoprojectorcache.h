@@ -0,0 +1,46 @@
+#ifndef GIZMOPROJECTORCACHE_H
+#define GIZMOPROJECTORCACHE_H
+
+#include <QHash>
+#include <QObject>
+#include <QQuickItem>
+#include <QtQml/qqmlregistration.h>
+
+class GizmoProjector;
+
+/**
+ * Keyed projector cache: one GizmoProjector per View3D
+ *
+ * Multi-view editors alternate between views every frame, which defeated the old
+ * single-slot cache. Entries live as long as their view: a projector invalidates
+ * itself on camera or viewport changes and is evicted when its view is destroyed.
+ */
+class GizmoProjectorCache : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_SINGLETON
+
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+
+public:
+    explicit GizmoProjectorCache(QObject *parent = nullptr);
+
+    /**
+     * Returns the cached projector for a view, creating it on first use
+     * @param view3d - View3D item (null returns null)
+     */
+    Q_INVOKABLE GizmoProjector *projectorFor(QQuickItem *view3d);
+
+    int count() const;
+
+signals:
+    void countChanged();
+
+private:
+    void evict(QObject *view3d);
+
+    QHash<QObject *, GizmoProjector *> m_projectors;
+};
+
+#endif // GIZMOPROJECTORCACHE_H
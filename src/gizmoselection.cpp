@@ -0,0 +1,238 @@
+#include "gizmoselection.h"
+
+#include <QMetaMethod>
+#include <QMetaProperty>
+
+#include <vector>
+
+namespace {
+
+QMetaMethod notifySignalOf(const QObject *object, const char *name)
+{
+    const QMetaObject *meta = object->metaObject();
+    const int index = meta->indexOfProperty(name);
+    if (index < 0)
+        return {};
+    return meta->property(index).notifySignal();
+}
+
+gizmo3d::core::Vec3 scenePositionOf(const QObject *node)
+{
+    const QVector3D p = node->property("scenePosition").value<QVector3D>();
+    return {p.x(), p.y(), p.z()};
+}
+
+GizmoSelection *selectionOf(QQmlListProperty<QObject> *list)
+{
+    return static_cast<GizmoSelection *>(list->object);
+}
+
+} // namespace
+
+GizmoSelection::GizmoSelection(QObject *parent)
+    : QObject(parent)
+{
+}
+
+QQmlListProperty<QObject> GizmoSelection::nodes()
+{
+    return QQmlListProperty<QObject>(this, nullptr, &appendNode, &nodeCount, &nodeAt,
+                                     &clearNodes, &replaceNode, &removeLastNode);
+}
+
+QList<QObject *> GizmoSelection::nodeList() const
+{
+    ensureTracked();
+    return m_tracked;
+}
+
+void GizmoSelection::setNodeList(const QList<QObject *> &nodes)
+{
+    m_nodes = nodes;
+    nodesEdited();
+}
+
+int GizmoSelection::count() const
+{
+    ensureTracked();
+    return int(m_tracked.size());
+}
+
+GizmoSelection::PivotMode GizmoSelection::pivotMode() const
+{
+    return m_pivotMode;
+}
+
+void GizmoSelection::setPivotMode(PivotMode mode)
+{
+    if (m_pivotMode == mode)
+        return;
+    m_pivotMode = mode;
+    emit pivotModeChanged();
+    scheduleFlush();
+}
+
+QVector3D GizmoSelection::pivot() const
+{
+    ensureTracked();
+    const gizmo3d::core::Vec3 p = m_pivot.pivot(gizmo3d::core::PivotMode(m_pivotMode));
+    return QVector3D(p.x, p.y, p.z);
+}
+
+QQuaternion GizmoSelection::pivotRotation() const
+{
+    ensureTracked();
+    return m_tracked.isEmpty() ? QQuaternion()
+                               : m_tracked.first()->property("sceneRotation").value<QQuaternion>();
+}
+
+const gizmo3d::core::SelectionPivot &GizmoSelection::pivotState() const
+{
+    ensureTracked();
+    return m_pivot;
+}
+
+void GizmoSelection::nodeMoved()
+{
+    // A stale set is re-read from scratch on the next track()
+    const qsizetype index = m_trackingStale ? -1 : m_indexOf.value(sender(), -1);
+    if (index < 0) {
+        scheduleFlush();
+        return;
+    }
+    m_pivot.move(size_t(index), scenePositionOf(sender()));
+    scheduleFlush();
+}
+
+void GizmoSelection::nodeRotated()
+{
+    scheduleFlush();
+}
+
+void GizmoSelection::nodeDestroyed(QObject *node)
+{
+    // Connections of a destroyed node are gone already; only the lists refer to it
+    m_nodes.removeAll(node);
+    m_tracked.removeAll(node);
+    m_indexOf.remove(node);
+    nodesEdited();
+}
+
+void GizmoSelection::appendNode(QQmlListProperty<QObject> *list, QObject *node)
+{
+    GizmoSelection *selection = selectionOf(list);
+    selection->m_nodes.append(node);
+    selection->nodesEdited();
+}
+
+qsizetype GizmoSelection::nodeCount(QQmlListProperty<QObject> *list)
+{
+    return selectionOf(list)->m_nodes.size();
+}
+
+QObject *GizmoSelection::nodeAt(QQmlListProperty<QObject> *list, qsizetype index)
+{
+    return selectionOf(list)->m_nodes.value(index);
+}
+
+void GizmoSelection::clearNodes(QQmlListProperty<QObject> *list)
+{
+    GizmoSelection *selection = selectionOf(list);
+    selection->m_nodes.clear();
+    selection->nodesEdited();
+}
+
+void GizmoSelection::replaceNode(QQmlListProperty<QObject> *list, qsizetype index, QObject *node)
+{
+    GizmoSelection *selection = selectionOf(list);
+    selection->m_nodes[index] = node;
+    selection->nodesEdited();
+}
+
+void GizmoSelection::removeLastNode(QQmlListProperty<QObject> *list)
+{
+    GizmoSelection *selection = selectionOf(list);
+    selection->m_nodes.removeLast();
+    selection->nodesEdited();
+}
+
+void GizmoSelection::nodesEdited()
+{
+    // A list assignment from QML arrives as clear() plus one append() per node, so
+    // the connections are rebuilt once, on first use or in the coalesced flush
+    m_trackingStale = true;
+    m_nodesChangedPending = true;
+    scheduleFlush();
+}
+
+void GizmoSelection::ensureTracked() const
+{
+    if (m_trackingStale)
+        const_cast<GizmoSelection *>(this)->track();
+}
+
+void GizmoSelection::track()
+{
+    m_trackingStale = false;
+
+    for (QObject *node : std::as_const(m_tracked))
+        disconnect(node, nullptr, this, nullptr);
+    m_tracked.clear();
+    m_indexOf.clear();
+
+    const QMetaMethod moved = metaObject()->method(metaObject()->indexOfSlot("nodeMoved()"));
+    const QMetaMethod rotated = metaObject()->method(metaObject()->indexOfSlot("nodeRotated()"));
+
+    std::vector<gizmo3d::core::Vec3> positions;
+    positions.reserve(size_t(m_nodes.size()));
+    for (QObject *node : std::as_const(m_nodes)) {
+        // Nodes are listed once; anything without a scene position is not a Node
+        if (!node || m_indexOf.contains(node))
+            continue;
+        const QMetaMethod positionChanged = notifySignalOf(node, "scenePosition");
+        if (!positionChanged.isValid())
+            continue;
+
+        m_indexOf.insert(node, m_tracked.size());
+        m_tracked.append(node);
+        positions.push_back(scenePositionOf(node));
+        connect(node, positionChanged, this, moved);
+        connect(node, &QObject::destroyed, this, &GizmoSelection::nodeDestroyed);
+    }
+
+    // Local mode follows the first node's orientation
+    if (!m_tracked.isEmpty()) {
+        const QMetaMethod rotationChanged = notifySignalOf(m_tracked.first(), "sceneRotation");
+        if (rotationChanged.isValid())
+            connect(m_tracked.first(), rotationChanged, this, rotated);
+    }
+
+    m_pivot.assign(positions.data(), positions.size());
+}
+
+void GizmoSelection::scheduleFlush()
+{
+    if (m_flushPending)
+        return;
+    m_flushPending = true;
+    QMetaObject::invokeMethod(this, &GizmoSelection::flush, Qt::QueuedConnection);
+}
+
+void GizmoSelection::flush()
+{
+    m_flushPending = false;
+    ensureTracked();
+
+    if (m_nodesChangedPending) {
+        m_nodesChangedPending = false;
+        emit nodesChanged();
+    }
+
+    const QVector3D newPivot = pivot();
+    const QQuaternion newRotation = pivotRotation();
+    if (newPivot != m_emittedPivot || newRotation != m_emittedRotation) {
+        m_emittedPivot = newPivot;
+        m_emittedRotation = newRotation;
+        emit pivotChanged();
+    }
+}
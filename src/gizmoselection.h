@@ -0,0 +1,104 @@
+#ifndef GIZMOSELECTION_H
+#define GIZMOSELECTION_H
+
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QQmlListProperty>
+#include <QQuaternion>
+#include <QVector3D>
+#include <QtQml/qqmlregistration.h>
+
+#include "core/selectionpivot.h"
+
+/**
+ * Multi-selection state for one gizmo: the nodes and their pivot
+ *
+ * Tracks every node's scenePosition through its change signal and keeps the pivot
+ * in a core::SelectionPivot, so a node moving costs O(1) and a group move of n
+ * nodes costs O(n) in total. Changes are coalesced: pivotChanged is emitted once,
+ * from the event loop, after a batch of moves (a controller applying one delta to
+ * the whole set) instead of once per node. Reading pivot brings it up to date
+ * immediately.
+ *
+ * pivotRotation is the first node's sceneRotation, the frame the gizmo's local mode
+ * uses. GlobalGizmo creates one for its targetNodes; native batch appliers read the
+ * same state through nodeList() and pivotState().
+ */
+class GizmoSelection : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+    Q_PROPERTY(QQmlListProperty<QObject> nodes READ nodes NOTIFY nodesChanged)
+    Q_PROPERTY(int count READ count NOTIFY nodesChanged)
+    Q_PROPERTY(PivotMode pivotMode READ pivotMode WRITE setPivotMode NOTIFY pivotModeChanged)
+    Q_PROPERTY(QVector3D pivot READ pivot NOTIFY pivotChanged)
+    Q_PROPERTY(QQuaternion pivotRotation READ pivotRotation NOTIFY pivotChanged)
+
+public:
+    // Matches gizmo3d::core::PivotMode
+    enum PivotMode {
+        Centroid,          // Mean of the node origins
+        BoundsCenter,      // Center of the origins' bounding box
+        FirstSelected,     // The first node's origin
+        IndividualOrigins  // Drawn at the centroid; rotate and scale each node about its own origin
+    };
+    Q_ENUM(PivotMode)
+
+    explicit GizmoSelection(QObject *parent = nullptr);
+
+    QQmlListProperty<QObject> nodes();
+    QList<QObject *> nodeList() const;
+    void setNodeList(const QList<QObject *> &nodes);
+    int count() const;
+
+    PivotMode pivotMode() const;
+    void setPivotMode(PivotMode mode);
+
+    QVector3D pivot() const;
+    QQuaternion pivotRotation() const;
+
+    // Scene positions of nodeList(), in the same order
+    const gizmo3d::core::SelectionPivot &pivotState() const;
+
+signals:
+    void nodesChanged();
+    void pivotModeChanged();
+    void pivotChanged();
+
+private slots:
+    void nodeMoved();
+    void nodeRotated();
+    void nodeDestroyed(QObject *node);
+
+private:
+    static void appendNode(QQmlListProperty<QObject> *list, QObject *node);
+    static qsizetype nodeCount(QQmlListProperty<QObject> *list);
+    static QObject *nodeAt(QQmlListProperty<QObject> *list, qsizetype index);
+    static void clearNodes(QQmlListProperty<QObject> *list);
+    static void replaceNode(QQmlListProperty<QObject> *list, qsizetype index, QObject *node);
+    static void removeLastNode(QQmlListProperty<QObject> *list);
+
+    void nodesEdited();
+    void ensureTracked() const;
+    void track();
+    void scheduleFlush();
+    void flush();
+
+    QList<QObject *> m_nodes;
+    PivotMode m_pivotMode = Centroid;
+
+    // Rebuilt lazily from m_nodes (see ensureTracked)
+    mutable bool m_trackingStale = false;
+    QList<QObject *> m_tracked;
+    QHash<QObject *, qsizetype> m_indexOf;
+    gizmo3d::core::SelectionPivot m_pivot;
+
+    bool m_flushPending = false;
+    bool m_nodesChangedPending = false;
+    QVector3D m_emittedPivot;
+    QQuaternion m_emittedRotation;
+};
+
+#endif // GIZMOSELECTION_H
@@ -0,0 +1,299 @@
+#include "gizmosessionplayer.h"
+
+#include <QMatrix4x4>
+#include <QQuaternion>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using gizmo3d::core::SessionRecord;
+using gizmo3d::core::SessionRecordType;
+using gizmo3d::core::SessionSignal;
+
+namespace {
+
+constexpr int kTransformModeWorld = 0;
+constexpr int kTransformModeLocal = 1;
+
+} // namespace
+
+GizmoSessionPlayer::GizmoSessionPlayer(QObject *parent)
+    : QObject(parent)
+{
+    m_timer.setSingleShot(true);
+    m_timer.setTimerType(Qt::PreciseTimer);
+    connect(&m_timer, &QTimer::timeout, this, &GizmoSessionPlayer::advance);
+}
+
+QString GizmoSessionPlayer::path() const
+{
+    return m_path;
+}
+
+void GizmoSessionPlayer::setPath(const QString &path)
+{
+    if (m_path == path)
+        return;
+    m_path = path;
+    emit pathChanged();
+    load();
+}
+
+QObject *GizmoSessionPlayer::camera() const
+{
+    return m_camera;
+}
+
+void GizmoSessionPlayer::setCamera(QObject *camera)
+{
+    if (m_camera == camera)
+        return;
+    m_camera = camera;
+    emit cameraChanged();
+}
+
+qreal GizmoSessionPlayer::speed() const
+{
+    return m_speed;
+}
+
+void GizmoSessionPlayer::setSpeed(qreal speed)
+{
+    if (!(speed > 0.0) || qFuzzyCompare(m_speed, speed))
+        return;
+    // Keep the playback position where it is in recorded time
+    const qint64 elapsed = m_playing ? playbackTime() : 0;
+    m_speed = speed;
+    if (m_playing) {
+        m_clock.start();
+        m_playbackOrigin = elapsed;
+        advance();
+    }
+    emit speedChanged();
+}
+
+bool GizmoSessionPlayer::isPlaying() const
+{
+    return m_playing;
+}
+
+int GizmoSessionPlayer::count() const
+{
+    return int(m_reader.size());
+}
+
+int GizmoSessionPlayer::position() const
+{
+    return int(m_position);
+}
+
+QString GizmoSessionPlayer::error() const
+{
+    return m_error;
+}
+
+void GizmoSessionPlayer::play()
+{
+    if (m_playing || m_position >= m_reader.size())
+        return;
+    // Resume from the record about to be replayed
+    const SessionRecord next = m_reader.record(m_position);
+    m_sessionStart = next.type == SessionRecordType::Begin ? 0 : next.time;
+    m_playbackOrigin = 0;
+    m_clock.start();
+    setPlaying(true);
+    advance();
+}
+
+void GizmoSessionPlayer::pause()
+{
+    m_timer.stop();
+    setPlaying(false);
+}
+
+void GizmoSessionPlayer::stop()
+{
+    pause();
+    if (m_position == 0)
+        return;
+    m_position = 0;
+    emit positionChanged();
+}
+
+bool GizmoSessionPlayer::step()
+{
+    if (m_position >= m_reader.size())
+        return false;
+    replay(m_reader.record(m_position++));
+    emit positionChanged();
+    return true;
+}
+
+int GizmoSessionPlayer::replayAll()
+{
+    pause();
+    const size_t first = m_position;
+    const size_t count = m_reader.size();
+    for (; m_position < count; ++m_position)
+        replay(m_reader.record(m_position));
+    if (m_position != first)
+        emit positionChanged();
+    return int(m_position - first);
+}
+
+void GizmoSessionPlayer::load()
+{
+    pause();
+    unload();
+
+    if (!m_path.isEmpty()) {
+        m_file.setFileName(m_path);
+        const uchar *data = nullptr;
+        if (m_file.open(QIODevice::ReadOnly))
+            data = m_file.map(0, m_file.size());
+        if (!data)
+            m_error = QStringLiteral("Cannot map %1").arg(m_path);
+        else if (!m_reader.open(data, size_t(m_file.size())))
+            m_error = QStringLiteral("%1 is not a session log").arg(m_path);
+        if (!m_error.isEmpty())
+            unload();
+    }
+
+    emit loaded();
+    emit positionChanged();
+}
+
+void GizmoSessionPlayer::unload()
+{
+    m_reader.close();
+    m_file.close();  // Unmaps
+    m_position = 0;
+    m_error.clear();
+}
+
+void GizmoSessionPlayer::setPlaying(bool playing)
+{
+    if (m_playing == playing)
+        return;
+    m_playing = playing;
+    emit playingChanged();
+}
+
+void GizmoSessionPlayer::replay(const SessionRecord &record)
+{
+    const int handle = record.handle;
+    const int mode = (record.flags & gizmo3d::core::SessionFlagLocal) ? kTransformModeLocal
+                                                                         : kTransformModeWorld;
+    const bool snap = record.flags & gizmo3d::core::SessionFlagSnap;
+    const float *v = record.values;
+
+    switch (record.type) {
+    case SessionRecordType::Begin:
+        break;
+    case SessionRecordType::Camera:
+        applyCamera(record);
+        break;
+    case SessionRecordType::Started:
+        switch (record.signal) {
+        case SessionSignal::AxisTranslation: emit axisTranslationStarted(handle); break;
+        case SessionSignal::PlaneTranslation: emit planeTranslationStarted(handle); break;
+        case SessionSignal::Rotation: emit rotationStarted(handle); break;
+        case SessionSignal::Scale: emit scaleStarted(handle); break;
+        }
+        break;
+    case SessionRecordType::Delta:
+        switch (record.signal) {
+        case SessionSignal::AxisTranslation: emit axisTranslationDelta(handle, mode, v[0], snap); break;
+        case SessionSignal::PlaneTranslation:
+            emit planeTranslationDelta(handle, mode, QVector3D(v[0], v[1], v[2]), snap);
+            break;
+        case SessionSignal::Rotation: emit rotationDelta(handle, mode, v[0], snap); break;
+        case SessionSignal::Scale: emit scaleDelta(handle, mode, v[0], snap); break;
+        }
+        break;
+    case SessionRecordType::Ended:
+        switch (record.signal) {
+        case SessionSignal::AxisTranslation: emit axisTranslationEnded(handle); break;
+        case SessionSignal::PlaneTranslation: emit planeTranslationEnded(handle); break;
+        case SessionSignal::Rotation: emit rotationEnded(handle); break;
+        case SessionSignal::Scale: emit scaleEnded(handle); break;
+        }
+        break;
+    }
+}
+
+void GizmoSessionPlayer::applyCamera(const SessionRecord &record)
+{
+    QObject *camera = m_camera;
+    if (!camera)
+        return;
+
+    const float *v = record.values;
+    const float w = std::sqrt(std::max(0.0f, 1.0f - v[3] * v[3] - v[4] * v[4] - v[5] * v[5]));
+    QVector3D position(v[0], v[1], v[2]);
+    QQuaternion rotation(w, v[3], v[4], v[5]);
+
+    // The log holds the scene pose; the camera's own properties are parent-relative
+    const QObject *parent = camera->property("parent").value<QObject *>();
+    const QVariant parentTransform = parent ? parent->property("sceneTransform") : QVariant();
+    if (parentTransform.isValid()) {
+        bool invertible = false;
+        const QMatrix4x4 inverse = parentTransform.value<QMatrix4x4>().inverted(&invertible);
+        if (invertible) {
+            position = inverse.map(position);
+            rotation = parent->property("sceneRotation").value<QQuaternion>().conjugated() * rotation;
+        }
+    }
+    camera->setProperty("position", position);
+    camera->setProperty("rotation", rotation);
+
+    if (record.flags & gizmo3d::core::SessionFlagOrthographic) {
+        camera->setProperty("horizontalMagnification", v[6]);
+        camera->setProperty("verticalMagnification", v[7]);
+    } else {
+        camera->setProperty("fieldOfView", v[6]);
+    }
+}
+
+void GizmoSessionPlayer::advance()
+{
+    if (!m_playing)
+        return;
+
+    const size_t count = m_reader.size();
+    const size_t first = m_position;
+    while (m_position < count) {
+        const SessionRecord record = m_reader.record(m_position);
+        if (record.type == SessionRecordType::Begin) {
+            // A new session: carry on from here instead of waiting out the gap
+            m_playbackOrigin = 0;
+            m_clock.start();
+            m_sessionStart = 0;
+            ++m_position;
+            continue;
+        }
+        const qint64 due = record.time - m_sessionStart;
+        const qint64 now = playbackTime();
+        if (due > now) {
+            const double remaining = double(due - now) / m_speed / 1e6;
+            m_timer.start(int(std::min(std::ceil(remaining), double(std::numeric_limits<int>::max()))));
+            break;
+        }
+        replay(record);
+        ++m_position;
+    }
+
+    if (m_position != first)
+        emit positionChanged();
+    if (m_position >= count) {
+        setPlaying(false);
+        emit finished();
+    }
+}
+
+qint64 GizmoSessionPlayer::playbackTime() const
+{
+    // Recorded nanoseconds into the current session, at the current speed
+    return m_playbackOrigin + qint64(double(m_clock.nsecsElapsed()) * m_speed);
+}
@@ -0,0 +1,117 @@
+#ifndef GIZMOSESSIONPLAYER_H
+#define GIZMOSESSIONPLAYER_H
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QTimer>
+#include <QVector3D>
+#include <QtQml/qqmlregistration.h>
+
+#include "core/sessionlog.h"
+
+/**
+ * Replays a session log recorded by GizmoSessionRecorder
+ *
+ * The player emits the same controller signals as a gizmo, so a controller
+ * (SimpleController, GizmoTransformController) or GizmoUndoStack takes it as its
+ * gizmo and reapplies the session to the scene. Camera records drive camera, when set.
+ *
+ * The log is memory-mapped. play() follows the recorded timing (scaled by speed);
+ * step() and replayAll() emit records as fast as they are called, which is what
+ * tests and benchmarks want. Either way the signals and their order are exactly those
+ * recorded, so a replay is deterministic. The idle time between sessions appended to
+ * one log is skipped.
+ */
+class GizmoSessionPlayer : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+    Q_PROPERTY(QString path READ path WRITE setPath NOTIFY pathChanged)
+    Q_PROPERTY(QObject *camera READ camera WRITE setCamera NOTIFY cameraChanged)
+    Q_PROPERTY(qreal speed READ speed WRITE setSpeed NOTIFY speedChanged)
+    Q_PROPERTY(bool playing READ isPlaying NOTIFY playingChanged)
+    Q_PROPERTY(int count READ count NOTIFY loaded)
+    Q_PROPERTY(int position READ position NOTIFY positionChanged)
+    Q_PROPERTY(QString error READ error NOTIFY loaded)
+
+public:
+    explicit GizmoSessionPlayer(QObject *parent = nullptr);
+
+    QString path() const;
+    void setPath(const QString &path);
+
+    QObject *camera() const;
+    void setCamera(QObject *camera);
+
+    qreal speed() const;
+    void setSpeed(qreal speed);
+
+    bool isPlaying() const;
+    // Records in the log
+    int count() const;
+    // Index of the next record to replay
+    int position() const;
+    QString error() const;
+
+    Q_INVOKABLE void play();
+    Q_INVOKABLE void pause();
+    // Pauses and rewinds
+    Q_INVOKABLE void stop();
+    // Replays the next record; false at the end of the log
+    Q_INVOKABLE bool step();
+    // Replays every remaining record now; returns how many
+    Q_INVOKABLE int replayAll();
+
+signals:
+    void axisTranslationStarted(int axis);
+    void axisTranslationDelta(int axis, int transformMode, double delta, bool snapActive);
+    void axisTranslationEnded(int axis);
+    void planeTranslationStarted(int plane);
+    void planeTranslationDelta(int plane, int transformMode, QVector3D delta, bool snapActive);
+    void planeTranslationEnded(int plane);
+    void rotationStarted(int axis);
+    void rotationDelta(int axis, int transformMode, double angleDegrees, bool snapActive);
+    void rotationEnded(int axis);
+    void scaleStarted(int axis);
+    void scaleDelta(int axis, int transformMode, double scaleFactor, bool snapActive);
+    void scaleEnded(int axis);
+
+    void pathChanged();
+    void cameraChanged();
+    void speedChanged();
+    void playingChanged();
+    void positionChanged();
+    void loaded();
+    void finished();
+
+private:
+    void load();
+    void unload();
+    void setPlaying(bool playing);
+    void replay(const gizmo3d::core::SessionRecord &record);
+    void applyCamera(const gizmo3d::core::SessionRecord &record);
+    void advance();
+    qint64 playbackTime() const;
+
+    QString m_path;
+    QPointer<QObject> m_camera;
+    qreal m_speed = 1.0;
+    QString m_error;
+
+    QFile m_file;
+    gizmo3d::core::SessionReader m_reader;
+    size_t m_position = 0;
+
+    // Timed playback: recorded nanoseconds, where the current session starts
+    bool m_playing = false;
+    QTimer m_timer;
+    QElapsedTimer m_clock;
+    qint64 m_playbackOrigin = 0;
+    qint64 m_sessionStart = 0;
+};
+
+#endif // GIZMOSESSIONPLAYER_H
@@ -0,0 +1,318 @@
+#include "gizmosessionrecorder.h"
+
+#include <QFile>
+#include <QMetaMethod>
+#include <QQuaternion>
+#include <QQuickItem>
+#include <QQuickWindow>
+
+#include <cstring>
+
+using gizmo3d::core::SessionRecordType;
+using gizmo3d::core::SessionSignal;
+
+namespace {
+
+// Controller signals; each is recorded by the slot of the same signature
+constexpr const char *kSignals[] = {
+    "axisTranslationStarted(int)",
+    "axisTranslationDelta(int,int,double,bool)",
+    "axisTranslationEnded(int)",
+    "planeTranslationStarted(int)",
+    "planeTranslationDelta(int,int,QVector3D,bool)",
+    "planeTranslationEnded(int)",
+    "rotationStarted(int)",
+    "rotationDelta(int,int,double,bool)",
+    "rotationEnded(int)",
+    "scaleStarted(int)",
+    "scaleDelta(int,int,double,bool)",
+    "scaleEnded(int)",
+};
+
+constexpr int kTransformModeLocal = 1;
+
+} // namespace
+
+GizmoSessionRecorder::GizmoSessionRecorder(QObject *parent)
+    : QObject(parent)
+{
+}
+
+QObject *GizmoSessionRecorder::gizmo() const
+{
+    return m_gizmo;
+}
+
+void GizmoSessionRecorder::setGizmo(QObject *gizmo)
+{
+    if (m_gizmo == gizmo)
+        return;
+    // A recording follows one gizmo from start to stop
+    const bool wasRecording = m_recording;
+    if (wasRecording)
+        stop();
+    m_gizmo = gizmo;
+    emit gizmoChanged();
+    if (wasRecording)
+        start();
+}
+
+QObject *GizmoSessionRecorder::camera() const
+{
+    return m_camera;
+}
+
+void GizmoSessionRecorder::setCamera(QObject *camera)
+{
+    if (m_camera == camera)
+        return;
+    m_camera = camera;
+    if (m_recording)
+        m_recordedCamera = camera;
+    emit cameraChanged();
+}
+
+QString GizmoSessionRecorder::path() const
+{
+    return m_path;
+}
+
+void GizmoSessionRecorder::setPath(const QString &path)
+{
+    if (m_path == path)
+        return;
+    const bool wasRecording = m_recording;
+    if (wasRecording)
+        stop();
+    m_path = path;
+    emit pathChanged();
+    if (wasRecording)
+        start();
+}
+
+bool GizmoSessionRecorder::isRecording() const
+{
+    return m_recording;
+}
+
+void GizmoSessionRecorder::setRecording(bool recording)
+{
+    if (m_recording == recording)
+        return;
+    if (recording)
+        start();
+    else
+        stop();
+}
+
+int GizmoSessionRecorder::recordCount() const
+{
+    return int(m_writer.recordCount());
+}
+
+QString GizmoSessionRecorder::error() const
+{
+    return m_error;
+}
+
+void GizmoSessionRecorder::axisTranslationStarted(int axis)
+{
+    append(SessionRecordType::Started, SessionSignal::AxisTranslation, axis);
+}
+
+void GizmoSessionRecorder::axisTranslationDelta(int axis, int transformMode, double delta, bool snapActive)
+{
+    append(SessionRecordType::Delta, SessionSignal::AxisTranslation, axis, transformMode, snapActive,
+           QVector3D(float(delta), 0.0f, 0.0f));
+}
+
+void GizmoSessionRecorder::axisTranslationEnded(int axis)
+{
+    append(SessionRecordType::Ended, SessionSignal::AxisTranslation, axis);
+    flush();
+}
+
+void GizmoSessionRecorder::planeTranslationStarted(int plane)
+{
+    append(SessionRecordType::Started, SessionSignal::PlaneTranslation, plane);
+}
+
+void GizmoSessionRecorder::planeTranslationDelta(int plane, int transformMode, const QVector3D &delta,
+                                                 bool snapActive)
+{
+    append(SessionRecordType::Delta, SessionSignal::PlaneTranslation, plane, transformMode, snapActive,
+           delta);
+}
+
+void GizmoSessionRecorder::planeTranslationEnded(int plane)
+{
+    append(SessionRecordType::Ended, SessionSignal::PlaneTranslation, plane);
+    flush();
+}
+
+void GizmoSessionRecorder::rotationStarted(int axis)
+{
+    append(SessionRecordType::Started, SessionSignal::Rotation, axis);
+}
+
+void GizmoSessionRecorder::rotationDelta(int axis, int transformMode, double angleDegrees, bool snapActive)
+{
+    append(SessionRecordType::Delta, SessionSignal::Rotation, axis, transformMode, snapActive,
+           QVector3D(float(angleDegrees), 0.0f, 0.0f));
+}
+
+void GizmoSessionRecorder::rotationEnded(int axis)
+{
+    append(SessionRecordType::Ended, SessionSignal::Rotation, axis);
+    flush();
+}
+
+void GizmoSessionRecorder::scaleStarted(int axis)
+{
+    append(SessionRecordType::Started, SessionSignal::Scale, axis);
+}
+
+void GizmoSessionRecorder::scaleDelta(int axis, int transformMode, double scaleFactor, bool snapActive)
+{
+    append(SessionRecordType::Delta, SessionSignal::Scale, axis, transformMode, snapActive,
+           QVector3D(float(scaleFactor), 0.0f, 0.0f));
+}
+
+void GizmoSessionRecorder::scaleEnded(int axis)
+{
+    append(SessionRecordType::Ended, SessionSignal::Scale, axis);
+    flush();
+}
+
+void GizmoSessionRecorder::sampleCamera()
+{
+    const QObject *camera = m_recordedCamera;
+    if (!camera)
+        return;
+
+    gizmo3d::core::SessionRecord record;
+    record.type = SessionRecordType::Camera;
+    const QVector3D position = camera->property("scenePosition").value<QVector3D>();
+    QQuaternion rotation = camera->property("sceneRotation").value<QQuaternion>().normalized();
+    if (rotation.scalar() < 0.0f)
+        rotation = -rotation;
+    record.values[0] = position.x();
+    record.values[1] = position.y();
+    record.values[2] = position.z();
+    record.values[3] = rotation.x();
+    record.values[4] = rotation.y();
+    record.values[5] = rotation.z();
+
+    const QVariant fieldOfView = camera->property("fieldOfView");
+    if (fieldOfView.isValid()) {
+        record.values[6] = fieldOfView.toFloat();
+    } else {
+        record.flags = gizmo3d::core::SessionFlagOrthographic;
+        record.values[6] = camera->property("horizontalMagnification").toFloat();
+        record.values[7] = camera->property("verticalMagnification").toFloat();
+    }
+
+    // Only changes are logged; a still camera costs nothing
+    if (m_cameraRecorded && record.flags == m_lastCamera.flags
+        && std::memcmp(record.values, m_lastCamera.values, sizeof(record.values)) == 0) {
+        return;
+    }
+    record.time = m_clock.nsecsElapsed();
+    m_writer.append(record);
+    m_lastCamera = record;
+    m_cameraRecorded = true;
+}
+
+void GizmoSessionRecorder::start()
+{
+    if (m_path.isEmpty()) {
+        setError(QStringLiteral("No path set"));
+        return;
+    }
+    if (!m_writer.open(QFile::encodeName(m_path).constData())) {
+        setError(QStringLiteral("Cannot append a session log to %1").arg(m_path));
+        return;
+    }
+    setError(QString());
+
+    m_clock.start();
+    gizmo3d::core::SessionRecord begin;
+    begin.type = SessionRecordType::Begin;
+    m_writer.append(begin);
+    m_cameraRecorded = false;
+
+    m_recordedCamera = m_camera;
+    if (!m_recordedCamera && m_gizmo) {
+        if (const QObject *view = m_gizmo->property("view3d").value<QObject *>())
+            m_recordedCamera = view->property("camera").value<QObject *>();
+    }
+
+    if (m_gizmo) {
+        const QMetaObject *gizmoMeta = m_gizmo->metaObject();
+        const QMetaObject *meta = metaObject();
+        for (const char *signal : kSignals) {
+            const int index = gizmoMeta->indexOfSignal(signal);
+            if (index < 0)
+                continue;
+            m_connections.append(connect(m_gizmo, gizmoMeta->method(index),
+                                         this, meta->method(meta->indexOfSlot(signal))));
+        }
+        // One camera sample per frame, once animations have moved it
+        if (const auto *item = qobject_cast<QQuickItem *>(m_gizmo.data()); item && item->window()) {
+            m_connections.append(connect(item->window(), &QQuickWindow::afterAnimating,
+                                         this, &GizmoSessionRecorder::sampleCamera));
+        }
+    }
+    sampleCamera();
+
+    m_recording = true;
+    emit recordingChanged();
+    emit recordCountChanged();
+}
+
+void GizmoSessionRecorder::stop()
+{
+    for (const QMetaObject::Connection &connection : std::as_const(m_connections))
+        disconnect(connection);
+    m_connections.clear();
+    if (!m_recording)
+        return;
+
+    if (!m_writer.flush())
+        setError(QStringLiteral("Cannot write to %1").arg(m_path));
+    m_writer.close();
+    m_recording = false;
+    emit recordingChanged();
+    emit recordCountChanged();
+}
+
+void GizmoSessionRecorder::setError(const QString &error)
+{
+    if (m_error == error)
+        return;
+    m_error = error;
+    emit errorChanged();
+}
+
+void GizmoSessionRecorder::append(SessionRecordType type, SessionSignal signal, int handle,
+                                  int transformMode, bool snapActive, QVector3D values)
+{
+    gizmo3d::core::SessionRecord record;
+    record.time = m_clock.nsecsElapsed();
+    record.type = type;
+    record.signal = signal;
+    record.handle = uint8_t(handle);
+    record.flags = uint8_t((transformMode == kTransformModeLocal ? gizmo3d::core::SessionFlagLocal : 0)
+                           | (snapActive ? gizmo3d::core::SessionFlagSnap : 0));
+    record.values[0] = values.x();
+    record.values[1] = values.y();
+    record.values[2] = values.z();
+    m_writer.append(record);
+}
+
+void GizmoSessionRecorder::flush()
+{
+    if (!m_writer.flush())
+        setError(QStringLiteral("Cannot write to %1").arg(m_path));
+    emit recordCountChanged();
+}
@@ -0,0 +1,103 @@
+#ifndef GIZMOSESSIONRECORDER_H
+#define GIZMOSESSIONRECORDER_H
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QVector3D>
+#include <QtQml/qqmlregistration.h>
+
+#include "core/sessionlog.h"
+
+/**
+ * Records a gizmo's controller signals and the camera pose into a session log
+ *
+ * Every *Started, *Delta and *Ended signal becomes one fixed-size core::SessionRecord
+ * stamped with the time since recording started, and the camera pose is sampled once
+ * per frame (after animations, before the scene graph sync) and recorded when it
+ * changed. Records are appended in binary to path, buffered and flushed after each
+ * drag and when recording stops. GizmoSessionPlayer replays the log.
+ *
+ * Recording to an existing log appends a new session to it.
+ */
+class GizmoSessionRecorder : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+    Q_PROPERTY(QObject *gizmo READ gizmo WRITE setGizmo NOTIFY gizmoChanged)
+    Q_PROPERTY(QObject *camera READ camera WRITE setCamera NOTIFY cameraChanged)
+    Q_PROPERTY(QString path READ path WRITE setPath NOTIFY pathChanged)
+    Q_PROPERTY(bool recording READ isRecording WRITE setRecording NOTIFY recordingChanged)
+    Q_PROPERTY(int recordCount READ recordCount NOTIFY recordCountChanged)
+    Q_PROPERTY(QString error READ error NOTIFY errorChanged)
+
+public:
+    explicit GizmoSessionRecorder(QObject *parent = nullptr);
+
+    QObject *gizmo() const;
+    void setGizmo(QObject *gizmo);
+
+    // Defaults to the camera of the gizmo's view3d
+    QObject *camera() const;
+    void setCamera(QObject *camera);
+
+    QString path() const;
+    void setPath(const QString &path);
+
+    bool isRecording() const;
+    void setRecording(bool recording);
+
+    // Records written in this recording; updated after each drag
+    int recordCount() const;
+    QString error() const;
+
+signals:
+    void gizmoChanged();
+    void cameraChanged();
+    void pathChanged();
+    void recordingChanged();
+    void recordCountChanged();
+    void errorChanged();
+
+private slots:
+    void axisTranslationStarted(int axis);
+    void axisTranslationDelta(int axis, int transformMode, double delta, bool snapActive);
+    void axisTranslationEnded(int axis);
+    void planeTranslationStarted(int plane);
+    void planeTranslationDelta(int plane, int transformMode, const QVector3D &delta, bool snapActive);
+    void planeTranslationEnded(int plane);
+    void rotationStarted(int axis);
+    void rotationDelta(int axis, int transformMode, double angleDegrees, bool snapActive);
+    void rotationEnded(int axis);
+    void scaleStarted(int axis);
+    void scaleDelta(int axis, int transformMode, double scaleFactor, bool snapActive);
+    void scaleEnded(int axis);
+    void sampleCamera();
+
+private:
+    void start();
+    void stop();
+    void setError(const QString &error);
+    void append(gizmo3d::core::SessionRecordType type, gizmo3d::core::SessionSignal signal,
+                int handle, int transformMode = 0, bool snapActive = false,
+                QVector3D values = QVector3D());
+    void flush();
+
+    QPointer<QObject> m_gizmo;
+    QPointer<QObject> m_camera;
+    QString m_path;
+    QString m_error;
+
+    bool m_recording = false;
+    QList<QMetaObject::Connection> m_connections;
+    QPointer<QObject> m_recordedCamera;
+    QElapsedTimer m_clock;
+    gizmo3d::core::SessionWriter m_writer;
+    gizmo3d::core::SessionRecord m_lastCamera;
+    bool m_cameraRecorded = false;
+};
+
+#endif // GIZMOSESSIONRECORDER_H
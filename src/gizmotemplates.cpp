@@ -0,0 +1,81 @@
+#include "gizmotemplates.h"
+
+#include "core/geometrytemplates.h"
+
+#include <QJSEngine>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace gizmo3d::core;
+
+namespace {
+
+// Double-precision arrowhead constants, so ArrowRenderer's default headAngle compares equal
+constexpr double kHeadAngle = templates_detail::kPi / 6.0;
+constexpr double kHeadCos = templates_detail::cos(kHeadAngle);
+constexpr double kHeadSin = templates_detail::sin(kHeadAngle);
+
+} // namespace
+
+GizmoTemplates::GizmoTemplates(QObject *parent)
+    : QObject(parent)
+{
+}
+
+int GizmoTemplates::defaultSegments() const
+{
+    return kDefaultCircleSegments;
+}
+
+qreal GizmoTemplates::arrowHeadAngle() const
+{
+    return kHeadAngle;
+}
+
+qreal GizmoTemplates::arrowHeadCos() const
+{
+    return kHeadCos;
+}
+
+qreal GizmoTemplates::arrowHeadSin() const
+{
+    return kHeadSin;
+}
+
+QJSValue GizmoTemplates::unitCircle(int segments)
+{
+    segments = std::max(segments, 3);
+    auto it = m_circles.constFind(segments);
+    if (it != m_circles.constEnd())
+        return it.value();
+
+    QJSEngine *engine = qjsEngine(this);
+    if (!engine)
+        return QJSValue();
+
+    const std::span<const UnitCirclePoint> table = unitCircleTable(segments);
+    QJSValue points = engine->newArray(uint(segments + 1));
+    for (int i = 0; i <= segments; ++i) {
+        UnitCirclePoint point;
+        if (!table.empty()) {
+            point = table[size_t(i)];
+        } else {
+            // No compile-time table for this count: computed once, then cached
+            const double angle = double(i) / double(segments) * 2.0 * templates_detail::kPi;
+            point = {float(std::cos(angle)), float(std::sin(angle))};
+        }
+        QJSValue entry = engine->newObject();
+        entry.setProperty(QStringLiteral("cos"), double(point.cos));
+        entry.setProperty(QStringLiteral("sin"), double(point.sin));
+        points.setProperty(quint32(i), entry);
+    }
+
+    m_circles.insert(segments, points);
+    return points;
+}
+
+bool GizmoTemplates::hasTable(int segments) const
+{
+    return !unitCircleTable(segments).empty();
+}
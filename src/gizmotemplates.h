@@ -0,0 +1,52 @@
+#ifndef GIZMOTEMPLATES_H
+#define GIZMOTEMPLATES_H
+
+#include <QHash>
+#include <QJSValue>
+#include <QObject>
+#include <QtQml/qqmlregistration.h>
+
+/**
+ * Compile-time shape templates for the QML geometry path
+ *
+ * Serves the constexpr unit circles and arrowhead rotation from core/geometrytemplates.h
+ * to GeometryTemplates and the renderers, so they neither call Math.cos/Math.sin nor
+ * build tables at startup. A circle is converted to a JS array on first request and
+ * shared afterwards.
+ */
+class GizmoTemplates : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_SINGLETON
+
+    Q_PROPERTY(int defaultSegments READ defaultSegments CONSTANT)
+    Q_PROPERTY(qreal arrowHeadAngle READ arrowHeadAngle CONSTANT)
+    Q_PROPERTY(qreal arrowHeadCos READ arrowHeadCos CONSTANT)
+    Q_PROPERTY(qreal arrowHeadSin READ arrowHeadSin CONSTANT)
+
+public:
+    explicit GizmoTemplates(QObject *parent = nullptr);
+
+    int defaultSegments() const;
+    qreal arrowHeadAngle() const;
+    qreal arrowHeadCos() const;
+    qreal arrowHeadSin() const;
+
+    /**
+     * Unit circle as an array of {cos, sin} with segments + 1 points (closing point
+     * included). Counts without a compile-time table are computed once and cached.
+     * @param segments - Segment count (values below 3 are raised to 3)
+     */
+    Q_INVOKABLE QJSValue unitCircle(int segments);
+
+    /**
+     * Whether a segment count has a compile-time table
+     */
+    Q_INVOKABLE bool hasTable(int segments) const;
+
+private:
+    QHash<int, QJSValue> m_circles;
+};
+
+#endif // GIZMOTEMPLATES_H
@@ -0,0 +1,58 @@
+#ifndef GIZMOTRACE_H
+#define GIZMOTRACE_H
+
+#include <QtGlobal>
+
+/**
+ * Q_TRACE tracepoints of the gizmo pipeline (gizmo3d.tracepoints)
+ *
+ * With GIZMO3D_TRACING the stages GizmoProfiler times are also emitted as
+ * GizmoProfiler_stage_entry / _exit pairs through Qt's tracing backend (CTF or
+ * LTTng, generated by tracegen), tagged with the gizmo's address and its
+ * GizmoEnums.Mode. A trace then shows them next to the Qt Quick and Qt Quick 3D
+ * tracepoints of the same process. Without it every macro expands to nothing.
+ *
+ * Only for .cpp files: the generated provider header pulls in Qt private headers.
+ * Thread-safe, unlike GizmoProfiler itself.
+ */
+#ifdef GIZMO3D_TRACING
+
+#include "gizmo3d_tracepoints_p.h"
+
+#define GIZMO3D_TRACE_ENTER(stage, gizmo, mode) \
+    Q_TRACE(GizmoProfiler_stage_entry, int(stage), quint64(quintptr(gizmo)), int(mode))
+#define GIZMO3D_TRACE_LEAVE(stage) Q_TRACE(GizmoProfiler_stage_exit, int(stage))
+#define GIZMO3D_TRACE_COUNT(counter, amount) Q_TRACE(GizmoProfiler_count, int(counter), int(amount))
+#define GIZMO3D_TRACE_FRAME(frame) Q_TRACE(GizmoProfiler_frame, int(frame))
+
+// Emits an entry/exit pair around the enclosing scope
+class GizmoTraceScope
+{
+public:
+    GizmoTraceScope(int stage, const void *gizmo, int mode)
+        : m_stage(stage)
+    {
+        GIZMO3D_TRACE_ENTER(stage, gizmo, mode);
+    }
+    ~GizmoTraceScope() { GIZMO3D_TRACE_LEAVE(m_stage); }
+
+private:
+    int m_stage;
+};
+
+#define GIZMO3D_TRACE_CONCAT_(a, b) a##b
+#define GIZMO3D_TRACE_CONCAT(a, b) GIZMO3D_TRACE_CONCAT_(a, b)
+#define GIZMO3D_TRACE_SCOPE(stage, gizmo, mode) \
+    GizmoTraceScope GIZMO3D_TRACE_CONCAT(gizmoTraceScope, __LINE__)(int(stage), gizmo, int(mode))
+
+#else
+
+#define GIZMO3D_TRACE_ENTER(stage, gizmo, mode) static_cast<void>(0)
+#define GIZMO3D_TRACE_LEAVE(stage) static_cast<void>(0)
+#define GIZMO3D_TRACE_COUNT(counter, amount) static_cast<void>(0)
+#define GIZMO3D_TRACE_FRAME(frame) static_cast<void>(0)
+#define GIZMO3D_TRACE_SCOPE(stage, gizmo, mode) static_cast<void>(0)
+
+#endif
+
+#endif // GIZMOTRACE_H
@@ -0,0 +1,5 @@
+// Instantiates the tracepoint provider tracegen generated from gizmo3d.tracepoints.
+// Only built with GIZMO3D_TRACING.
+#define TRACEPOINT_CREATE_PROBES
+#define TRACEPOINT_DEFINE
+#include "gizmo3d_tracepoints_p.h"
@@ -0,0 +1,305 @@
+#include "gizmotransformcontroller.h"
+
+#include <QElapsedTimer>
+#include <QMetaMethod>
+#include <QQuaternion>
+
+#include <vector>
+
+using gizmo3d::core::PositionField;
+using gizmo3d::core::Quat;
+using gizmo3d::core::RotationField;
+using gizmo3d::core::ScaleField;
+using gizmo3d::core::Vec3;
+
+namespace {
+
+// GizmoEnums values the controller signals carry
+constexpr int kAxisX = 1;
+constexpr int kAxisY = 2;
+constexpr int kAxisZ = 3;
+constexpr int kTransformModeLocal = 1;
+
+// Gizmo signal -> controller slot
+struct SignalRoute
+{
+    const char *signal;
+    const char *slot;
+};
+
+constexpr SignalRoute kRoutes[] = {
+    {"axisTranslationStarted(int)", "axisTranslationStarted(int)"},
+    {"axisTranslationDelta(int,int,double,bool)", "axisTranslationDelta(int,int,double,bool)"},
+    {"axisTranslationEnded(int)", "manipulationEnded()"},
+    {"planeTranslationStarted(int)", "planeTranslationStarted(int)"},
+    {"planeTranslationDelta(int,int,QVector3D,bool)", "planeTranslationDelta(int,int,QVector3D,bool)"},
+    {"planeTranslationEnded(int)", "manipulationEnded()"},
+    {"rotationStarted(int)", "rotationStarted(int)"},
+    {"rotationDelta(int,int,double,bool)", "rotationDelta(int,int,double,bool)"},
+    {"rotationEnded(int)", "manipulationEnded()"},
+    {"scaleStarted(int)", "scaleStarted(int)"},
+    {"scaleDelta(int,int,double,bool)", "scaleDelta(int,int,double,bool)"},
+    {"scaleEnded(int)", "manipulationEnded()"},
+};
+
+Vec3 toVec3(const QVector3D &v)
+{
+    return {v.x(), v.y(), v.z()};
+}
+
+Quat toQuat(const QQuaternion &q)
+{
+    return {q.scalar(), q.x(), q.y(), q.z()};
+}
+} // namespace
+
+GizmoTransformController::GizmoTransformController(QObject *parent)
+    : QObject(parent)
+{
+}
+
+QObject *GizmoTransformController::gizmo() const
+{
+    return m_gizmo;
+}
+
+void GizmoTransformController::setGizmo(QObject *gizmo)
+{
+    if (m_gizmo == gizmo)
+        return;
+    m_gizmo = gizmo;
+    connectGizmo();
+    emit gizmoChanged();
+}
+
+QObject *GizmoTransformController::targetNode() const
+{
+    return m_targetNode;
+}
+
+void GizmoTransformController::setTargetNode(QObject *node)
+{
+    if (m_targetNode == node)
+        return;
+    m_targetNode = node;
+    emit targetNodeChanged();
+}
+
+GizmoSelection *GizmoTransformController::selection() const
+{
+    return m_selection;
+}
+
+void GizmoTransformController::setSelection(GizmoSelection *selection)
+{
+    if (m_selection == selection)
+        return;
+    m_selection = selection;
+    emit selectionChanged();
+}
+
+bool GizmoTransformController::isEnabled() const
+{
+    return m_enabled;
+}
+
+void GizmoTransformController::setEnabled(bool enabled)
+{
+    if (m_enabled == enabled)
+        return;
+    m_enabled = enabled;
+    emit enabledChanged();
+}
+
+bool GizmoTransformController::isActive() const
+{
+    return m_active;
+}
+
+int GizmoTransformController::nodeCount() const
+{
+    return int(m_nodes.size());
+}
+
+qreal GizmoTransformController::lastApplyTime() const
+{
+    return m_lastApplyTime;
+}
+
+void GizmoTransformController::axisTranslationStarted(int)
+{
+    begin();
+}
+
+void GizmoTransformController::axisTranslationDelta(int axis, int transformMode, double delta, bool)
+{
+    if (!m_active)
+        return;
+    QElapsedTimer timer;
+    timer.start();
+    m_batch.translate(axisDirection(axis, transformMode) * float(delta));
+    write(PositionField);
+    m_lastApplyTime = timer.nsecsElapsed() / 1.0e6;
+    emit applied();
+}
+
+void GizmoTransformController::planeTranslationStarted(int)
+{
+    begin();
+}
+
+void GizmoTransformController::planeTranslationDelta(int, int transformMode, const QVector3D &delta,
+                                                     bool)
+{
+    if (!m_active)
+        return;
+    QElapsedTimer timer;
+    timer.start();
+    // Local deltas are components along the drag-start local axes
+    const Vec3 worldDelta = transformMode == kTransformModeLocal
+            ? m_localAxes.x * delta.x() + m_localAxes.y * delta.y() + m_localAxes.z * delta.z()
+            : toVec3(delta);
+    m_batch.translate(worldDelta);
+    write(PositionField);
+    m_lastApplyTime = timer.nsecsElapsed() / 1.0e6;
+    emit applied();
+}
+
+void GizmoTransformController::rotationStarted(int)
+{
+    begin();
+}
+
+void GizmoTransformController::rotationDelta(int axis, int transformMode, double angleDegrees, bool)
+{
+    if (!m_active)
+        return;
+    QElapsedTimer timer;
+    timer.start();
+    const Quat rotation = gizmo3d::core::fromAxisAngle(axisDirection(axis, transformMode),
+                                                       float(angleDegrees));
+    m_batch.rotate(rotation, m_pivot, m_aboutOrigins);
+    write(m_aboutOrigins ? RotationField : PositionField | RotationField);
+    m_lastApplyTime = timer.nsecsElapsed() / 1.0e6;
+    emit applied();
+}
+
+void GizmoTransformController::scaleStarted(int)
+{
+    begin();
+}
+
+void GizmoTransformController::scaleDelta(int axis, int transformMode, double scaleFactor, bool)
+{
+    if (!m_active)
+        return;
+    QElapsedTimer timer;
+    timer.start();
+    // Node.scale is per-node local, like SimpleController; the group spreads along the
+    // gizmo axis about the pivot
+    const bool uniform = axis < kAxisX || axis > kAxisZ;
+    m_batch.scale(uniform ? -1 : axis - kAxisX, uniform ? Vec3{} : axisDirection(axis, transformMode),
+                  float(scaleFactor), m_pivot, m_aboutOrigins);
+    write(m_aboutOrigins ? ScaleField : PositionField | ScaleField);
+    m_lastApplyTime = timer.nsecsElapsed() / 1.0e6;
+    emit applied();
+}
+
+void GizmoTransformController::manipulationEnded()
+{
+    if (!m_active)
+        return;
+    m_active = false;
+    emit activeChanged();
+}
+
+void GizmoTransformController::connectGizmo()
+{
+    for (const QMetaObject::Connection &connection : std::as_const(m_connections))
+        disconnect(connection);
+    m_connections.clear();
+    manipulationEnded();
+
+    if (!m_gizmo)
+        return;
+
+    // Looked up by signature: the gizmos are QML types, and any of them may lack a
+    // group of signals (TranslationGizmo has no rotation signals)
+    const QMetaObject *gizmoMeta = m_gizmo->metaObject();
+    const QMetaObject *meta = metaObject();
+    for (const SignalRoute &route : kRoutes) {
+        const int signalIndex = gizmoMeta->indexOfSignal(route.signal);
+        if (signalIndex < 0)
+            continue;
+        m_connections.append(connect(m_gizmo, gizmoMeta->method(signalIndex),
+                                     this, meta->method(meta->indexOfSlot(route.slot))));
+    }
+}
+
+void GizmoTransformController::begin()
+{
+    m_nodes.clear();
+    m_nodeProperties.clear();
+
+    if (m_enabled) {
+        if (m_selection && m_selection->count() > 0) {
+            const QList<QObject *> nodes = m_selection->nodeList();
+            m_nodes.reserve(nodes.size());
+            for (QObject *node : nodes)
+                m_nodes.append(node);
+            m_pivot = toVec3(m_selection->pivot());
+            m_localAxes = gizmo3d::core::axesOf(toQuat(m_selection->pivotRotation()));
+            m_aboutOrigins = m_selection->pivotMode() == GizmoSelection::IndividualOrigins;
+        } else if (m_targetNode) {
+            m_nodes.append(m_targetNode);
+            m_pivot = toVec3(m_targetNode->property("scenePosition").value<QVector3D>());
+            m_localAxes = gizmo3d::core::axesOf(
+                    toQuat(m_targetNode->property("sceneRotation").value<QQuaternion>()));
+        }
+    }
+    // A single node turns and scales about its own origin: only one property changes
+    if (m_nodes.size() == 1)
+        m_aboutOrigins = true;
+
+    std::vector<gizmo3d::core::NodeSnapshot> snapshots;
+    snapshots.reserve(size_t(m_nodes.size()));
+    m_nodeProperties.reserve(m_nodes.size());
+    for (const QPointer<QObject> &node : std::as_const(m_nodes)) {
+        snapshots.push_back(GizmoNodeAccess::snapshot(node));
+        m_nodeProperties.append(&m_access.propertiesOf(node));
+    }
+    m_batch.assign(snapshots.data(), snapshots.size());
+
+    const bool wasActive = m_active;
+    m_active = !m_nodes.isEmpty();
+    if (m_active || wasActive)
+        emit activeChanged();
+}
+
+void GizmoTransformController::write(int fields)
+{
+    const Vec3 *positions = m_batch.positions();
+    const Quat *rotations = m_batch.rotations();
+    const Vec3 *scales = m_batch.scales();
+
+    for (qsizetype i = 0; i < m_nodes.size(); ++i) {
+        // Nodes destroyed mid-drag are skipped
+        QObject *node = m_nodes.at(i);
+        if (!node)
+            continue;
+        GizmoNodeAccess::write(node, *m_nodeProperties.at(i), fields,
+                               {positions[i], rotations[i], scales[i]});
+    }
+}
+
+Vec3 GizmoTransformController::axisDirection(int axis, int transformMode) const
+{
+    if (transformMode == kTransformModeLocal) {
+        return axis == kAxisX ? m_localAxes.x
+             : axis == kAxisY ? m_localAxes.y
+                              : m_localAxes.z;
+    }
+    return axis == kAxisX ? Vec3{1.0f, 0.0f, 0.0f}
+         : axis == kAxisY ? Vec3{0.0f, 1.0f, 0.0f}
+                          : Vec3{0.0f, 0.0f, 1.0f};
+}
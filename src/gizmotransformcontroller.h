@@ -0,0 +1,113 @@
+#ifndef GIZMOTRANSFORMCONTROLLER_H
+#define GIZMOTRANSFORMCONTROLLER_H
+
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QVector3D>
+#include <QtQml/qqmlregistration.h>
+
+#include "core/transformbatch.h"
+#include "core/vecmath.h"
+#include "gizmonodeaccess.h"
+#include "gizmoselection.h"
+
+/**
+ * Native controller: applies a gizmo's deltas to one node or a whole selection
+ *
+ * The C++ counterpart of SimpleController. On each *Started signal it snapshots the
+ * targets (local and scene transforms, and each parent's scene transform) into a
+ * core::TransformBatch; each *Delta is then solved for every node in one native pass
+ * and written back with a single property write per changed property and node:
+ * position, rotation or scale, never all three. Deltas are applied in scene space, so
+ * nodes under transformed parents follow the gizmo's axes.
+ *
+ * With a non-empty selection the controller moves its nodes about selection.pivot
+ * (each node's own origin for IndividualOrigins); otherwise it moves targetNode.
+ * Local mode uses the gizmo's frame at drag start: the selection's pivotRotation, or
+ * the target's sceneRotation.
+ *
+ * Works with any gizmo emitting the controller signals (GlobalGizmo, MultiViewGizmo
+ * and the single-mode gizmos); signals a gizmo does not have are ignored.
+ */
+class GizmoTransformController : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+    Q_PROPERTY(QObject *gizmo READ gizmo WRITE setGizmo NOTIFY gizmoChanged)
+    Q_PROPERTY(QObject *targetNode READ targetNode WRITE setTargetNode NOTIFY targetNodeChanged)
+    Q_PROPERTY(GizmoSelection *selection READ selection WRITE setSelection NOTIFY selectionChanged)
+    Q_PROPERTY(bool enabled READ isEnabled WRITE setEnabled NOTIFY enabledChanged)
+    Q_PROPERTY(bool active READ isActive NOTIFY activeChanged)
+    Q_PROPERTY(int nodeCount READ nodeCount NOTIFY activeChanged)
+    Q_PROPERTY(qreal lastApplyTime READ lastApplyTime NOTIFY applied)
+
+public:
+    explicit GizmoTransformController(QObject *parent = nullptr);
+
+    QObject *gizmo() const;
+    void setGizmo(QObject *gizmo);
+
+    QObject *targetNode() const;
+    void setTargetNode(QObject *node);
+
+    GizmoSelection *selection() const;
+    void setSelection(GizmoSelection *selection);
+
+    bool isEnabled() const;
+    void setEnabled(bool enabled);
+
+    // True between a *Started and its *Ended signal
+    bool isActive() const;
+    // Nodes the current (or last) drag applies to
+    int nodeCount() const;
+    // Milliseconds the last delta took to solve and write back
+    qreal lastApplyTime() const;
+
+signals:
+    void gizmoChanged();
+    void targetNodeChanged();
+    void selectionChanged();
+    void enabledChanged();
+    void activeChanged();
+    void applied();
+
+private slots:
+    void axisTranslationStarted(int axis);
+    void axisTranslationDelta(int axis, int transformMode, double delta, bool snapActive);
+    void planeTranslationStarted(int plane);
+    void planeTranslationDelta(int plane, int transformMode, const QVector3D &delta, bool snapActive);
+    void rotationStarted(int axis);
+    void rotationDelta(int axis, int transformMode, double angleDegrees, bool snapActive);
+    void scaleStarted(int axis);
+    void scaleDelta(int axis, int transformMode, double scaleFactor, bool snapActive);
+    void manipulationEnded();
+
+private:
+    void connectGizmo();
+    void begin();
+    // Writes the core::TransformField bits in fields to every node
+    void write(int fields);
+    gizmo3d::core::Vec3 axisDirection(int axis, int transformMode) const;
+
+    QPointer<QObject> m_gizmo;
+    QPointer<QObject> m_targetNode;
+    QPointer<GizmoSelection> m_selection;
+    bool m_enabled = true;
+    QList<QMetaObject::Connection> m_connections;
+
+    // Drag state, captured in begin()
+    bool m_active = false;
+    QList<QPointer<QObject>> m_nodes;
+    QList<const GizmoNodeAccess::Properties *> m_nodeProperties;
+    gizmo3d::core::TransformBatch m_batch;
+    gizmo3d::core::Vec3 m_pivot;
+    gizmo3d::core::Axes m_localAxes;
+    bool m_aboutOrigins = false;
+    qreal m_lastApplyTime = 0.0;
+
+    GizmoNodeAccess m_access;
+};
+
+#endif // GIZMOTRANSFORMCONTROLLER_H
@@ -0,0 +1,53 @@
+#ifndef GIZMOTRANSFORMDELTA_H
+#define GIZMOTRANSFORMDELTA_H
+
+#include <QQuaternion>
+#include <QVector3D>
+#include <QtQml/qqmlregistration.h>
+
+/**
+ * One gizmo delta of any kind, as carried by GizmoDeltaForwarder::transformDelta
+ *
+ * mode says which handle moved (GizmoEnums.Mode Translate, Rotate or Scale; plane is
+ * set for plane translations). The payload is the delta in scene space, from the drag
+ * start like every gizmo delta: translation for translations, rotation for rotations
+ * and per-axis factors in scale for scaling; the others stay identity. The target
+ * fields are the target node's parent-relative transform with the delta applied to its
+ * drag-start transform, ready to be written to Node.position, rotation or scale.
+ */
+class GizmoTransformDelta
+{
+    Q_GADGET
+    QML_VALUE_TYPE(gizmoTransformDelta)
+
+    Q_PROPERTY(int mode MEMBER mode)
+    Q_PROPERTY(int axis MEMBER axis)
+    Q_PROPERTY(int plane MEMBER plane)
+    Q_PROPERTY(int transformMode MEMBER transformMode)
+    Q_PROPERTY(bool snapActive MEMBER snapActive)
+    Q_PROPERTY(double value MEMBER value)
+    Q_PROPERTY(QVector3D translation MEMBER translation)
+    Q_PROPERTY(QQuaternion rotation MEMBER rotation)
+    Q_PROPERTY(QVector3D scale MEMBER scale)
+    Q_PROPERTY(QVector3D targetPosition MEMBER targetPosition)
+    Q_PROPERTY(QQuaternion targetRotation MEMBER targetRotation)
+    Q_PROPERTY(QVector3D targetScale MEMBER targetScale)
+
+public:
+    int mode = 0;            // GizmoEnums.Mode
+    int axis = 0;            // GizmoEnums.Axis, None for plane translations
+    int plane = 0;           // GizmoEnums.Plane, None unless a plane is dragged
+    int transformMode = 0;   // GizmoEnums.TransformMode
+    bool snapActive = false;
+    double value = 0.0;      // The signal's scalar: distance, angle in degrees or factor
+
+    QVector3D translation;
+    QQuaternion rotation;
+    QVector3D scale{1.0f, 1.0f, 1.0f};
+
+    QVector3D targetPosition;
+    QQuaternion targetRotation;
+    QVector3D targetScale{1.0f, 1.0f, 1.0f};
+};
+
+#endif // GIZMOTRANSFORMDELTA_H
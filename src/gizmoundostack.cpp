@@ -0,0 +1,304 @@
+#include "gizmoundostack.h"
+
+#include <QMetaMethod>
+
+namespace {
+
+// Gizmo signals that open and close an edit
+constexpr const char *kStartedSignals[] = {
+    "axisTranslationStarted(int)",
+    "planeTranslationStarted(int)",
+    "rotationStarted(int)",
+    "scaleStarted(int)",
+};
+
+constexpr const char *kEndedSignals[] = {
+    "axisTranslationEnded(int)",
+    "planeTranslationEnded(int)",
+    "rotationEnded(int)",
+    "scaleEnded(int)",
+};
+
+} // namespace
+
+GizmoUndoStack::GizmoUndoStack(QObject *parent)
+    : QObject(parent)
+{
+    m_history.setDropHandler([this](const gizmo3d::core::TransformCommand &command) {
+        for (size_t i = 0; i < command.size(); ++i)
+            release(command.node(i));
+    });
+}
+
+QObject *GizmoUndoStack::gizmo() const
+{
+    return m_gizmo;
+}
+
+void GizmoUndoStack::setGizmo(QObject *gizmo)
+{
+    if (m_gizmo == gizmo)
+        return;
+    m_gizmo = gizmo;
+    connectGizmo();
+    emit gizmoChanged();
+}
+
+QObject *GizmoUndoStack::targetNode() const
+{
+    return m_targetNode;
+}
+
+void GizmoUndoStack::setTargetNode(QObject *node)
+{
+    if (m_targetNode == node)
+        return;
+    m_targetNode = node;
+    emit targetNodeChanged();
+}
+
+GizmoSelection *GizmoUndoStack::selection() const
+{
+    return m_selection;
+}
+
+void GizmoUndoStack::setSelection(GizmoSelection *selection)
+{
+    if (m_selection == selection)
+        return;
+    m_selection = selection;
+    emit selectionChanged();
+}
+
+int GizmoUndoStack::undoLimit() const
+{
+    return int(m_history.limit());
+}
+
+void GizmoUndoStack::setUndoLimit(int limit)
+{
+    limit = qMax(0, limit);
+    if (undoLimit() == limit)
+        return;
+    const size_t countBefore = m_history.size();
+    m_history.setLimit(size_t(limit));
+    emit undoLimitChanged();
+    if (m_history.size() != countBefore)
+        emit historyChanged();
+}
+
+bool GizmoUndoStack::canUndo() const
+{
+    return m_history.canUndo();
+}
+
+bool GizmoUndoStack::canRedo() const
+{
+    return m_history.canRedo();
+}
+
+int GizmoUndoStack::count() const
+{
+    return int(m_history.size());
+}
+
+int GizmoUndoStack::index() const
+{
+    return int(m_history.index());
+}
+
+qint64 GizmoUndoStack::memoryUsage() const
+{
+    return qint64(m_history.memoryUsage());
+}
+
+bool GizmoUndoStack::isRecording() const
+{
+    return m_recording;
+}
+
+void GizmoUndoStack::beginEdit()
+{
+    m_editNodes.clear();
+    m_editBefore.clear();
+
+    if (m_selection && m_selection->count() > 0) {
+        const QList<QObject *> nodes = m_selection->nodeList();
+        m_editNodes.reserve(nodes.size());
+        for (QObject *node : nodes)
+            m_editNodes.append(node);
+    } else if (m_targetNode) {
+        m_editNodes.append(m_targetNode);
+    }
+
+    m_editBefore.reserve(size_t(m_editNodes.size()));
+    for (const QPointer<QObject> &node : std::as_const(m_editNodes))
+        m_editBefore.push_back(GizmoNodeAccess::transform(node));
+    setRecording(!m_editNodes.isEmpty());
+}
+
+void GizmoUndoStack::endEdit()
+{
+    if (!m_recording)
+        return;
+    setRecording(false);
+
+    // Nodes destroyed during the edit are left out. Ids are taken now, not in
+    // beginEdit(): history dropped meanwhile may have freed them
+    std::vector<uint32_t> ids;
+    std::vector<gizmo3d::core::NodeTransform> before;
+    std::vector<gizmo3d::core::NodeTransform> after;
+    ids.reserve(m_editBefore.size());
+    before.reserve(m_editBefore.size());
+    after.reserve(m_editBefore.size());
+    for (qsizetype i = 0; i < m_editNodes.size(); ++i) {
+        QObject *node = m_editNodes.at(i);
+        if (!node)
+            continue;
+        const uint32_t id = idOf(node);
+        ++m_nodeTable[id].commands;
+        ids.push_back(id);
+        before.push_back(m_editBefore[size_t(i)]);
+        after.push_back(GizmoNodeAccess::transform(node));
+    }
+    m_editNodes.clear();
+    m_editBefore.clear();
+
+    // The references taken above become the command's, or are given back
+    auto command = gizmo3d::core::TransformCommand::create(ids.data(), before.data(), after.data(),
+                                                           ids.size());
+    if (!command) {
+        for (uint32_t id : ids)
+            release(id);
+        return;
+    }
+    m_history.push(std::move(command));
+    emit historyChanged();
+}
+
+void GizmoUndoStack::undo()
+{
+    // An edit in progress is abandoned: its start state is about to change
+    setRecording(false);
+    if (const gizmo3d::core::TransformCommand *command = m_history.undo()) {
+        apply(*command, false);
+        emit historyChanged();
+    }
+}
+
+void GizmoUndoStack::redo()
+{
+    setRecording(false);
+    if (const gizmo3d::core::TransformCommand *command = m_history.redo()) {
+        apply(*command, true);
+        emit historyChanged();
+    }
+}
+
+void GizmoUndoStack::clear()
+{
+    setRecording(false);
+    m_history.clear();
+    m_nodeTable.clear();
+    m_ids.clear();
+    m_freeIds = {};
+    emit historyChanged();
+}
+
+void GizmoUndoStack::editStarted()
+{
+    beginEdit();
+}
+
+void GizmoUndoStack::editEnded()
+{
+    endEdit();
+}
+
+void GizmoUndoStack::connectGizmo()
+{
+    for (const QMetaObject::Connection &connection : std::as_const(m_connections))
+        disconnect(connection);
+    m_connections.clear();
+    setRecording(false);
+
+    if (!m_gizmo)
+        return;
+
+    // Gizmos without a group of signals (TranslationGizmo has no rotation) are fine
+    const QMetaObject *gizmoMeta = m_gizmo->metaObject();
+    const QMetaMethod started = metaObject()->method(metaObject()->indexOfSlot("editStarted()"));
+    const QMetaMethod ended = metaObject()->method(metaObject()->indexOfSlot("editEnded()"));
+    for (const char *signal : kStartedSignals) {
+        const int index = gizmoMeta->indexOfSignal(signal);
+        if (index >= 0)
+            m_connections.append(connect(m_gizmo, gizmoMeta->method(index), this, started));
+    }
+    for (const char *signal : kEndedSignals) {
+        const int index = gizmoMeta->indexOfSignal(signal);
+        if (index >= 0)
+            m_connections.append(connect(m_gizmo, gizmoMeta->method(index), this, ended));
+    }
+}
+
+void GizmoUndoStack::setRecording(bool recording)
+{
+    if (m_recording == recording)
+        return;
+    m_recording = recording;
+    emit recordingChanged();
+}
+
+uint32_t GizmoUndoStack::idOf(QObject *node)
+{
+    // A destroyed node's address may be reused: the newcomer gets an id of its own
+    const auto it = m_ids.constFind(node);
+    if (it != m_ids.constEnd() && m_nodeTable.at(*it).node == node)
+        return *it;
+
+    uint32_t id;
+    if (m_freeIds.empty()) {
+        id = uint32_t(m_nodeTable.size());
+        m_nodeTable.append(NodeEntry{node, node, 0});
+    } else {
+        id = m_freeIds.top();
+        m_freeIds.pop();
+        m_nodeTable[id] = NodeEntry{node, node, 0};
+    }
+    m_ids.insert(node, id);
+    return id;
+}
+
+void GizmoUndoStack::release(uint32_t id)
+{
+    NodeEntry &entry = m_nodeTable[id];
+    if (--entry.commands > 0)
+        return;
+
+    // The key may have been taken over by a newcomer at the same address
+    const auto it = m_ids.constFind(entry.key);
+    if (it != m_ids.constEnd() && *it == id)
+        m_ids.erase(it);
+    entry = NodeEntry();
+    m_freeIds.push(id);
+}
+
+void GizmoUndoStack::apply(const gizmo3d::core::TransformCommand &command, bool after)
+{
+    m_scratch.resize(command.size());
+    command.decode(after, m_scratch.data());
+
+    const int fields = command.fields();
+    for (size_t i = 0; i < command.size(); ++i) {
+        NodeEntry &entry = m_nodeTable[command.node(i)];
+        QObject *node = entry.node;
+        if (!node) {
+            // Destroyed: its address is free for another node
+            const auto it = m_ids.constFind(entry.key);
+            if (it != m_ids.constEnd() && *it == command.node(i))
+                m_ids.erase(it);
+            continue;
+        }
+        GizmoNodeAccess::write(node, m_access.propertiesOf(node), fields, m_scratch[i]);
+    }
+}
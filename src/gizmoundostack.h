@@ -0,0 +1,133 @@
+#ifndef GIZMOUNDOSTACK_H
+#define GIZMOUNDOSTACK_H
+
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QtQml/qqmlregistration.h>
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "core/transformhistory.h"
+#include "gizmonodeaccess.h"
+#include "gizmoselection.h"
+
+/**
+ * Undo/redo history of gizmo edits, one command per drag
+ *
+ * Listens to a gizmo's *Started and *Ended signals, next to whichever controller
+ * applies the deltas. *Started records the targets' transforms (the selection's
+ * nodes, or targetNode); *Ended compares them with the result and pushes a single
+ * core::TransformCommand holding only what changed. Deltas in between are never
+ * looked at, so a drag of any length is one command.
+ *
+ * Commands store per-field arrays with a shared delta where one explains the whole
+ * group, so the history of a many-thousand-node edit is about one array of start
+ * values. Undo and redo write one property per changed field and node.
+ *
+ * beginEdit() and endEdit() record edits made by other means (an inspector, a
+ * script) the same way.
+ */
+class GizmoUndoStack : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+    Q_PROPERTY(QObject *gizmo READ gizmo WRITE setGizmo NOTIFY gizmoChanged)
+    Q_PROPERTY(QObject *targetNode READ targetNode WRITE setTargetNode NOTIFY targetNodeChanged)
+    Q_PROPERTY(GizmoSelection *selection READ selection WRITE setSelection NOTIFY selectionChanged)
+    Q_PROPERTY(int undoLimit READ undoLimit WRITE setUndoLimit NOTIFY undoLimitChanged)
+    Q_PROPERTY(bool canUndo READ canUndo NOTIFY historyChanged)
+    Q_PROPERTY(bool canRedo READ canRedo NOTIFY historyChanged)
+    Q_PROPERTY(int count READ count NOTIFY historyChanged)
+    Q_PROPERTY(int index READ index NOTIFY historyChanged)
+    Q_PROPERTY(qint64 memoryUsage READ memoryUsage NOTIFY historyChanged)
+    Q_PROPERTY(bool recording READ isRecording NOTIFY recordingChanged)
+
+public:
+    explicit GizmoUndoStack(QObject *parent = nullptr);
+
+    QObject *gizmo() const;
+    void setGizmo(QObject *gizmo);
+
+    QObject *targetNode() const;
+    void setTargetNode(QObject *node);
+
+    GizmoSelection *selection() const;
+    void setSelection(GizmoSelection *selection);
+
+    // Commands kept; 0 keeps all
+    int undoLimit() const;
+    void setUndoLimit(int limit);
+
+    bool canUndo() const;
+    bool canRedo() const;
+    int count() const;
+    // Commands currently applied
+    int index() const;
+    // Bytes held by the commands
+    qint64 memoryUsage() const;
+    // True between beginEdit() and endEdit()
+    bool isRecording() const;
+
+    // Records the targets' transforms
+    Q_INVOKABLE void beginEdit();
+    // Pushes what changed since beginEdit() as one command
+    Q_INVOKABLE void endEdit();
+
+    Q_INVOKABLE void undo();
+    Q_INVOKABLE void redo();
+    Q_INVOKABLE void clear();
+
+signals:
+    void gizmoChanged();
+    void targetNodeChanged();
+    void selectionChanged();
+    void undoLimitChanged();
+    void historyChanged();
+    void recordingChanged();
+
+private slots:
+    void editStarted();
+    void editEnded();
+
+private:
+    void connectGizmo();
+    void setRecording(bool recording);
+    uint32_t idOf(QObject *node);
+    void release(uint32_t id);
+    void apply(const gizmo3d::core::TransformCommand &command, bool after);
+
+    QPointer<QObject> m_gizmo;
+    QPointer<QObject> m_targetNode;
+    QPointer<GizmoSelection> m_selection;
+    QList<QMetaObject::Connection> m_connections;
+
+    // Commands refer to nodes by their index here. An entry is freed for reuse once no
+    // command refers to it, so the table only holds nodes the history can still touch
+    struct NodeEntry
+    {
+        QPointer<QObject> node;
+        QObject *key = nullptr;  // Its m_ids key, still known once the node is destroyed
+        uint32_t commands = 0;
+    };
+    QList<NodeEntry> m_nodeTable;
+    QHash<QObject *, uint32_t> m_ids;
+    // Lowest first, so a group reselected after being freed gets consecutive ids again
+    std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> m_freeIds;
+
+    // Edit in progress
+    bool m_recording = false;
+    QList<QPointer<QObject>> m_editNodes;
+    std::vector<gizmo3d::core::NodeTransform> m_editBefore;
+
+    gizmo3d::core::TransformHistory m_history;
+    std::vector<gizmo3d::core::NodeTransform> m_scratch;
+    GizmoNodeAccess m_access;
+};
+
+#endif // GIZMOUNDOSTACK_H
@@ -0,0 +1,31 @@
+import QtQuick
+import QtTest
+
+// TestCase that builds sceneComponent once per test function: createScene() returns a
+// temporary instance, rendered once so gizmo geometry and scene transforms are current
+TestCase {
+    id: testCase
+    width: 800
+    height: 600
+    visible: true
+    when: windowShown
+
+    property Component sceneComponent: null
+
+    readonly property Component signalSpyComponent: Component {
+        SignalSpy {}
+    }
+
+    function createScene() {
+        var scene = createTemporaryObject(sceneComponent, testCase)
+        verify(scene !== null, "Scene should be created")
+        waitForRendering(scene, 5000)
+        return scene
+    }
+
+    function compareVector(actual, expected, message) {
+        fuzzyCompare(actual.x, expected.x, 0.01, message + " x")
+        fuzzyCompare(actual.y, expected.y, 0.01, message + " y")
+        fuzzyCompare(actual.z, expected.z, 0.01, message + " z")
+    }
+}
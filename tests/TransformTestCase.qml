@@ -0,0 +1,14 @@
+import QtQuick
+import QtTest
+
+// SceneTestCase of the transform tests: sceneComponent is a TransformTestScene plus the
+// test's wiring, and createTransformScene() also checks its GlobalGizmo made every child
+SceneTestCase {
+    function createTransformScene() {
+        var scene = createScene()
+        verify(scene.gizmo.translationGizmo !== null, "translation gizmo created")
+        verify(scene.gizmo.rotationGizmo !== null, "rotation gizmo created")
+        verify(scene.gizmo.scaleGizmo !== null, "scale gizmo created")
+        return scene
+    }
+}
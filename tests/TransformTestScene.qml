@@ -0,0 +1,46 @@
+import QtQuick
+import QtQuick3D
+import Gizmo3D
+
+// Scene shared by the transform tests: nodes a and b side by side, and child under a
+// rotated and scaled parent, seen head-on by a perspective camera, with a GlobalGizmo
+// in All mode. Each test adds its own wiring (controller, delta forwarder, undo stack).
+Item {
+    width: 800
+    height: 600
+
+    property alias view3d: view3d
+    property alias gizmo: globalGizmo
+    property alias a: nodeA
+    property alias b: nodeB
+    property alias child: childNode
+
+    View3D {
+        id: view3d
+        anchors.fill: parent
+        camera: camera
+
+        PerspectiveCamera {
+            id: camera
+            position: Qt.vector3d(0, 0, 600)
+        }
+
+        Node { id: nodeA; position: Qt.vector3d(-50, 0, 0) }
+        Node { id: nodeB; position: Qt.vector3d(50, 0, 0) }
+
+        // Rotated and scaled parent: local axes differ from the scene's
+        Node {
+            position: Qt.vector3d(0, 100, 0)
+            eulerRotation: Qt.vector3d(0, 0, 90)
+            scale: Qt.vector3d(2, 2, 2)
+            Node { id: childNode; position: Qt.vector3d(10, 0, 0) }
+        }
+    }
+
+    GlobalGizmo {
+        id: globalGizmo
+        anchors.fill: parent
+        view3d: view3d
+        mode: GizmoEnums.Mode.All
+    }
+}
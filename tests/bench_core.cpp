@@ -0,0 +1,249 @@
+// Micro-benchmarks for the gizmo building blocks
+//
+// Drives the geometry calculators, HitTester and the GizmoMath ray functions through
+// MockProjection, so each primitive is measured without a window, a View3D or the GPU.
+// Inputs come from a fixed-seed generator and every benchmark runs in a perspective and
+// an orthographic row. One QBENCHMARK iteration processes a batch of kBatchSize inputs.
+//
+// Run: ctest -L benchmark --verbose, or bench_core -median 5 for steadier numbers
+
+#include <QtTest/QtTest>
+#include <QQmlComponent>
+#include <QQmlEngine>
+
+#include <cmath>
+#include <memory>
+
+namespace {
+
+constexpr int kBatchSize = 256;
+constexpr int kSeed = 20240611;
+
+// Fixture living in the QML engine: generates the inputs once per row and runs one
+// primitive over all of them. Each run returns a checksum so the work is observable.
+const char *const kFixtureSource = R"qml(
+import QtQuick
+import Gizmo3D
+
+QtObject {
+    property var projector: null
+    property var targets: []
+    property var screenPoints: []
+    property var rays: []
+    property var translationGeometry: null
+    property var rotationGeometry: null
+    property var scaleGeometry: null
+    readonly property var axes: GizmoMath.getLocalAxes(Qt.quaternion(0.9238795, 0.2, 0.3, 0.1))
+
+    function setup(type: string, seed: int, count: int): void {
+        // Park-Miller generator: the same inputs on every run and platform
+        var state = seed
+        function random() {
+            state = (state * 16807) % 2147483647
+            return (state - 1) / 2147483646
+        }
+
+        var perspective = type === "perspective"
+        projector = MockProjection.createProjector({
+            type: type,
+            cameraPosition: Qt.vector3d(0, 0, 10),
+            viewportSize: Qt.size(800, 600),
+            scale: 100
+        })
+
+        var newTargets = []
+        var newPoints = []
+        var newRays = []
+        for (var i = 0; i < count; i++) {
+            newTargets.push(Qt.vector3d((random() - 0.5) * 4, (random() - 0.5) * 3,
+                                        perspective ? -random() * 5 : 0))
+            var screen = Qt.point(random() * 800, random() * 600)
+
+            // Perspective rays start at the eye, orthographic ones on the view plane
+            var onPlane = projector.projectScreenToWorld(screen)
+            if (perspective) {
+                newRays.push({
+                    origin: projector.cameraPosition,
+                    direction: GizmoMath.normalize(GizmoMath.vectorSubtract(onPlane,
+                                                                            projector.cameraPosition))
+                })
+            } else {
+                newRays.push({ origin: onPlane, direction: projector.cameraForward })
+            }
+        }
+        targets = newTargets
+        rays = newRays
+
+        // Hit tests probe the geometry of one gizmo at the viewport center
+        var center = perspective ? Qt.vector3d(0, 0, -2) : Qt.vector3d(0, 0, 0)
+        translationGeometry = TranslationGeometryCalculator.calculateArrowGeometry(config(center, 0.5, 1.0))
+        scaleGeometry = ScaleGeometryCalculator.calculateHandleGeometry(config(center, 0.0, 0.5))
+        rotationGeometry = RotationGeometryCalculator.calculateCircleGeometry(config(center, 0, 0))
+
+        // Hit-test probes cluster around the gizmo so all branches are exercised
+        var centerScreen = projector.projectWorldToScreen(center)
+        for (var p = 0; p < count; p++) {
+            newPoints.push(Qt.point(centerScreen.x + (random() - 0.5) * 240,
+                                    centerScreen.y + (random() - 0.5) * 240))
+        }
+        screenPoints = newPoints
+    }
+
+    function config(target: vector3d, startRatio: real, endRatio: real): var {
+        return {
+            projector: projector, targetPosition: target, axes: axes,
+            gizmoSize: 80, maxScreenSize: 150, maxScreenRadius: 100, segments: 48,
+            arrowStartRatio: startRatio, arrowEndRatio: endRatio
+        }
+    }
+
+    function translation(): real {
+        var sum = 0
+        for (var i = 0; i < targets.length; i++)
+            sum += TranslationGeometryCalculator.calculateArrowGeometry(config(targets[i], 0.5, 1.0)).xEnd.x
+        return sum
+    }
+
+    function rotation(): real {
+        var sum = 0
+        for (var i = 0; i < targets.length; i++)
+            sum += RotationGeometryCalculator.calculateCircleGeometry(config(targets[i], 0, 0)).radii.xy
+        return sum
+    }
+
+    function scale(): real {
+        var sum = 0
+        for (var i = 0; i < targets.length; i++)
+            sum += ScaleGeometryCalculator.calculateHandleGeometry(config(targets[i], 0.0, 0.5)).xEnd.x
+        return sum
+    }
+
+    function hitTranslation(): real {
+        var hits = 0
+        for (var i = 0; i < screenPoints.length; i++) {
+            if (HitTester.testTranslationGizmoHit(screenPoints[i], translationGeometry, 10).type !== "none")
+                hits++
+        }
+        return hits
+    }
+
+    function hitRotation(): real {
+        var hits = 0
+        for (var i = 0; i < screenPoints.length; i++) {
+            if (HitTester.testRotationGizmoHit(screenPoints[i], rotationGeometry, 10, null).type !== "none")
+                hits++
+        }
+        return hits
+    }
+
+    function hitScale(): real {
+        var hits = 0
+        for (var i = 0; i < screenPoints.length; i++) {
+            if (HitTester.testScaleGizmoHit(screenPoints[i], scaleGeometry, 10, 15).type !== "none")
+                hits++
+        }
+        return hits
+    }
+
+    function rayAxis(): real {
+        var sum = 0
+        for (var i = 0; i < rays.length; i++)
+            sum += GizmoMath.closestPointOnAxisToRay(rays[i].origin, rays[i].direction, targets[i], axes.x)
+        return sum
+    }
+
+    function rayPlane(): real {
+        var sum = 0
+        for (var i = 0; i < rays.length; i++) {
+            var hit = GizmoMath.intersectRayPlane(rays[i].origin, rays[i].direction, targets[i], axes.z)
+            if (hit) sum += hit.x
+        }
+        return sum
+    }
+}
+)qml";
+
+} // namespace
+
+class BenchCore : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void translationGeometry_data() { addProjectionRows(); }
+    void translationGeometry() { run("translation"); }
+    void rotationGeometry_data() { addProjectionRows(); }
+    void rotationGeometry() { run("rotation"); }
+    void scaleGeometry_data() { addProjectionRows(); }
+    void scaleGeometry() { run("scale"); }
+
+    void hitTestTranslation_data() { addProjectionRows(); }
+    void hitTestTranslation() { run("hitTranslation", true); }
+    void hitTestRotation_data() { addProjectionRows(); }
+    void hitTestRotation() { run("hitRotation", true); }
+    void hitTestScale_data() { addProjectionRows(); }
+    void hitTestScale() { run("hitScale", true); }
+
+    void rayClosestPointOnAxis_data() { addProjectionRows(); }
+    void rayClosestPointOnAxis() { run("rayAxis"); }
+    void rayPlaneIntersection_data() { addProjectionRows(); }
+    void rayPlaneIntersection() { run("rayPlane"); }
+
+private:
+    void addProjectionRows();
+    void run(const char *function, bool expectHits = false);
+
+    QQmlEngine *engine = nullptr;
+    std::unique_ptr<QObject> fixture;
+};
+
+void BenchCore::initTestCase()
+{
+    engine = new QQmlEngine(this);
+
+    // Add import path for the Gizmo3D module
+    engine->addImportPath(QCoreApplication::applicationDirPath() + "/../src");
+
+    QQmlComponent component(engine);
+    component.setData(kFixtureSource, QUrl());
+    QVERIFY2(!component.isError(), qPrintable(component.errorString()));
+    fixture.reset(component.create());
+    QVERIFY(fixture != nullptr);
+}
+
+void BenchCore::cleanupTestCase()
+{
+    fixture.reset();
+    delete engine;
+    engine = nullptr;
+}
+
+void BenchCore::addProjectionRows()
+{
+    QTest::addColumn<QString>("projection");
+    QTest::newRow("perspective") << QStringLiteral("perspective");
+    QTest::newRow("orthographic") << QStringLiteral("orthographic");
+}
+
+void BenchCore::run(const char *function, bool expectHits)
+{
+    QFETCH(QString, projection);
+    QVERIFY(QMetaObject::invokeMethod(fixture.get(), "setup", Q_ARG(QString, projection),
+                                      Q_ARG(int, kSeed), Q_ARG(int, kBatchSize)));
+
+    double checksum = 0.0;
+    QBENCHMARK {
+        QMetaObject::invokeMethod(fixture.get(), function, Q_RETURN_ARG(double, checksum));
+    }
+
+    // A NaN or a batch that never hits means the inputs no longer exercise the primitive
+    QVERIFY(std::isfinite(checksum));
+    if (expectHits)
+        QVERIFY2(checksum > 0.0, "no probe hit the gizmo");
+}
+
+QTEST_MAIN(BenchCore)
+#include "bench_core.moc"
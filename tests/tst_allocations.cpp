@@ -0,0 +1,187 @@
+#include <QtTest/QtTest>
+#include <QMatrix4x4>
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "core/gizmogeometry.h"
+#include "core/hittest.h"
+#include "core/interaction.h"
+
+using namespace gizmo3d::core;
+
+// Heap allocations made while armed. Replacing the global operator new counts every
+// allocation of this executable, so the test covers the core library as linked.
+namespace {
+std::atomic<bool> g_armed{false};
+std::atomic<int> g_allocations{0};
+
+void *countedAlloc(std::size_t size)
+{
+    if (g_armed.load(std::memory_order_relaxed))
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+} // namespace
+
+void *operator new(std::size_t size) { return countedAlloc(size); }
+void *operator new[](std::size_t size) { return countedAlloc(size); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+/**
+ * Allocation-free steady state of the native per-frame path
+ *
+ * Once a gizmo's geometry buffers exist, recomputing geometry for a moving camera,
+ * hit testing it and solving drags must not touch the heap: the per-frame path runs
+ * for every gizmo at display rate and allocations there turn into allocator and
+ * fragmentation cost over long editing sessions.
+ */
+class TestAllocations : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Test cases
+    void testGeometrySteadyState();
+    void testHitTestSteadyState();
+    void testDragSteadyState();
+
+private:
+    static constexpr int kFrames = 240;
+
+    // One camera per frame of a full orbit, built before counting starts
+    static std::vector<CameraSnapshot> orbit();
+
+    static void arm()
+    {
+        g_allocations = 0;
+        g_armed = true;
+    }
+    static int disarm()
+    {
+        g_armed = false;
+        return g_allocations;
+    }
+};
+
+std::vector<CameraSnapshot> TestAllocations::orbit()
+{
+    QMatrix4x4 projection;
+    projection.perspective(60.0f, 800.0f / 600.0f, 10.0f, 10000.0f);
+    Mat4 coreProjection;
+    std::memcpy(coreProjection.m, projection.constData(), sizeof(coreProjection.m));
+
+    std::vector<CameraSnapshot> cameras(kFrames);
+    for (int frame = 0; frame < kFrames; ++frame) {
+        QMatrix4x4 transform;
+        transform.rotate(360.0f * frame / kFrames, 0.0f, 1.0f, 0.0f);
+        transform.rotate(-25.0f, 1.0f, 0.0f, 0.0f);
+        transform.translate(0.0f, 0.0f, 500.0f);
+        Mat4 coreTransform;
+        std::memcpy(coreTransform.m, transform.constData(), sizeof(coreTransform.m));
+        CameraSnapshot::fromMatrices(coreTransform, coreProjection, 800.0f, 600.0f, 10.0f, false,
+                                     &cameras[size_t(frame)]);
+    }
+    return cameras;
+}
+
+void TestAllocations::testGeometrySteadyState()
+{
+    const std::vector<CameraSnapshot> cameras = orbit();
+    ArrowParams arrowParams;
+    CircleParams circleParams;
+    ArrowGeometry arrows;
+    HandleGeometry handles;
+    CircleGeometry circles;
+
+    // The first update sizes the circle buffers
+    computeCircleGeometry(cameras.front(), circleParams, circles);
+    circleParams.hasPreviousRadii = true;
+
+    arm();
+    for (const CameraSnapshot &camera : cameras) {
+        computeArrowGeometry(camera, arrowParams, arrows);
+        computeHandleGeometry(camera, arrowParams, handles);
+        circleParams.previousRadii = circles.radii;
+        computeCircleGeometry(camera, circleParams, circles);
+    }
+    QCOMPARE(disarm(), 0);
+}
+
+void TestAllocations::testHitTestSteadyState()
+{
+    const std::vector<CameraSnapshot> cameras = orbit();
+    ArrowParams arrowParams;
+    CircleParams circleParams;
+    ArrowGeometry arrows;
+    CircleGeometry circles;
+    computeArrowGeometry(cameras.front(), arrowParams, arrows);
+    computeCircleGeometry(cameras.front(), circleParams, circles);
+
+    int hits = 0;
+    arm();
+    for (int y = 200; y < 400; y += 4) {
+        for (int x = 300; x < 500; x += 4) {
+            const Vec2 point{float(x), float(y)};
+            hits += hitTestArrows(arrows, point, 10.0f).type != HitType::None;
+            hits += hitTestHandles(arrows, point, 10.0f, 12.0f).type != HitType::None;
+            hits += hitTestCircles(circles, point, 8.0f).type != HitType::None;
+        }
+    }
+    QCOMPARE(disarm(), 0);
+    QVERIFY(hits > 0);
+}
+
+void TestAllocations::testDragSteadyState()
+{
+    const CameraSnapshot camera = orbit().front();
+    ArrowParams arrowParams;
+    CircleParams circleParams;
+    ArrowGeometry arrows;
+    CircleGeometry circles;
+    computeArrowGeometry(camera, arrowParams, arrows);
+    computeCircleGeometry(camera, circleParams, circles);
+
+    // Grab each gizmo at its first handle on screen
+    const Vec2 center{arrows.center.x, arrows.center.y};
+    const Vec2 onArrow{(arrows.start[AxisX].x + arrows.end[AxisX].x) / 2,
+                       (arrows.start[AxisX].y + arrows.end[AxisX].y) / 2};
+    TranslationInteraction translation;
+    translation.snap.enabled = true;
+    QVERIFY(translation.press(camera, arrows, arrowParams, onArrow).type != HitType::None);
+    ScaleInteraction scale;
+    QVERIFY(scale.press(camera, arrows, arrowParams, {1.0f, 1.0f, 1.0f}, center).type != HitType::None);
+    RotationInteraction rotation;
+    bool grabbed = false;
+    for (const Vec2 &point : circles.circles[CircleXY]) {
+        if (rotation.press(camera, circles, circleParams, point).type != HitType::None) {
+            grabbed = true;
+            break;
+        }
+    }
+    QVERIFY(grabbed);
+
+    TranslationDelta translationDelta;
+    RotationDelta rotationDelta;
+    ScaleDelta scaleDelta;
+    arm();
+    for (int i = 1; i <= kFrames; ++i) {
+        translation.move({onArrow.x + float(i), onArrow.y}, &translationDelta);
+        scale.move({center.x + float(i), center.y - float(i)}, &scaleDelta);
+        rotation.move({center.x + 100.0f * std::cos(i * 0.02f), center.y + 100.0f * std::sin(i * 0.02f)},
+                      &rotationDelta);
+    }
+    QCOMPARE(disarm(), 0);
+}
+
+QTEST_MAIN(TestAllocations)
+#include "tst_allocations.moc"
@@ -0,0 +1,109 @@
+import QtQuick
+import QtTest
+import Gizmo3D
+
+// GlobalGizmo.directManipulation: drags move targetNode without a controller, in scene
+// space, while the signals, undo and validation keep working.
+TransformTestCase {
+    id: testCase
+    name: "DirectManipulation"
+
+    sceneComponent: Component {
+        TransformTestScene {
+            id: scene
+
+            property alias history: undoStack
+
+            gizmo.targetNode: child
+            gizmo.directManipulation: true
+
+            GizmoUndoStack {
+                id: undoStack
+                gizmo: scene.gizmo
+                targetNode: scene.child
+            }
+        }
+    }
+
+    function dragX(scene, distances) {
+        var source = scene.gizmo.translationGizmo
+        source.axisTranslationStarted(GizmoEnums.Axis.X)
+        for (var i = 0; i < distances.length; i++)
+            source.axisTranslationDelta(GizmoEnums.Axis.X, GizmoEnums.TransformMode.World, distances[i], false)
+        source.axisTranslationEnded(GizmoEnums.Axis.X)
+    }
+
+    function test_drag_writes_target() {
+        var scene = createTransformScene()
+        var start = scene.child.scenePosition
+        var spy = createTemporaryObject(signalSpyComponent, testCase, {
+            target: scene.gizmo, signalName: "axisTranslationDelta"
+        })
+
+        dragX(scene, [30, 40])
+
+        compare(spy.count, 2, "observers still get the signals")
+        // Along scene X despite the rotated and scaled parent
+        compareVector(scene.child.scenePosition, start.plus(Qt.vector3d(40, 0, 0)), "moved")
+    }
+
+    function test_rotation_and_scale() {
+        var scene = createTransformScene()
+        var start = scene.child.scenePosition
+
+        scene.gizmo.rotationGizmo.rotationStarted(GizmoEnums.Axis.Y)
+        scene.gizmo.rotationGizmo.rotationDelta(GizmoEnums.Axis.Y, GizmoEnums.TransformMode.World, 90, false)
+        scene.gizmo.rotationGizmo.rotationEnded(GizmoEnums.Axis.Y)
+        compareVector(scene.child.scenePosition, start, "rotated in place")
+        var expected = GizmoMath.quaternionFromAxisAngle(Qt.vector3d(0, 1, 0), 90)
+        verify(GizmoMath.vectorEquals(GizmoMath.getLocalAxes(scene.child.sceneRotation).x,
+                                      GizmoMath.getLocalAxes(expected.times(
+                                          GizmoMath.quaternionFromAxisAngle(Qt.vector3d(0, 0, 1), 90))).x),
+               "scene rotation is the delta applied to the start")
+
+        scene.gizmo.scaleGizmo.scaleStarted(GizmoEnums.Axis.Uniform)
+        scene.gizmo.scaleGizmo.scaleDelta(GizmoEnums.Axis.Uniform, GizmoEnums.TransformMode.World, 2, false)
+        scene.gizmo.scaleGizmo.scaleEnded(GizmoEnums.Axis.Uniform)
+        compareVector(scene.child.scale, Qt.vector3d(2, 2, 2), "scaled")
+    }
+
+    function test_undo() {
+        var scene = createTransformScene()
+        dragX(scene, [10, 20])
+        compare(scene.history.count, 1, "one command per drag")
+        compareVector(scene.child.position, Qt.vector3d(10, -10, 0), "moved")
+
+        scene.history.undo()
+        compareVector(scene.child.position, Qt.vector3d(10, 0, 0), "undone")
+    }
+
+    function test_validator() {
+        var scene = createTransformScene()
+
+        // Veto: nothing is written
+        scene.gizmo.deltas.validator = function(delta) { return false }
+        dragX(scene, [40])
+        compareVector(scene.child.position, Qt.vector3d(10, 0, 0), "vetoed")
+
+        // Adjust: keep the child above its parent's origin plane (local x >= 0)
+        scene.gizmo.deltas.validator = function(delta) {
+            var p = delta.targetPosition
+            delta.targetPosition = Qt.vector3d(Math.max(p.x, 0), p.y, p.z)
+            return delta
+        }
+        var source = scene.gizmo.translationGizmo
+        source.axisTranslationStarted(GizmoEnums.Axis.Y)
+        source.axisTranslationDelta(GizmoEnums.Axis.Y, GizmoEnums.TransformMode.World, -100, false)
+        source.axisTranslationEnded(GizmoEnums.Axis.Y)
+        compareVector(scene.child.position, Qt.vector3d(0, 0, 0), "clamped")
+    }
+
+    function test_off_for_selection() {
+        var scene = createTransformScene()
+        scene.gizmo.targetNodes = [scene.a]
+        verify(!scene.gizmo.deltas.applyToTarget, "the pivot is not written")
+
+        dragX(scene, [40])
+        compareVector(scene.a.position, Qt.vector3d(-50, 0, 0), "selection untouched")
+    }
+}
@@ -0,0 +1,101 @@
+import QtQuick
+import QtTest
+import Gizmo3D
+
+// GizmoFrameContext: the calculators must produce the same geometry from one shared
+// context as from their config objects, and the context must reuse the axis probes
+// for the world-axis scales in world mode.
+TestCase {
+    id: testCase
+    name: "FrameContext"
+
+    function projector() {
+        return MockProjection.createProjector({
+            type: "perspective",
+            cameraPosition: Qt.vector3d(3, 4, 20),
+            viewportSize: Qt.size(800, 600)
+        })
+    }
+
+    function worldAxes() {
+        return { x: Qt.vector3d(1, 0, 0), y: Qt.vector3d(0, 1, 0), z: Qt.vector3d(0, 0, 1) }
+    }
+
+    function localAxes() {
+        return GizmoMath.getLocalAxes(Qt.quaternion(0.9238795, 0, 0.3826834, 0))
+    }
+
+    function comparePoint(actual, expected, label) {
+        fuzzyCompare(actual.x, expected.x, 0.001, label + ".x")
+        fuzzyCompare(actual.y, expected.y, 0.001, label + ".y")
+    }
+
+    function test_invalid_projector() {
+        compare(GizmoFrameContext.create({}, Qt.vector3d(0, 0, 0), worldAxes()), null)
+    }
+
+    function test_world_mode_reuses_axis_probes() {
+        var context = GizmoFrameContext.create(projector(), Qt.vector3d(1, 0, 0), worldAxes())
+        verify(context.worldAxisLengths === context.axisLengths, "probes shared in world mode")
+        comparePoint(context.center, GizmoProjection.projectWorldToScreen(Qt.vector3d(1, 0, 0),
+                                                                          projector()), "center")
+    }
+
+    function test_local_mode_probes_world_axes() {
+        var context = GizmoFrameContext.create(projector(), Qt.vector3d(1, 0, 0), localAxes())
+        verify(context.worldAxisLengths !== context.axisLengths, "separate world probes")
+        var worldContext = GizmoFrameContext.create(projector(), Qt.vector3d(1, 0, 0), worldAxes())
+        fuzzyCompare(context.worldAxisLengths.x, worldContext.axisLengths.x, 0.0001, "world x scale")
+    }
+
+    function test_arrow_geometry_matches_config() {
+        var target = Qt.vector3d(1, -2, 0)
+        var context = GizmoFrameContext.create(projector(), target, localAxes())
+        var shared = TranslationGeometryCalculator.arrowGeometry(context, 80, 150, 0.5, 1.0)
+        var direct = TranslationGeometryCalculator.calculateArrowGeometry({
+            projector: projector(), targetPosition: target, axes: localAxes(),
+            gizmoSize: 80, maxScreenSize: 150, arrowStartRatio: 0.5, arrowEndRatio: 1.0
+        })
+
+        var keys = ["center", "xStart", "xEnd", "yStart", "yEnd", "zStart", "zEnd"]
+        for (var i = 0; i < keys.length; i++)
+            comparePoint(shared[keys[i]], direct[keys[i]], keys[i])
+        for (var c = 0; c < 4; c++)
+            comparePoint(shared.planes.xy[c], direct.planes.xy[c], "xy corner " + c)
+    }
+
+    function test_handle_geometry_matches_config() {
+        var target = Qt.vector3d(0, 1, -1)
+        var context = GizmoFrameContext.create(projector(), target, worldAxes())
+        var shared = ScaleGeometryCalculator.handleGeometry(context, 80, 150, 0.0, 0.5)
+        var direct = ScaleGeometryCalculator.calculateHandleGeometry({
+            projector: projector(), targetPosition: target, axes: worldAxes(),
+            gizmoSize: 80, maxScreenSize: 150, arrowStartRatio: 0.0, arrowEndRatio: 0.5
+        })
+
+        var keys = ["center", "xEnd", "yEnd", "zEnd"]
+        for (var i = 0; i < keys.length; i++)
+            comparePoint(shared[keys[i]], direct[keys[i]], keys[i])
+    }
+
+    function test_circle_geometry_and_facing_match_config() {
+        var target = Qt.vector3d(2, 0, 1)
+        var axes = localAxes()
+        var context = GizmoFrameContext.create(projector(), target, axes)
+        var shared = RotationGeometryCalculator.circleGeometry(context, axes, 80, 100, 48, null, 0.3)
+        var direct = RotationGeometryCalculator.calculateCircleGeometry({
+            projector: projector(), targetPosition: target, axes: axes,
+            gizmoSize: 80, maxScreenRadius: 100, segments: 48
+        })
+
+        fuzzyCompare(shared.radii.xy, direct.radii.xy, 0.0001, "xy radius")
+        fuzzyCompare(shared.radii.yz, direct.radii.yz, 0.0001, "yz radius")
+        compare(shared.circles.zx.length, direct.circles.zx.length, "zx point count")
+        comparePoint(shared.circles.zx[7], direct.circles.zx[7], "zx point")
+
+        fuzzyCompare(RotationGeometryCalculator.facingAngle(context.toCamera, axes.x, axes.y),
+                     RotationGeometryCalculator.calculateCameraFacingAngle(target, axes.x, axes.y,
+                                                                           projector()),
+                     0.0001, "facing angle")
+    }
+}
@@ -0,0 +1,121 @@
+import QtQuick
+import QtQuick3D
+import QtTest
+import Gizmo3D
+
+// Multi-selection: GlobalGizmo.targetNodes places the gizmo on the pivot GizmoSelection
+// computes natively, follows the nodes as they move and keeps emitting one delta per move.
+SceneTestCase {
+    id: testCase
+    name: "GizmoSelection"
+    sceneComponent: selectionSceneComponent
+
+    Component {
+        id: selectionSceneComponent
+        Item {
+            width: 800
+            height: 600
+
+            property alias view: view3d
+            property alias gizmo: globalGizmo
+            property alias a: nodeA
+            property alias b: nodeB
+            property alias c: nodeC
+
+            View3D {
+                id: view3d
+                anchors.fill: parent
+                camera: camera
+
+                PerspectiveCamera {
+                    id: camera
+                    position: Qt.vector3d(0, 0, 600)
+                }
+
+                // Clustered at one end, so centroid and bounds center differ
+                Node { id: nodeA; position: Qt.vector3d(0, 0, 0) }
+                Node { id: nodeB; position: Qt.vector3d(30, 0, 0) }
+                Node {
+                    id: nodeC
+                    position: Qt.vector3d(120, 60, 0)
+                    eulerRotation: Qt.vector3d(0, 0, 30)
+                }
+            }
+
+            GlobalGizmo {
+                id: globalGizmo
+                anchors.fill: parent
+                view3d: view3d
+                targetNodes: [nodeC, nodeA, nodeB]
+                mode: GizmoEnums.Mode.Translate
+            }
+        }
+    }
+
+    function test_pivot_modes() {
+        var scene = createScene()
+        var selection = scene.gizmo.selection
+        compare(selection.count, 3, "all nodes tracked")
+
+        fuzzyCompare(selection.pivot.x, 50, 0.001, "centroid x")
+        fuzzyCompare(selection.pivot.y, 20, 0.001, "centroid y")
+
+        scene.gizmo.pivotMode = GizmoSelection.BoundsCenter
+        fuzzyCompare(selection.pivot.x, 60, 0.001, "bounds center x")
+        fuzzyCompare(selection.pivot.y, 30, 0.001, "bounds center y")
+
+        scene.gizmo.pivotMode = GizmoSelection.FirstSelected
+        compare(selection.pivot, scene.c.scenePosition, "first selected")
+
+        scene.gizmo.pivotMode = GizmoSelection.IndividualOrigins
+        fuzzyCompare(selection.pivot.x, 50, 0.001, "drawn at the centroid")
+    }
+
+    function test_gizmo_on_pivot() {
+        var scene = createScene()
+        compare(scene.gizmo.activeTarget.scenePosition, scene.gizmo.selection.pivot,
+                "gizmo sits on the pivot")
+        verify(scene.gizmo.visible, "visible without targetNode")
+
+        scene.gizmo.transformMode = GizmoEnums.TransformMode.Local
+        var axes = GizmoMath.getLocalAxes(scene.c.sceneRotation)
+        verify(GizmoMath.vectorEquals(scene.gizmo.currentAxes.x, axes.x),
+               "local axes follow the first selected node")
+    }
+
+    function test_pivot_follows_moves() {
+        var scene = createScene()
+        var selection = scene.gizmo.selection
+        var spy = createTemporaryObject(signalSpyComponent, testCase, {
+            target: selection, signalName: "pivotChanged"
+        })
+
+        // One delta applied to the whole set: the pivot is announced once
+        scene.a.position = Qt.vector3d(0, 30, 0)
+        scene.b.position = Qt.vector3d(30, 30, 0)
+        scene.c.position = Qt.vector3d(120, 90, 0)
+        tryCompare(spy, "count", 1)
+        wait(20)
+        compare(spy.count, 1, "coalesced into one pivotChanged")
+
+        fuzzyCompare(selection.pivot.y, 50, 0.001, "centroid moved with the set")
+        fuzzyCompare(scene.gizmo.activeTarget.position.y, 50, 0.001, "gizmo moved with the set")
+    }
+
+    function test_selection_edits() {
+        var scene = createScene()
+        var selection = scene.gizmo.selection
+
+        scene.gizmo.targetNodes = [scene.a, scene.b]
+        compare(selection.count, 2, "shrunk")
+        fuzzyCompare(selection.pivot.x, 15, 0.001, "pivot of the remaining nodes")
+
+        scene.gizmo.targetNodes = []
+        compare(selection.count, 0, "empty")
+        compare(scene.gizmo.activeTarget, null, "falls back to targetNode")
+        verify(!scene.gizmo.visible, "hidden without a target")
+
+        scene.gizmo.targetNode = scene.b
+        compare(scene.gizmo.activeTarget, scene.b, "single target")
+    }
+}
@@ -0,0 +1,293 @@
+#include <QtTest/QtTest>
+#include <QMatrix4x4>
+#include <QThreadPool>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "core/camerasnapshot.h"
+#include "core/geometrytemplates.h"
+#include "core/gizmogeometry.h"
+#include "core/hittest.h"
+#include "gizmoparallel.h"
+
+using namespace gizmo3d::core;
+
+class TestGizmoGeometry : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Test cases
+    void testProjectCenter();
+    void testArrowGeometry();
+    void testArrowClamping();
+    void testCircleGeometry();
+    void testCircleSmoothing();
+    void testCameraFacingAngle();
+    void testUnitCircleTables();
+    void testArrowHead();
+    void testHitTestArrows();
+    void testHitTestHandles();
+    void testForEachChunkCoversRange();
+    void testParallelMatchesSerial();
+
+private:
+    static CameraSnapshot perspectiveCamera(const QVector3D &position, float width = 800.0f,
+                                            float height = 600.0f);
+};
+
+CameraSnapshot TestGizmoGeometry::perspectiveCamera(const QVector3D &position, float width, float height)
+{
+    QMatrix4x4 transform;
+    transform.translate(position);
+
+    QMatrix4x4 projection;
+    projection.perspective(60.0f, width / height, 10.0f, 10000.0f);
+    const QMatrix4x4 viewProjection = projection * transform.inverted();
+
+    CameraSnapshot snapshot;
+    std::memcpy(snapshot.viewProjection.m, viewProjection.constData(), sizeof(snapshot.viewProjection.m));
+    snapshot.position = {position.x(), position.y(), position.z()};
+    snapshot.forward = {0.0f, 0.0f, -1.0f};
+    snapshot.viewportWidth = width;
+    snapshot.viewportHeight = height;
+    snapshot.clipNear = 10.0f;
+    return snapshot;
+}
+
+void TestGizmoGeometry::testProjectCenter()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    const Vec3 center = camera.project({0.0f, 0.0f, 0.0f});
+
+    QVERIFY(qAbs(center.x - 400.0f) < 0.01f);
+    QVERIFY(qAbs(center.y - 300.0f) < 0.01f);
+    // Distance in front of the near plane, as View3D.mapFrom3DScene reports it
+    QVERIFY(qAbs(center.z - 490.0f) < 0.01f);
+}
+
+void TestGizmoGeometry::testArrowGeometry()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    ArrowParams params;
+    ArrowGeometry geometry;
+    computeArrowGeometry(camera, params, geometry);
+
+    // X points right and Y points up on screen, each scaled to gizmoSize
+    QVERIFY(qAbs(geometry.end[AxisX].x - (400.0f + params.gizmoSize)) < 0.01f);
+    QVERIFY(qAbs(geometry.end[AxisX].y - 300.0f) < 0.01f);
+    QVERIFY(qAbs(geometry.end[AxisY].x - 400.0f) < 0.01f);
+    QVERIFY(qAbs(geometry.end[AxisY].y - (300.0f - params.gizmoSize)) < 0.01f);
+
+    // Start ratio 0 starts every arrow at the center
+    QCOMPARE(geometry.start[AxisZ].x, geometry.center.x);
+    QCOMPARE(geometry.start[AxisZ].y, geometry.center.y);
+
+    // The XY plane quad sits in the upper-right quadrant
+    for (const Vec3 &corner : geometry.planes[PlaneXY]) {
+        QVERIFY(corner.x > 400.0f);
+        QVERIFY(corner.y < 300.0f);
+    }
+}
+
+void TestGizmoGeometry::testArrowClamping()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    ArrowParams params;
+    params.gizmoSize = 300.0f;
+    params.maxScreenSize = 150.0f;
+    HandleGeometry geometry;
+    computeHandleGeometry(camera, params, geometry);
+
+    const Vec2 d{geometry.end[AxisX].x - geometry.center.x, geometry.end[AxisX].y - geometry.center.y};
+    QVERIFY(qAbs(length(d) - params.maxScreenSize) < 0.01f);
+}
+
+void TestGizmoGeometry::testCircleGeometry()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    CircleParams params;
+    CircleGeometry geometry;
+    computeCircleGeometry(camera, params, geometry);
+
+    // segments + 1 points per circle (closed loop)
+    for (const std::vector<Vec2> &circle : geometry.circles)
+        QCOMPARE(int(circle.size()), params.segments + 1);
+
+    // The XY circle faces the camera, so its screen radius is gizmoSize
+    const Vec2 first = geometry.circles[CircleXY].front();
+    QVERIFY(qAbs(length(Vec2{first.x - 400.0f, first.y - 300.0f}) - params.gizmoSize) < 0.1f);
+    QVERIFY(geometry.radii[CircleXY] > 0.0f);
+}
+
+void TestGizmoGeometry::testCircleSmoothing()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    CircleParams params;
+    CircleGeometry unsmoothed;
+    computeCircleGeometry(camera, params, unsmoothed);
+
+    params.hasPreviousRadii = true;
+    params.previousRadii = {0.0f, 0.0f, 0.0f};
+    CircleGeometry smoothed;
+    computeCircleGeometry(camera, params, smoothed);
+
+    QVERIFY(qAbs(smoothed.radii[CircleXY] - unsmoothed.radii[CircleXY] * params.smoothingFactor) < 0.001f);
+}
+
+void TestGizmoGeometry::testCameraFacingAngle()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(500, 0, 0));
+
+    // Camera on +X: in the XY plane (normal Z, reference X) it faces angle 0
+    QVERIFY(qAbs(cameraFacingAngle(camera, {}, {0, 0, 1}, {1, 0, 0})) < 0.001f);
+    // Looking down the normal leaves no facing direction
+    QCOMPARE(cameraFacingAngle(camera, {}, {1, 0, 0}, {0, 1, 0}), 0.0f);
+}
+
+void TestGizmoGeometry::testUnitCircleTables()
+{
+    static_assert(unitCircleTable(kDefaultCircleSegments).size() == kDefaultCircleSegments + 1);
+    static_assert(unitCircleTable(7).empty());
+
+    for (int segments : kCircleSegmentCounts) {
+        const std::span<const UnitCirclePoint> table = unitCircleTable(segments);
+        QCOMPARE(int(table.size()), segments + 1);
+        for (int i = 0; i <= segments; ++i) {
+            const double angle = double(i) / segments * 2.0 * M_PI;
+            QVERIFY(qAbs(table[size_t(i)].cos - std::cos(angle)) < 1e-6);
+            QVERIFY(qAbs(table[size_t(i)].sin - std::sin(angle)) < 1e-6);
+        }
+    }
+
+    // Counts without a table still produce a closed circle
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    CircleParams params;
+    params.segments = 20;
+    CircleGeometry geometry;
+    computeCircleGeometry(camera, params, geometry);
+    QCOMPARE(int(geometry.circles[CircleXY].size()), 21);
+}
+
+void TestGizmoGeometry::testArrowHead()
+{
+    const Vec2 start{10.0f, 10.0f};
+    const Vec2 end{40.0f, 50.0f};
+    const ArrowHead head = arrowHead(start, end, 15.0f);
+
+    // Same points as ArrowRenderer's original atan2/cos/sin formulation
+    const double angle = std::atan2(40.0, 30.0);
+    const double headAngle = M_PI / 6.0;
+    QVERIFY(qAbs(head.shaftEnd.x - (40.0 - 7.5 * std::cos(angle))) < 1e-4);
+    QVERIFY(qAbs(head.shaftEnd.y - (50.0 - 7.5 * std::sin(angle))) < 1e-4);
+    QVERIFY(qAbs(head.left.x - (40.0 - 15.0 * std::cos(angle - headAngle))) < 1e-4);
+    QVERIFY(qAbs(head.left.y - (50.0 - 15.0 * std::sin(angle - headAngle))) < 1e-4);
+    QVERIFY(qAbs(head.right.x - (40.0 - 15.0 * std::cos(angle + headAngle))) < 1e-4);
+    QVERIFY(qAbs(head.right.y - (50.0 - 15.0 * std::sin(angle + headAngle))) < 1e-4);
+}
+
+void TestGizmoGeometry::testHitTestArrows()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    ArrowParams params;
+    ArrowGeometry geometry;
+    computeArrowGeometry(camera, params, geometry);
+
+    // Halfway along the X arrow (GizmoEnums.Axis.X = 1)
+    HitResult hit = hitTestArrows(geometry, {450.0f, 302.0f}, 10.0f);
+    QCOMPARE(int(hit.type), int(HitType::Axis));
+    QCOMPARE(hit.axis, 1);
+
+    // Center of the XY plane quad (GizmoEnums.Plane.XY = 1)
+    Vec2 quadCenter;
+    for (const Vec3 &corner : geometry.planes[PlaneXY])
+        quadCenter = {quadCenter.x + corner.x / 4.0f, quadCenter.y + corner.y / 4.0f};
+    hit = hitTestArrows(geometry, quadCenter, 10.0f);
+    QCOMPARE(int(hit.type), int(HitType::Plane));
+    QCOMPARE(hit.plane, 1);
+
+    hit = hitTestArrows(geometry, {100.0f, 100.0f}, 10.0f);
+    QCOMPARE(int(hit.type), int(HitType::None));
+}
+
+void TestGizmoGeometry::testHitTestHandles()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    ArrowParams params;
+    HandleGeometry geometry;
+    computeHandleGeometry(camera, params, geometry);
+
+    // The center handle wins over the axes that start there (GizmoEnums.Axis.Uniform = 4)
+    HitResult hit = hitTestHandles(geometry, {402.0f, 301.0f}, 10.0f, 12.0f);
+    QCOMPARE(int(hit.type), int(HitType::Center));
+    QCOMPARE(hit.axis, 4);
+
+    // Along the Y handle, which points up on screen (GizmoEnums.Axis.Y = 2)
+    hit = hitTestHandles(geometry, {401.0f, 240.0f}, 10.0f, 12.0f);
+    QCOMPARE(int(hit.type), int(HitType::Axis));
+    QCOMPARE(hit.axis, 2);
+}
+
+void TestGizmoGeometry::testForEachChunkCoversRange()
+{
+    QThreadPool pool;
+    pool.setMaxThreadCount(4);
+
+    const int count = 1003;
+    std::vector<int> hits(count, 0);
+    gizmo3d::forEachChunk(&pool, count, 16, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i)
+            ++hits[size_t(i)];
+    });
+
+    for (int i = 0; i < count; ++i)
+        QCOMPARE(hits[size_t(i)], 1);
+
+    // Null pool and empty ranges run inline
+    int calls = 0;
+    gizmo3d::forEachChunk(nullptr, 10, 4, [&](int begin, int end) {
+        QCOMPARE(begin, 0);
+        QCOMPARE(end, 10);
+        ++calls;
+    });
+    gizmo3d::forEachChunk(&pool, 0, 4, [&](int, int) { ++calls; });
+    QCOMPARE(calls, 1);
+}
+
+void TestGizmoGeometry::testParallelMatchesSerial()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(120, 80, 600));
+    const int count = 500;
+
+    std::vector<CircleParams> params(count);
+    for (int i = 0; i < count; ++i)
+        params[size_t(i)].targetPosition = {float(i % 20) * 10.0f - 100.0f, float(i / 20) * 5.0f, 0.0f};
+
+    std::vector<CircleGeometry> serial(count);
+    for (int i = 0; i < count; ++i)
+        computeCircleGeometry(camera, params[size_t(i)], serial[size_t(i)]);
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(4);
+    std::vector<CircleGeometry> parallel(count);
+    gizmo3d::forEachChunk(&pool, count, 8, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i)
+            computeCircleGeometry(camera, params[size_t(i)], parallel[size_t(i)]);
+    });
+
+    // Pure functions of their inputs: results are bit-identical
+    for (int i = 0; i < count; ++i) {
+        for (int p = 0; p < 3; ++p) {
+            QCOMPARE(parallel[size_t(i)].radii[size_t(p)], serial[size_t(i)].radii[size_t(p)]);
+            const std::vector<Vec2> &a = parallel[size_t(i)].circles[size_t(p)];
+            const std::vector<Vec2> &b = serial[size_t(i)].circles[size_t(p)];
+            QCOMPARE(a.size(), b.size());
+            QVERIFY(std::memcmp(a.data(), b.data(), a.size() * sizeof(Vec2)) == 0);
+        }
+    }
+}
+
+QTEST_MAIN(TestGizmoGeometry)
+#include "tst_gizmogeometry.moc"
@@ -0,0 +1,95 @@
+import QtQuick
+import QtQuick3D
+import QtTest
+import Gizmo3D
+
+// GlobalGizmo creates its child gizmos on first use: only the children the mode
+// shows exist, switching modes creates the rest, and releaseDelay destroys
+// hidden children again.
+SceneTestCase {
+    id: testCase
+    name: "GlobalGizmoLazy"
+    sceneComponent: lazySceneComponent
+
+    Component {
+        id: lazySceneComponent
+        Item {
+            width: 800
+            height: 600
+
+            property alias gizmo: globalGizmo
+
+            View3D {
+                id: view
+                anchors.fill: parent
+
+                PerspectiveCamera {
+                    position: Qt.vector3d(0, 0, 300)
+                }
+
+                Node {
+                    id: targetNode
+                }
+            }
+
+            GlobalGizmo {
+                id: globalGizmo
+                anchors.fill: parent
+                view3d: view
+                targetNode: targetNode
+                mode: GizmoEnums.Mode.Translate
+            }
+        }
+    }
+
+    function test_only_shown_children_created() {
+        var gizmo = createScene().gizmo
+        verify(gizmo.translationGizmo !== null, "translation created for Translate mode")
+        compare(gizmo.rotationGizmo, null, "rotation not created")
+        compare(gizmo.scaleGizmo, null, "scale not created")
+        compare(gizmo.activeAxis, GizmoEnums.Axis.None)
+        compare(gizmo.activePlane, GizmoEnums.Plane.None)
+        verify(!gizmo.isActive)
+    }
+
+    function test_mode_switch_creates_children() {
+        var gizmo = createScene().gizmo
+        gizmo.mode = GizmoEnums.Mode.Rotate
+        verify(gizmo.rotationGizmo !== null, "rotation created on first use")
+        verify(gizmo.rotationGizmo.visible, "rotation shown")
+        verify(!gizmo.translationGizmo.visible, "translation kept but hidden")
+
+        gizmo.mode = GizmoEnums.Mode.All
+        verify(gizmo.scaleGizmo !== null, "scale created for All mode")
+        compare(gizmo.scaleGizmo.arrowEndRatio, 0.5, "composite arrow ratios bound")
+    }
+
+    function test_preload_creates_all() {
+        var gizmo = createScene().gizmo
+        gizmo.preloadSubGizmos = true
+        verify(gizmo.rotationGizmo !== null && gizmo.scaleGizmo !== null, "all children created")
+        verify(!gizmo.rotationGizmo.visible && !gizmo.scaleGizmo.visible, "hidden by the mode")
+    }
+
+    function test_release_after_idle() {
+        var gizmo = createScene().gizmo
+        gizmo.releaseDelay = 50
+        gizmo.mode = GizmoEnums.Mode.Rotate
+        verify(gizmo.translationGizmo !== null, "hidden child kept until the delay expires")
+        tryCompare(gizmo, "translationGizmo", null, 2000)
+        verify(gizmo.rotationGizmo !== null, "shown child not released")
+
+        gizmo.mode = GizmoEnums.Mode.Translate
+        verify(gizmo.translationGizmo !== null, "recreated on next use")
+    }
+
+    function test_signals_forwarded_from_lazy_child() {
+        var gizmo = createScene().gizmo
+        gizmo.mode = GizmoEnums.Mode.Scale
+        var spy = createTemporaryQmlObject("import QtTest; SignalSpy { signalName: \"scaleStarted\" }",
+                                           testCase)
+        spy.target = gizmo
+        gizmo.scaleGizmo.scaleStarted(GizmoEnums.Axis.X)
+        compare(spy.count, 1, "signal forwarded once")
+    }
+}
@@ -0,0 +1,312 @@
+#include <QtTest/QtTest>
+#include <QMatrix4x4>
+
+#include <cstring>
+
+#include "core/interaction.h"
+#include "core/snap.h"
+
+using namespace gizmo3d::core;
+
+class TestInteraction : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Test cases
+    void testInvert();
+    void testFromMatrices();
+    void testCameraRay();
+    void testSnapValue();
+    void testSnapPlaneMovement();
+    void testTranslationAxisDrag();
+    void testTranslationPlaneDrag();
+    void testTranslationMissStaysIdle();
+    void testRotationDrag();
+    void testRotationSnap();
+    void testScaleUniformDrag();
+    void testScaleAxisSnap();
+
+private:
+    static Mat4 toCore(const QMatrix4x4 &matrix);
+    static CameraSnapshot perspectiveCamera(const QVector3D &position);
+    static CameraSnapshot orthographicCamera(const QVector3D &position);
+
+    // Screen pixels per world unit at the origin for perspectiveCamera(0, 0, 500)
+    static float pixelsPerUnit() { return 300.0f / (500.0f * std::tan(qDegreesToRadians(30.0f))); }
+};
+
+Mat4 TestInteraction::toCore(const QMatrix4x4 &matrix)
+{
+    Mat4 result;
+    std::memcpy(result.m, matrix.constData(), sizeof(result.m));
+    return result;
+}
+
+CameraSnapshot TestInteraction::perspectiveCamera(const QVector3D &position)
+{
+    QMatrix4x4 transform;
+    transform.translate(position);
+    QMatrix4x4 projection;
+    projection.perspective(60.0f, 800.0f / 600.0f, 10.0f, 10000.0f);
+
+    CameraSnapshot snapshot;
+    CameraSnapshot::fromMatrices(toCore(transform), toCore(projection), 800.0f, 600.0f, 10.0f,
+                                 false, &snapshot);
+    return snapshot;
+}
+
+CameraSnapshot TestInteraction::orthographicCamera(const QVector3D &position)
+{
+    QMatrix4x4 transform;
+    transform.translate(position);
+    QMatrix4x4 projection;
+    projection.ortho(-400.0f, 400.0f, -300.0f, 300.0f, 10.0f, 10000.0f);
+
+    CameraSnapshot snapshot;
+    CameraSnapshot::fromMatrices(toCore(transform), toCore(projection), 800.0f, 600.0f, 10.0f,
+                                 true, &snapshot);
+    return snapshot;
+}
+
+void TestInteraction::testInvert()
+{
+    QMatrix4x4 matrix;
+    matrix.perspective(45.0f, 1.5f, 1.0f, 100.0f);
+    matrix.rotate(30.0f, 1.0f, 2.0f, 3.0f);
+    matrix.translate(4.0f, -5.0f, 6.0f);
+
+    Mat4 inverse;
+    QVERIFY(invert(toCore(matrix), &inverse));
+    const QMatrix4x4 expected = matrix.inverted();
+    for (int i = 0; i < 16; ++i)
+        QVERIFY(qAbs(inverse.m[i] - expected.constData()[i]) < 1e-4f);
+
+    // Singular matrices are rejected
+    Mat4 zero;
+    std::memset(zero.m, 0, sizeof(zero.m));
+    QVERIFY(!invert(zero, &inverse));
+}
+
+void TestInteraction::testFromMatrices()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+
+    QCOMPARE(camera.position.z, 500.0f);
+    QCOMPARE(camera.forward.z, -1.0f);
+
+    const Vec3 center = camera.project({0.0f, 0.0f, 0.0f});
+    QVERIFY(qAbs(center.x - 400.0f) < 0.01f);
+    QVERIFY(qAbs(center.y - 300.0f) < 0.01f);
+    QVERIFY(qAbs(center.z - 490.0f) < 0.01f);
+}
+
+void TestInteraction::testCameraRay()
+{
+    const CameraSnapshot perspective = perspectiveCamera(QVector3D(0, 0, 500));
+    Mat4 inverse;
+    QVERIFY(invert(perspective.viewProjection, &inverse));
+
+    // Perspective rays start at the camera
+    Ray ray = cameraRay(perspective, inverse, {400.0f, 300.0f});
+    QVERIFY(qAbs(ray.origin.z - 500.0f) < 0.01f);
+    QVERIFY(qAbs(ray.direction.z + 1.0f) < 0.001f);
+
+    // Orthographic rays are parallel and start on the near plane under the pixel
+    const CameraSnapshot ortho = orthographicCamera(QVector3D(0, 0, 500));
+    QVERIFY(invert(ortho.viewProjection, &inverse));
+    ray = cameraRay(ortho, inverse, {500.0f, 300.0f});
+    QVERIFY(qAbs(ray.origin.x - 100.0f) < 0.01f);
+    QVERIFY(qAbs(ray.origin.z - 490.0f) < 0.01f);
+    QVERIFY(qAbs(ray.direction.z + 1.0f) < 0.001f);
+}
+
+void TestInteraction::testSnapValue()
+{
+    QCOMPARE(snapValue(1.2f, 0.5f), 1.0f);
+    QCOMPARE(snapValue(-7.0f, 5.0f), -5.0f);
+    // Ties round up like JavaScript's Math.round
+    QCOMPARE(snapValue(2.5f, 1.0f), 3.0f);
+    QCOMPARE(snapValue(-2.5f, 1.0f), -2.0f);
+    // Non-positive increments disable snapping
+    QCOMPARE(snapValue(1.234f, 0.0f), 1.234f);
+    QCOMPARE(snapValueAbsolute(12.6f, 5.0f), 15.0f);
+}
+
+void TestInteraction::testSnapPlaneMovement()
+{
+    // Absolute: start 0.3 + delta 1.0 snaps to 1.0, so the delta becomes 0.7
+    Vec3 snapped = snapPlaneMovement({1.0f, 2.2f, 9.0f}, kPlaneXY, {0.3f, 0.0f, 0.0f}, 1.0f, true);
+    QVERIFY(qAbs(snapped.x - 0.7f) < 0.0001f);
+    QCOMPARE(snapped.y, 2.0f);
+    QCOMPARE(snapped.z, 0.0f);
+
+    // Relative: components snap on their own, the normal component is dropped
+    snapped = snapPlaneMovement({1.4f, 9.0f, -0.6f}, kPlaneXZ, {0.3f, 0.0f, 0.0f}, 1.0f, false);
+    QCOMPARE(snapped.x, 1.0f);
+    QCOMPARE(snapped.y, 0.0f);
+    QCOMPARE(snapped.z, -1.0f);
+}
+
+void TestInteraction::testTranslationAxisDrag()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    ArrowParams params;
+    ArrowGeometry geometry;
+    computeArrowGeometry(camera, params, geometry);
+
+    TranslationInteraction interaction;
+    const HitResult hit = interaction.press(camera, geometry, params, {450.0f, 300.0f});
+    QCOMPARE(int(hit.type), int(HitType::Axis));
+    QCOMPARE(hit.axis, kAxisX);
+    QVERIFY(interaction.isActive());
+
+    // 50 pixels to the right moves along +X by 50 pixels' worth of world units
+    TranslationDelta delta;
+    QVERIFY(interaction.move({500.0f, 300.0f}, &delta));
+    QCOMPARE(delta.axis, kAxisX);
+    QVERIFY(qAbs(delta.distance - 50.0f / pixelsPerUnit()) < 0.01f);
+    QVERIFY(!delta.snapped);
+
+    interaction.snap = {true, 10.0f, true};
+    QVERIFY(interaction.move({500.0f, 300.0f}, &delta));
+    QCOMPARE(delta.distance, 50.0f);
+    QVERIFY(delta.snapped);
+
+    QCOMPARE(interaction.release().axis, kAxisX);
+    QVERIFY(!interaction.isActive());
+    QVERIFY(!interaction.move({500.0f, 300.0f}, &delta));
+}
+
+void TestInteraction::testTranslationPlaneDrag()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    ArrowParams params;
+    ArrowGeometry geometry;
+    computeArrowGeometry(camera, params, geometry);
+
+    Vec2 quadCenter;
+    for (const Vec3 &corner : geometry.planes[PlaneXY])
+        quadCenter = {quadCenter.x + corner.x / 4.0f, quadCenter.y + corner.y / 4.0f};
+
+    TranslationInteraction interaction;
+    const HitResult hit = interaction.press(camera, geometry, params, quadCenter);
+    QCOMPARE(int(hit.type), int(HitType::Plane));
+    QCOMPARE(hit.plane, kPlaneXY);
+
+    // Up and to the right on screen is +X +Y in the XY plane
+    TranslationDelta delta;
+    QVERIFY(interaction.move({quadCenter.x + 52.0f, quadCenter.y - 52.0f}, &delta));
+    QCOMPARE(delta.plane, kPlaneXY);
+    QVERIFY(delta.planeDelta.x > 40.0f);
+    QVERIFY(qAbs(delta.planeDelta.x - delta.planeDelta.y) < 0.01f);
+    QVERIFY(qAbs(delta.planeDelta.z) < 0.01f);
+}
+
+void TestInteraction::testTranslationMissStaysIdle()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    ArrowParams params;
+    ArrowGeometry geometry;
+    computeArrowGeometry(camera, params, geometry);
+
+    TranslationInteraction interaction;
+    const HitResult hit = interaction.press(camera, geometry, params, {100.0f, 100.0f});
+    QCOMPARE(int(hit.type), int(HitType::None));
+    QVERIFY(!interaction.isActive());
+}
+
+void TestInteraction::testRotationDrag()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    CircleParams params;
+    CircleGeometry geometry;
+    computeCircleGeometry(camera, params, geometry);
+
+    // Grab the XY circle (Z rotation) at angle 0, then drag a quarter turn
+    const std::vector<Vec2> &circle = geometry.circles[CircleXY];
+    RotationInteraction interaction;
+    const HitResult hit = interaction.press(camera, geometry, params, circle.front());
+    QCOMPARE(int(hit.type), int(HitType::Circle));
+    QCOMPARE(hit.axis, kAxisZ);
+    QVERIFY(qAbs(interaction.dragStartAngle()) < 0.001f);
+
+    RotationDelta delta;
+    QVERIFY(interaction.move(circle[size_t(params.segments / 4)], &delta));
+    QCOMPARE(delta.axis, kAxisZ);
+    QVERIFY(qAbs(delta.degrees - 90.0f) < 0.01f);
+    QVERIFY(qAbs(delta.currentAngle - qDegreesToRadians(90.0f)) < 0.001f);
+
+    interaction.release();
+    QCOMPARE(interaction.currentAngle(), 0.0f);
+}
+
+void TestInteraction::testRotationSnap()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    CircleParams params;
+    CircleGeometry geometry;
+    computeCircleGeometry(camera, params, geometry);
+
+    // 48 segments: index 3 is 22.5°, which snaps to 30° in 15° steps
+    const std::vector<Vec2> &circle = geometry.circles[CircleXY];
+    RotationInteraction interaction;
+    interaction.snap.enabled = true;
+    QCOMPARE(int(interaction.press(camera, geometry, params, circle.front()).type),
+             int(HitType::Circle));
+
+    RotationDelta delta;
+    QVERIFY(interaction.move(circle[3], &delta));
+    QVERIFY(qAbs(delta.degrees - 30.0f) < 0.01f);
+    // Wedge feedback follows the snapped angle
+    QVERIFY(qAbs(delta.currentAngle - qDegreesToRadians(30.0f)) < 0.001f);
+}
+
+void TestInteraction::testScaleUniformDrag()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    ArrowParams params;
+    HandleGeometry geometry;
+    computeHandleGeometry(camera, params, geometry);
+
+    ScaleInteraction interaction;
+    const HitResult hit = interaction.press(camera, geometry, params, {1.0f, 1.0f, 1.0f},
+                                            {400.0f, 300.0f});
+    QCOMPARE(int(hit.type), int(HitType::Center));
+    QCOMPARE(hit.axis, kAxisUniform);
+
+    // 100 pixels up = 2x; 50 pixels up = 1.5x
+    ScaleDelta delta;
+    QVERIFY(interaction.move({400.0f, 250.0f}, &delta));
+    QCOMPARE(delta.axis, kAxisUniform);
+    QVERIFY(qAbs(delta.factor - 1.5f) < 0.001f);
+
+    // Dragging far down clamps instead of flipping the scale
+    QVERIFY(interaction.move({400.0f, 600.0f}, &delta));
+    QCOMPARE(delta.factor, 0.01f);
+}
+
+void TestInteraction::testScaleAxisSnap()
+{
+    const CameraSnapshot camera = perspectiveCamera(QVector3D(0, 0, 500));
+    ArrowParams params;
+    HandleGeometry geometry;
+    computeHandleGeometry(camera, params, geometry);
+
+    ScaleInteraction interaction;
+    interaction.snap = {true, 0.5f, true};
+    const HitResult hit = interaction.press(camera, geometry, params, {2.0f, 1.0f, 1.0f},
+                                            {450.0f, 300.0f});
+    QCOMPARE(hit.axis, kAxisX);
+
+    // Moving along the axis grows the scale; absolute snapping lands on the 0.5 grid
+    ScaleDelta delta;
+    QVERIFY(interaction.move({550.0f, 300.0f}, &delta));
+    QVERIFY(delta.snapped);
+    const float absolute = 2.0f * delta.factor;
+    QVERIFY(absolute > 2.0f);
+    QVERIFY(qAbs(absolute / 0.5f - std::round(absolute / 0.5f)) < 0.001f);
+}
+
+QTEST_GUILESS_MAIN(TestInteraction)
+#include "tst_interaction.moc"
@@ -0,0 +1,159 @@
+import QtQuick
+import QtQuick3D
+import QtTest
+import Gizmo3D
+
+// MultiViewGizmo: one logical gizmo shown in two views. Verifies the per-view gizmos are
+// placed inside their views, share target-side state, and that a drag in one view owns
+// the session (mirrored highlight, other views locked, signals emitted once).
+SceneTestCase {
+    id: testCase
+    name: "MultiViewGizmo"
+    sceneComponent: twoViewSceneComponent
+
+    Component {
+        id: twoViewSceneComponent
+        Item {
+            width: 800
+            height: 600
+
+            property alias leftView: leftView
+            property alias rightView: rightView
+            property alias target: targetNode
+            property alias gizmo: multiGizmo
+
+            Node {
+                id: sceneRoot
+
+                DirectionalLight {
+                    eulerRotation: Qt.vector3d(-45, 45, 0)
+                }
+
+                Node {
+                    id: targetNode
+                    Model {
+                        source: "#Cube"
+                        materials: DefaultMaterial { diffuseColor: "blue" }
+                    }
+                }
+            }
+
+            View3D {
+                id: leftView
+                x: 0; y: 0; width: 400; height: 600
+                importScene: sceneRoot
+                camera: leftCamera
+                PerspectiveCamera {
+                    id: leftCamera
+                    position: Qt.vector3d(0, 0, 300)
+                }
+            }
+
+            View3D {
+                id: rightView
+                x: 400; y: 0; width: 400; height: 600
+                importScene: sceneRoot
+                camera: rightCamera
+                PerspectiveCamera {
+                    id: rightCamera
+                    position: Qt.vector3d(300, 0, 0)
+                    eulerRotation.y: 90
+                }
+            }
+
+            MultiViewGizmo {
+                id: multiGizmo
+                views: [leftView, rightView]
+                targetNode: targetNode
+                mode: GizmoEnums.Mode.Translate
+                gizmoSize: 80
+            }
+        }
+    }
+
+    // The TranslationGizmo child of a per-view GlobalGizmo
+    function translationChild(viewGizmo) {
+        return viewGizmo.translationGizmo
+    }
+
+    function test_one_gizmo_per_view() {
+        var scene = createScene()
+        var left = scene.gizmo.gizmoForView(scene.leftView)
+        var right = scene.gizmo.gizmoForView(scene.rightView)
+
+        verify(left !== null && right !== null, "a gizmo for each view")
+        verify(left !== right, "distinct presentations")
+        compare(left.parent, scene.leftView, "left gizmo lives in the left view")
+        compare(right.parent, scene.rightView, "right gizmo lives in the right view")
+        compare(left.width, scene.leftView.width, "covers its view")
+        verify(left.managedByParent && right.managedByParent, "driven by the shared coordinator")
+    }
+
+    function test_axes_shared_across_views() {
+        var scene = createScene()
+        scene.gizmo.transformMode = GizmoEnums.TransformMode.Local
+        scene.target.eulerRotation = Qt.vector3d(0, 45, 0)
+
+        var left = scene.gizmo.gizmoForView(scene.leftView)
+        var right = scene.gizmo.gizmoForView(scene.rightView)
+        verify(left.currentAxes === scene.gizmo.currentAxes, "left uses the shared axes")
+        verify(right.currentAxes === scene.gizmo.currentAxes, "right uses the shared axes")
+        verify(translationChild(left).currentAxes === scene.gizmo.currentAxes,
+               "child gizmos use the shared axes")
+    }
+
+    function test_geometry_updated_in_every_view() {
+        var scene = createScene()
+        scene.target.position = Qt.vector3d(20, 10, 0)
+        waitForRendering(scene, 5000)
+        wait(50)
+
+        var views = [scene.leftView, scene.rightView]
+        for (var i = 0; i < views.length; i++) {
+            var child = translationChild(scene.gizmo.gizmoForView(views[i]))
+            verify(child.geometry !== null, "geometry for view " + i)
+            var expected = views[i].mapFrom3DScene(scene.target.scenePosition)
+            fuzzyCompare(child.geometry.center.x, expected.x, 1.0, "center x in view " + i)
+            fuzzyCompare(child.geometry.center.y, expected.y, 1.0, "center y in view " + i)
+        }
+    }
+
+    function test_drag_session_shared() {
+        var scene = createScene()
+        wait(50)
+
+        var left = scene.gizmo.gizmoForView(scene.leftView)
+        var right = scene.gizmo.gizmoForView(scene.rightView)
+        var leftTranslation = translationChild(left)
+        var rightTranslation = translationChild(right)
+        var geometry = leftTranslation.calculateGizmoGeometry()
+        verify(geometry !== null, "Geometry should be calculated")
+
+        var startedSpy = createTemporaryObject(signalSpyComponent, testCase, {
+            target: scene.gizmo, signalName: "axisTranslationStarted"
+        })
+        var endedSpy = createTemporaryObject(signalSpyComponent, testCase, {
+            target: scene.gizmo, signalName: "axisTranslationEnded"
+        })
+
+        mousePress(left, geometry.xEnd.x, geometry.xEnd.y)
+        if (left.activeAxis === GizmoEnums.Axis.None) {
+            mouseRelease(left, geometry.xEnd.x, geometry.xEnd.y)
+            skip("Hit detection not available in offscreen rendering mode")
+        }
+
+        compare(startedSpy.count, 1, "started emitted once")
+        compare(scene.gizmo.activeView, scene.leftView, "left view owns the drag")
+        compare(scene.gizmo.activeAxis, GizmoEnums.Axis.X, "shared active axis")
+        compare(rightTranslation.activeAxis, GizmoEnums.Axis.X, "right view mirrors the handle")
+        verify(!right.enabled, "right view ignores presses during the drag")
+
+        mouseRelease(left, geometry.xEnd.x, geometry.xEnd.y)
+
+        compare(endedSpy.count, 1, "ended emitted once")
+        compare(scene.gizmo.activeView, null, "session released")
+        compare(scene.gizmo.activeAxis, GizmoEnums.Axis.None, "no active axis")
+        compare(rightTranslation.activeAxis, GizmoEnums.Axis.None, "mirror cleared")
+        verify(right.enabled, "right view accepts presses again")
+    }
+}
@@ -0,0 +1,141 @@
+import QtQuick
+import QtTest
+import Gizmo3D
+
+// Deterministic tests for orthographic camera support, using MockProjection.
+// They guard the two properties the orthographic fast path relies on:
+//   - camera rays are parallel (one direction, per-pixel origin), and
+//   - a pure pan only shifts the projected gizmo, so offsetGeometry() on the cached
+//     geometry must match a full recompute at the new position.
+TestCase {
+    id: testCase
+    name: "OrthographicProjection"
+
+    function projector() {
+        return MockProjection.createProjector({
+            type: "orthographic",
+            cameraPosition: Qt.vector3d(0, 0, 10),
+            viewportSize: Qt.size(800, 600),
+            scale: 100
+        })
+    }
+
+    function worldAxes() {
+        return { x: Qt.vector3d(1, 0, 0), y: Qt.vector3d(0, 1, 0), z: Qt.vector3d(0, 0, 1) }
+    }
+
+    function config(targetPosition) {
+        return {
+            projector: projector(),
+            targetPosition: targetPosition,
+            axes: worldAxes(),
+            gizmoSize: 80,
+            maxScreenSize: 120,
+            maxScreenRadius: 100
+        }
+    }
+
+    function comparePoint(actual, expected, label) {
+        fuzzyCompare(actual.x, expected.x, 0.001, label + ".x")
+        fuzzyCompare(actual.y, expected.y, 0.001, label + ".y")
+    }
+
+    function screenOffset(from, to) {
+        var a = GizmoProjection.projectWorldToScreen(from, projector())
+        var b = GizmoProjection.projectWorldToScreen(to, projector())
+        return Qt.point(b.x - a.x, b.y - a.y)
+    }
+
+    function test_projector_reports_orthographic() {
+        verify(GizmoProjection.isOrthographic(projector()), "orthographic mock")
+        var persp = MockProjection.createProjector({ type: "perspective" })
+        verify(!GizmoProjection.isOrthographic(persp), "perspective mock")
+    }
+
+    function test_rays_are_parallel() {
+        var p = projector()
+        var a = GizmoProjection.getCameraRay(Qt.point(100, 100), p)
+        var b = GizmoProjection.getCameraRay(Qt.point(700, 500), p)
+
+        compare(a.direction, b.direction, "same direction for every pixel")
+        compare(a.direction, GizmoProjection.getCameraForward(p), "direction is camera forward")
+        verify(a.origin.x !== b.origin.x || a.origin.y !== b.origin.y,
+               "origins differ across the screen")
+    }
+
+    function test_translation_offset_matches_recompute() {
+        var from = Qt.vector3d(0, 0, 0)
+        var to = Qt.vector3d(1.5, -0.75, 0)
+        var d = screenOffset(from, to)
+
+        var cached = TranslationGeometryCalculator.calculateArrowGeometry(config(from))
+        var shifted = TranslationGeometryCalculator.offsetGeometry(cached, d.x, d.y)
+        var full = TranslationGeometryCalculator.calculateArrowGeometry(config(to))
+
+        comparePoint(shifted.center, full.center, "center")
+        var keys = ["xStart", "xEnd", "yStart", "yEnd", "zStart", "zEnd"]
+        for (var i = 0; i < keys.length; i++)
+            comparePoint(shifted[keys[i]], full[keys[i]], keys[i])
+        var planes = ["xy", "xz", "yz"]
+        for (var p = 0; p < planes.length; p++) {
+            for (var c = 0; c < 4; c++)
+                comparePoint(shifted.planes[planes[p]][c], full.planes[planes[p]][c],
+                             planes[p] + "[" + c + "]")
+        }
+    }
+
+    function test_scale_offset_matches_recompute() {
+        var from = Qt.vector3d(0, 0, 0)
+        var to = Qt.vector3d(-2, 1, 0)
+        var d = screenOffset(from, to)
+
+        var cached = ScaleGeometryCalculator.calculateHandleGeometry(config(from))
+        var shifted = ScaleGeometryCalculator.offsetGeometry(cached, d.x, d.y)
+        var full = ScaleGeometryCalculator.calculateHandleGeometry(config(to))
+
+        comparePoint(shifted.center, full.center, "center")
+        var keys = ["xStart", "xEnd", "yStart", "yEnd", "zStart", "zEnd"]
+        for (var i = 0; i < keys.length; i++)
+            comparePoint(shifted[keys[i]], full[keys[i]], keys[i])
+    }
+
+    function test_rotation_offset_matches_recompute() {
+        var from = Qt.vector3d(0, 0, 0)
+        var to = Qt.vector3d(0.5, 2, 0)
+        var d = screenOffset(from, to)
+
+        var cached = RotationGeometryCalculator.calculateCircleGeometry(config(from))
+        var shifted = RotationGeometryCalculator.offsetGeometry(cached, d.x, d.y)
+        var full = RotationGeometryCalculator.calculateCircleGeometry(config(to))
+
+        comparePoint(shifted.center, full.center, "center")
+        compare(shifted.radii, cached.radii, "radii reused")
+        var planes = ["xy", "yz", "zx"]
+        for (var p = 0; p < planes.length; p++) {
+            var s = shifted.circles[planes[p]]
+            var f = full.circles[planes[p]]
+            compare(s.length, f.length, planes[p] + " point count")
+            for (var i = 0; i < s.length; i++)
+                comparePoint(s[i], f[i], planes[p] + "[" + i + "]")
+        }
+    }
+
+    function test_offset_geometry_null_safe() {
+        compare(TranslationGeometryCalculator.offsetGeometry(null, 1, 1), null)
+        compare(ScaleGeometryCalculator.offsetGeometry(null, 1, 1), null)
+        compare(RotationGeometryCalculator.offsetGeometry(null, 1, 1), null)
+    }
+
+    // Under an orthographic camera the facing angle depends only on the view direction,
+    // so panning the target must not change it.
+    function test_facing_angle_stable_under_pan() {
+        var p = projector()
+        var normal = Qt.vector3d(0, 1, 0)
+        var reference = Qt.vector3d(1, 0, 0)
+        var a = RotationGeometryCalculator.calculateCameraFacingAngle(
+                    Qt.vector3d(0, 0, 0), normal, reference, p)
+        var b = RotationGeometryCalculator.calculateCameraFacingAngle(
+                    Qt.vector3d(5, 0, -3), normal, reference, p)
+        fuzzyCompare(a, b, 0.0001, "facing angle unchanged by pan")
+    }
+}
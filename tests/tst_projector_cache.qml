@@ -0,0 +1,152 @@
+import QtQuick
+import QtQuick3D
+import QtTest
+import Gizmo3D
+
+// Per-View3D projector cache: alternating between views must reuse one native projector
+// per view, projectors must follow camera/viewport changes, and entries must be evicted
+// when their view is destroyed.
+SceneTestCase {
+    id: testCase
+    name: "ProjectorCache"
+    sceneComponent: dualViewComponent
+
+    Component {
+        id: dualViewComponent
+        Item {
+            width: 800
+            height: 600
+
+            property alias left: leftView
+            property alias right: rightView
+            property alias perspectiveCamera: leftCamera
+            property alias orthoCamera: rightCamera
+
+            View3D {
+                id: leftView
+                x: 0; y: 0; width: 400; height: 600
+                camera: leftCamera
+
+                PerspectiveCamera {
+                    id: leftCamera
+                    position: Qt.vector3d(0, 100, 300)
+                    eulerRotation.x: -15
+                }
+
+                Model {
+                    source: "#Cube"
+                    materials: DefaultMaterial { diffuseColor: "blue" }
+                }
+            }
+
+            View3D {
+                id: rightView
+                x: 400; y: 0; width: 400; height: 600
+                camera: rightCamera
+
+                OrthographicCamera {
+                    id: rightCamera
+                    position: Qt.vector3d(0, 0, 500)
+                    horizontalMagnification: 2
+                    verticalMagnification: 2
+                }
+
+                Model {
+                    source: "#Sphere"
+                    materials: DefaultMaterial { diffuseColor: "red" }
+                }
+            }
+        }
+    }
+
+    function compareScreen(actual, expected, label) {
+        fuzzyCompare(actual.x, expected.x, 1.0, label + ".x")
+        fuzzyCompare(actual.y, expected.y, 1.0, label + ".y")
+    }
+
+    function test_one_projector_per_view() {
+        var scene = createScene()
+        var before = GizmoProjectorCache.count
+
+        var a1 = View3DProjectionAdapter.createProjector(scene.left)
+        var b1 = View3DProjectionAdapter.createProjector(scene.right)
+        var a2 = View3DProjectionAdapter.createProjector(scene.left)
+        var b2 = View3DProjectionAdapter.createProjector(scene.right)
+
+        verify(a1 !== null && b1 !== null, "projectors created")
+        verify(a1 === a2, "alternating calls reuse the left projector")
+        verify(b1 === b2, "alternating calls reuse the right projector")
+        verify(a1 !== b1, "each view has its own projector")
+        compare(GizmoProjectorCache.count, before + 2, "one cache entry per view")
+    }
+
+    function test_native_projection_matches_view3d() {
+        var scene = createScene()
+        var points = [Qt.vector3d(0, 0, 0), Qt.vector3d(40, -25, 10), Qt.vector3d(-60, 30, -20)]
+        var views = [scene.left, scene.right]
+
+        for (var v = 0; v < views.length; v++) {
+            var projector = View3DProjectionAdapter.createProjector(views[v])
+            for (var i = 0; i < points.length; i++) {
+                compareScreen(projector.projectWorldToScreen(points[i]),
+                              views[v].mapFrom3DScene(points[i]),
+                              "view " + v + " point " + i)
+            }
+        }
+    }
+
+    function test_projector_follows_camera_changes() {
+        var scene = createScene()
+        var projector = View3DProjectionAdapter.createProjector(scene.left)
+        var before = projector.projectWorldToScreen(Qt.vector3d(0, 0, 0))
+
+        scene.perspectiveCamera.position = Qt.vector3d(80, 100, 300)
+        waitForRendering(scene, 5000)
+
+        var after = projector.projectWorldToScreen(Qt.vector3d(0, 0, 0))
+        verify(Math.abs(after.x - before.x) > 1, "projection reflects the camera move")
+        compareScreen(after, scene.left.mapFrom3DScene(Qt.vector3d(0, 0, 0)), "after move")
+        compare(projector.getCameraPosition(), scene.perspectiveCamera.scenePosition,
+                "camera position follows")
+
+        scene.orthoCamera.horizontalMagnification = 4
+        scene.orthoCamera.verticalMagnification = 4
+        waitForRendering(scene, 5000)
+        var ortho = View3DProjectionAdapter.createProjector(scene.right)
+        compareScreen(ortho.projectWorldToScreen(Qt.vector3d(30, 20, 0)),
+                      scene.right.mapFrom3DScene(Qt.vector3d(30, 20, 0)), "after zoom")
+    }
+
+    function test_projector_follows_viewport_resize() {
+        var scene = createScene()
+        var projector = View3DProjectionAdapter.createProjector(scene.left)
+
+        scene.left.width = 300
+        waitForRendering(scene, 5000)
+
+        compareScreen(projector.projectWorldToScreen(Qt.vector3d(20, 20, 0)),
+                      scene.left.mapFrom3DScene(Qt.vector3d(20, 20, 0)), "after resize")
+    }
+
+    function test_orthographic_rays_are_parallel() {
+        var scene = createScene()
+        var projector = View3DProjectionAdapter.createProjector(scene.right)
+        verify(GizmoProjection.isOrthographic(projector), "orthographic view")
+
+        var a = projector.getCameraRay(Qt.point(50, 50))
+        var b = projector.getCameraRay(Qt.point(350, 550))
+        fuzzyCompare(a.direction.z, -1, 0.0001, "looks down -Z")
+        verify(a.direction.fuzzyEquals(b.direction, 0.0001), "parallel rays")
+        verify(!a.origin.fuzzyEquals(b.origin, 0.0001), "distinct origins")
+    }
+
+    function test_entry_evicted_with_view() {
+        var scene = createScene()
+        View3DProjectionAdapter.createProjector(scene.left)
+        View3DProjectionAdapter.createProjector(scene.right)
+        var withViews = GizmoProjectorCache.count
+
+        scene.destroy()
+        tryCompare(GizmoProjectorCache, "count", withViews - 2, 5000)
+    }
+}
@@ -0,0 +1,117 @@
+#include <QtTest/QtTest>
+
+#include <random>
+#include <vector>
+
+#include "core/selectionpivot.h"
+
+using namespace gizmo3d::core;
+
+class TestSelectionPivot : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Test cases
+    void testEmpty();
+    void testModes();
+    void testMoveUpdatesCentroid();
+    void testMoveShrinksBounds();
+    void testGroupMoveMatchesRebuild();
+
+private:
+    static void compareVec(Vec3 actual, Vec3 expected, float tolerance = 1e-4f)
+    {
+        QVERIFY2(std::abs(actual.x - expected.x) <= tolerance &&
+                 std::abs(actual.y - expected.y) <= tolerance &&
+                 std::abs(actual.z - expected.z) <= tolerance,
+                 qPrintable(QStringLiteral("(%1, %2, %3) != (%4, %5, %6)")
+                                .arg(actual.x).arg(actual.y).arg(actual.z)
+                                .arg(expected.x).arg(expected.y).arg(expected.z)));
+    }
+};
+
+void TestSelectionPivot::testEmpty()
+{
+    SelectionPivot pivot;
+    QVERIFY(pivot.empty());
+    compareVec(pivot.pivot(PivotMode::Centroid), {});
+    compareVec(pivot.pivot(PivotMode::BoundsCenter), {});
+    compareVec(pivot.pivot(PivotMode::FirstSelected), {});
+}
+
+void TestSelectionPivot::testModes()
+{
+    // Three points clustered at one end: centroid and bounds center differ
+    const Vec3 positions[] = {{0, 0, 0}, {1, 0, 0}, {8, 4, -2}};
+    SelectionPivot pivot;
+    pivot.assign(positions, 3);
+
+    QCOMPARE(pivot.size(), size_t(3));
+    compareVec(pivot.pivot(PivotMode::Centroid), {3, 4.0f / 3.0f, -2.0f / 3.0f});
+    compareVec(pivot.pivot(PivotMode::IndividualOrigins), {3, 4.0f / 3.0f, -2.0f / 3.0f});
+    compareVec(pivot.pivot(PivotMode::BoundsCenter), {4, 2, -1});
+    compareVec(pivot.pivot(PivotMode::FirstSelected), {0, 0, 0});
+    compareVec(pivot.boundsMin(), {0, 0, -2});
+    compareVec(pivot.boundsMax(), {8, 4, 0});
+}
+
+void TestSelectionPivot::testMoveUpdatesCentroid()
+{
+    const Vec3 positions[] = {{0, 0, 0}, {2, 0, 0}};
+    SelectionPivot pivot;
+    pivot.assign(positions, 2);
+
+    pivot.move(1, {2, 6, 0});
+    compareVec(pivot.centroid(), {1, 3, 0});
+    compareVec(pivot.position(1), {2, 6, 0});
+}
+
+void TestSelectionPivot::testMoveShrinksBounds()
+{
+    const Vec3 positions[] = {{0, 0, 0}, {1, 1, 1}, {10, 0, 0}};
+    SelectionPivot pivot;
+    pivot.assign(positions, 3);
+    compareVec(pivot.boundsMax(), {10, 1, 1});
+
+    // The point defining max.x moves inside: the bounds must shrink, not stay stale
+    pivot.move(2, {0.5f, 0.5f, 0.5f});
+    compareVec(pivot.boundsMax(), {1, 1, 1});
+    compareVec(pivot.boundsCenter(), {0.5f, 0.5f, 0.5f});
+
+    // An interior point moving out widens them
+    pivot.move(2, {-4, 0.5f, 0.5f});
+    compareVec(pivot.boundsMin(), {-4, 0, 0});
+}
+
+void TestSelectionPivot::testGroupMoveMatchesRebuild()
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> coord(-100.0f, 100.0f);
+    std::vector<Vec3> positions(5000);
+    for (Vec3 &p : positions)
+        p = {coord(rng), coord(rng), coord(rng)};
+
+    SelectionPivot pivot;
+    pivot.assign(positions.data(), positions.size());
+    pivot.boundsCenter();
+
+    // A drag moves the whole set a little every frame
+    for (int frame = 0; frame < 60; ++frame) {
+        const Vec3 step{0.25f, -0.1f, 0.05f};
+        for (size_t i = 0; i < positions.size(); ++i) {
+            positions[i] = positions[i] + step;
+            pivot.move(i, positions[i]);
+        }
+        pivot.boundsCenter();
+    }
+
+    SelectionPivot rebuilt;
+    rebuilt.assign(positions.data(), positions.size());
+    compareVec(pivot.centroid(), rebuilt.centroid(), 1e-3f);
+    compareVec(pivot.boundsMin(), rebuilt.boundsMin());
+    compareVec(pivot.boundsMax(), rebuilt.boundsMax());
+}
+
+QTEST_MAIN(TestSelectionPivot)
+#include "tst_selectionpivot.moc"
@@ -0,0 +1,180 @@
+import QtCore
+import QtQuick
+import QtQuick3D
+import QtTest
+import Gizmo3D
+
+// GizmoSessionRecorder and GizmoSessionPlayer: a recorded drag, replayed through a
+// controller into another node, lands where the original did.
+SceneTestCase {
+    id: testCase
+    name: "SessionReplay"
+    sceneComponent: sessionSceneComponent
+
+    Component {
+        id: sessionSceneComponent
+        Item {
+            width: 800
+            height: 600
+
+            property alias gizmo: globalGizmo
+            property alias recorder: sessionRecorder
+            property alias player: sessionPlayer
+            property alias target: targetNode
+            property alias replica: replicaNode
+            property alias replicaCamera: replayCamera
+
+            View3D {
+                id: view3d
+                anchors.fill: parent
+                camera: camera
+
+                PerspectiveCamera {
+                    id: camera
+                    position: Qt.vector3d(0, 100, 600)
+                    fieldOfView: 50
+                }
+
+                PerspectiveCamera { id: replayCamera }
+
+                Node { id: targetNode }
+                Node { id: replicaNode }
+            }
+
+            GlobalGizmo {
+                id: globalGizmo
+                anchors.fill: parent
+                view3d: view3d
+                targetNode: targetNode
+                mode: GizmoEnums.Mode.All
+            }
+
+            GizmoTransformController {
+                gizmo: globalGizmo
+                targetNode: targetNode
+            }
+
+            GizmoSessionRecorder {
+                id: sessionRecorder
+                gizmo: globalGizmo
+            }
+
+            GizmoSessionPlayer {
+                id: sessionPlayer
+                camera: replayCamera
+            }
+
+            GizmoTransformController {
+                gizmo: sessionPlayer
+                targetNode: replicaNode
+            }
+        }
+    }
+
+    function logPath(name) {
+        var dir = String(StandardPaths.writableLocation(StandardPaths.TempLocation))
+        dir = dir.replace(/^file:\/\/\//, Qt.platform.os === "windows" ? "" : "/")
+        return dir + "/gizmo3d_" + name + "_" + Date.now() + ".g3ds"
+    }
+
+    function recordDrags(scene) {
+        scene.recorder.recording = true
+        verify(scene.recorder.recording, "recording: " + scene.recorder.error)
+
+        scene.gizmo.axisTranslationStarted(GizmoEnums.Axis.X)
+        scene.gizmo.axisTranslationDelta(GizmoEnums.Axis.X, GizmoEnums.TransformMode.World, 30, false)
+        scene.gizmo.axisTranslationDelta(GizmoEnums.Axis.X, GizmoEnums.TransformMode.World, 40, false)
+        scene.gizmo.axisTranslationEnded(GizmoEnums.Axis.X)
+        scene.gizmo.scaleStarted(GizmoEnums.Axis.Uniform)
+        scene.gizmo.scaleDelta(GizmoEnums.Axis.Uniform, GizmoEnums.TransformMode.World, 2, true)
+        scene.gizmo.scaleEnded(GizmoEnums.Axis.Uniform)
+
+        scene.recorder.recording = false
+    }
+
+    function test_replay_reproduces_drags() {
+        var scene = createScene()
+        scene.recorder.path = logPath("replay")
+        recordDrags(scene)
+        compareVector(scene.target.position, Qt.vector3d(40, 0, 0), "recorded drag moved")
+
+        // Begin, 7 signals and at least the initial camera pose
+        verify(scene.recorder.recordCount >= 9, "records: " + scene.recorder.recordCount)
+
+        scene.player.path = scene.recorder.path
+        compare(scene.player.error, "")
+        compare(scene.player.count, scene.recorder.recordCount)
+        compare(scene.player.replayAll(), scene.player.count)
+        compare(scene.player.position, scene.player.count)
+
+        compareVector(scene.replica.position, scene.target.position, "replayed position")
+        compareVector(scene.replica.scale, scene.target.scale, "replayed scale")
+        compareVector(scene.replicaCamera.scenePosition, Qt.vector3d(0, 100, 600), "camera pose")
+        fuzzyCompare(scene.replicaCamera.fieldOfView, 50, 0.001, "camera field of view")
+    }
+
+    function test_signals_replayed_in_order() {
+        var scene = createScene()
+        scene.recorder.path = logPath("signals")
+        recordDrags(scene)
+
+        var deltaSpy = createTemporaryObject(signalSpyComponent, testCase, {
+            target: scene.player, signalName: "axisTranslationDelta"
+        })
+        var scaleSpy = createTemporaryObject(signalSpyComponent, testCase, {
+            target: scene.player, signalName: "scaleDelta"
+        })
+        scene.player.path = scene.recorder.path
+        while (scene.player.step()) {}
+
+        compare(deltaSpy.count, 2)
+        compare(deltaSpy.signalArguments[1][0], GizmoEnums.Axis.X)
+        compare(deltaSpy.signalArguments[1][2], 40)
+        compare(scaleSpy.count, 1)
+        compare(scaleSpy.signalArguments[0][3], true, "snap flag kept")
+
+        // stop() rewinds; replayed from the same start, the node ends in the same place
+        scene.player.stop()
+        compare(scene.player.position, 0)
+        scene.replica.position = Qt.vector3d(0, 0, 0)
+        scene.replica.scale = Qt.vector3d(1, 1, 1)
+        scene.player.replayAll()
+        compareVector(scene.replica.position, Qt.vector3d(40, 0, 0), "replayed twice")
+    }
+
+    function test_recording_appends_sessions() {
+        var scene = createScene()
+        var path = logPath("append")
+        scene.recorder.path = path
+        recordDrags(scene)
+        var first = scene.recorder.recordCount
+        recordDrags(scene)
+
+        scene.player.path = path
+        compare(scene.player.count, first + scene.recorder.recordCount)
+    }
+
+    function test_timed_playback() {
+        var scene = createScene()
+        scene.recorder.path = logPath("timed")
+        recordDrags(scene)
+
+        scene.player.path = scene.recorder.path
+        var finishedSpy = createTemporaryObject(signalSpyComponent, testCase, {
+            target: scene.player, signalName: "finished"
+        })
+        scene.player.speed = 4
+        scene.player.play()
+        tryCompare(finishedSpy, "count", 1, 5000)
+        verify(!scene.player.playing)
+        compareVector(scene.replica.position, Qt.vector3d(40, 0, 0), "played")
+    }
+
+    function test_missing_log() {
+        var scene = createScene()
+        scene.player.path = logPath("missing")
+        verify(scene.player.error !== "", "error reported")
+        compare(scene.player.count, 0)
+        verify(!scene.player.step())
+    }
+}
@@ -0,0 +1,201 @@
+#include <QtTest/QtTest>
+
+#include <QFile>
+#include <QTemporaryDir>
+
+#include <cstring>
+
+#ifdef Q_OS_UNIX
+#include <csignal>
+#include <sys/resource.h>
+#endif
+
+#include "core/sessionlog.h"
+
+using namespace gizmo3d::core;
+
+class TestSessionLog : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Test cases
+    void testRoundTrip();
+    void testAppendSession();
+    void testBufferedFlush();
+    void testRejectsForeignFile();
+    void testPartialTail();
+    void testFailedWrite();
+
+private:
+    static SessionRecord delta(int64_t time, float value)
+    {
+        SessionRecord record;
+        record.time = time;
+        record.type = SessionRecordType::Delta;
+        record.signal = SessionSignal::Rotation;
+        record.handle = 3;
+        record.flags = SessionFlagLocal | SessionFlagSnap;
+        record.values[0] = value;
+        return record;
+    }
+
+    static QByteArray readAll(const QString &path)
+    {
+        QFile file(path);
+        return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+    }
+
+    static bool sameRecord(const SessionRecord &a, const SessionRecord &b)
+    {
+        return std::memcmp(&a, &b, sizeof(SessionRecord)) == 0;
+    }
+
+    QTemporaryDir m_dir;
+};
+
+void TestSessionLog::testRoundTrip()
+{
+    const QString path = m_dir.filePath(QStringLiteral("roundtrip.g3ds"));
+    SessionWriter writer;
+    QVERIFY(writer.open(QFile::encodeName(path).constData()));
+    SessionRecord begin;
+    writer.append(begin);
+    for (int i = 0; i < 10; ++i)
+        writer.append(delta(i * 1000, float(i) * 1.5f));
+    QCOMPARE(writer.recordCount(), size_t(11));
+    writer.close();
+
+    const QByteArray data = readAll(path);
+    QCOMPARE(data.size(), qsizetype(sizeof(SessionHeader) + 11 * sizeof(SessionRecord)));
+
+    SessionReader reader;
+    QVERIFY(reader.open(data.constData(), size_t(data.size())));
+    QCOMPARE(reader.size(), size_t(11));
+    QCOMPARE(reader.record(0).type, SessionRecordType::Begin);
+    for (int i = 0; i < 10; ++i)
+        QVERIFY(sameRecord(reader.record(size_t(i + 1)), delta(i * 1000, float(i) * 1.5f)));
+}
+
+void TestSessionLog::testAppendSession()
+{
+    const QString path = m_dir.filePath(QStringLiteral("append.g3ds"));
+    SessionWriter writer;
+    QVERIFY(writer.open(QFile::encodeName(path).constData()));
+    writer.append(delta(1, 1.0f));
+    writer.close();
+
+    // A second recording continues the log; the header is written once
+    QVERIFY(writer.open(QFile::encodeName(path).constData()));
+    QCOMPARE(writer.recordCount(), size_t(0));
+    writer.append(delta(2, 2.0f));
+    writer.close();
+
+    const QByteArray data = readAll(path);
+    SessionReader reader;
+    QVERIFY(reader.open(data.constData(), size_t(data.size())));
+    QCOMPARE(reader.size(), size_t(2));
+    QCOMPARE(reader.record(0).values[0], 1.0f);
+    QCOMPARE(reader.record(1).values[0], 2.0f);
+}
+
+void TestSessionLog::testBufferedFlush()
+{
+    const QString path = m_dir.filePath(QStringLiteral("buffered.g3ds"));
+    SessionWriter writer;
+    QVERIFY(writer.open(QFile::encodeName(path).constData()));
+    writer.append(delta(1, 1.0f));
+
+    // Buffered until flushed
+    QCOMPARE(readAll(path).size(), qsizetype(sizeof(SessionHeader)));
+    QVERIFY(writer.flush());
+    QCOMPARE(readAll(path).size(), qsizetype(sizeof(SessionHeader) + sizeof(SessionRecord)));
+}
+
+void TestSessionLog::testRejectsForeignFile()
+{
+    const QString path = m_dir.filePath(QStringLiteral("foreign.txt"));
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write("not a session log at all");
+    file.close();
+
+    SessionWriter writer;
+    QVERIFY(!writer.open(QFile::encodeName(path).constData()));
+    const QByteArray data = readAll(path);
+    QCOMPARE(data, QByteArray("not a session log at all"));
+
+    SessionReader reader;
+    QVERIFY(!reader.open(data.constData(), size_t(data.size())));
+    QCOMPARE(reader.size(), size_t(0));
+}
+
+void TestSessionLog::testPartialTail()
+{
+    const QString path = m_dir.filePath(QStringLiteral("partial.g3ds"));
+    SessionWriter writer;
+    QVERIFY(writer.open(QFile::encodeName(path).constData()));
+    writer.append(delta(1, 1.0f));
+    writer.append(delta(2, 2.0f));
+    writer.close();
+
+    // Cut the last record short, as a crash mid-write would
+    QFile file(path);
+    QVERIFY(file.resize(file.size() - 10));
+
+    const QByteArray data = readAll(path);
+    SessionReader reader;
+    QVERIFY(reader.open(data.constData(), size_t(data.size())));
+    QCOMPARE(reader.size(), size_t(1));
+    QCOMPARE(reader.record(0).values[0], 1.0f);
+
+    // Appending would misalign every later record
+    QVERIFY(!writer.open(QFile::encodeName(path).constData()));
+}
+
+void TestSessionLog::testFailedWrite()
+{
+#ifdef Q_OS_UNIX
+    const QString path = m_dir.filePath(QStringLiteral("failed.g3ds"));
+    SessionWriter writer;
+    QVERIFY(writer.open(QFile::encodeName(path).constData()));
+    writer.append(delta(1, 1.0f));
+    QVERIFY(writer.flush());
+
+    // A file size limit ending mid-record fails the next write part way, as a full
+    // disk would
+    const qsizetype limit = qsizetype(sizeof(SessionHeader) + sizeof(SessionRecord)) + 10;
+    rlimit saved;
+    QCOMPARE(getrlimit(RLIMIT_FSIZE, &saved), 0);
+    rlimit limited = saved;
+    limited.rlim_cur = rlim_t(limit);
+    const auto savedHandler = std::signal(SIGXFSZ, SIG_IGN);
+    QCOMPARE(setrlimit(RLIMIT_FSIZE, &limited), 0);
+    writer.append(delta(2, 2.0f));
+    writer.append(delta(3, 3.0f));
+    const bool flushed = writer.flush();
+    setrlimit(RLIMIT_FSIZE, &saved);
+    std::signal(SIGXFSZ, savedHandler);
+
+    QVERIFY(!flushed);
+    QVERIFY(!writer.isOpen());
+    QCOMPARE(readAll(path).size(), limit);
+
+    // Nothing lands after the partial record
+    writer.append(delta(4, 4.0f));
+    QVERIFY(!writer.flush());
+    writer.close();
+    QCOMPARE(readAll(path).size(), limit);
+
+    const QByteArray data = readAll(path);
+    SessionReader reader;
+    QVERIFY(reader.open(data.constData(), size_t(data.size())));
+    QCOMPARE(reader.size(), size_t(1));
+    QCOMPARE(reader.record(0).values[0], 1.0f);
+#else
+    QSKIP("Needs RLIMIT_FSIZE to make a write fail");
+#endif
+}
+
+QTEST_MAIN(TestSessionLog)
+#include "tst_sessionlog.moc"
@@ -0,0 +1,102 @@
+import QtQuick
+import QtTest
+import Gizmo3D
+
+// GizmoTransformController: deltas from the gizmo signals move one node or a whole
+// selection natively, in scene space, whatever the nodes' parents are.
+TransformTestCase {
+    id: testCase
+    name: "GizmoTransformController"
+
+    sceneComponent: Component {
+        TransformTestScene {
+            id: scene
+
+            property alias controller: transformController
+
+            GizmoTransformController {
+                id: transformController
+                gizmo: scene.gizmo
+                selection: scene.gizmo.selection
+            }
+        }
+    }
+
+    function test_translate_parented_node() {
+        var scene = createTransformScene()
+        scene.controller.targetNode = scene.child
+        var start = scene.child.scenePosition
+
+        scene.gizmo.axisTranslationStarted(GizmoEnums.Axis.X)
+        verify(scene.controller.active, "active during the drag")
+        scene.gizmo.axisTranslationDelta(GizmoEnums.Axis.X, GizmoEnums.TransformMode.World, 30, false)
+        scene.gizmo.axisTranslationDelta(GizmoEnums.Axis.X, GizmoEnums.TransformMode.World, 40, false)
+        scene.gizmo.axisTranslationEnded(GizmoEnums.Axis.X)
+        verify(!scene.controller.active, "inactive after the drag")
+
+        // Along scene X, from the drag start, despite the rotated and scaled parent
+        compareVector(scene.child.scenePosition, start.plus(Qt.vector3d(40, 0, 0)), "moved")
+    }
+
+    function test_rotate_single_node_writes_rotation() {
+        var scene = createTransformScene()
+        scene.controller.targetNode = scene.child
+        var start = scene.child.scenePosition
+        var startRotation = scene.child.sceneRotation
+        var spy = createTemporaryObject(signalSpyComponent, testCase, {
+            target: scene.child, signalName: "positionChanged"
+        })
+
+        scene.gizmo.rotationStarted(GizmoEnums.Axis.Y)
+        scene.gizmo.rotationDelta(GizmoEnums.Axis.Y, GizmoEnums.TransformMode.World, 90, false)
+        scene.gizmo.rotationEnded(GizmoEnums.Axis.Y)
+
+        compare(spy.count, 0, "position is left alone")
+        compareVector(scene.child.scenePosition, start, "rotated in place")
+        var expected = GizmoMath.quaternionFromAxisAngle(Qt.vector3d(0, 1, 0), 90)
+                           .times(startRotation)
+        verify(GizmoMath.vectorEquals(GizmoMath.getLocalAxes(scene.child.sceneRotation).x,
+                                      GizmoMath.getLocalAxes(expected).x),
+               "scene rotation is the delta applied to the start")
+    }
+
+    function test_group_rotation_about_pivot() {
+        var scene = createTransformScene()
+        scene.gizmo.targetNodes = [scene.a, scene.b]
+        compare(scene.gizmo.selection.count, 2)
+
+        scene.gizmo.rotationStarted(GizmoEnums.Axis.Z)
+        compare(scene.controller.nodeCount, 2, "both nodes snapshotted")
+        scene.gizmo.rotationDelta(GizmoEnums.Axis.Z, GizmoEnums.TransformMode.World, 90, false)
+        scene.gizmo.rotationEnded(GizmoEnums.Axis.Z)
+
+        // Swung a quarter turn about the centroid at the origin
+        compareVector(scene.a.position, Qt.vector3d(0, -50, 0), "a")
+        compareVector(scene.b.position, Qt.vector3d(0, 50, 0), "b")
+    }
+
+    function test_group_scale_individual_origins() {
+        var scene = createTransformScene()
+        scene.gizmo.targetNodes = [scene.a, scene.b]
+        scene.gizmo.pivotMode = GizmoSelection.IndividualOrigins
+
+        scene.gizmo.scaleStarted(GizmoEnums.Axis.Uniform)
+        scene.gizmo.scaleDelta(GizmoEnums.Axis.Uniform, GizmoEnums.TransformMode.World, 2, false)
+        scene.gizmo.scaleEnded(GizmoEnums.Axis.Uniform)
+
+        compareVector(scene.a.position, Qt.vector3d(-50, 0, 0), "a stays")
+        compareVector(scene.a.scale, Qt.vector3d(2, 2, 2), "a scaled")
+        compareVector(scene.b.scale, Qt.vector3d(2, 2, 2), "b scaled")
+    }
+
+    function test_disabled() {
+        var scene = createTransformScene()
+        scene.controller.targetNode = scene.a
+        scene.controller.enabled = false
+
+        scene.gizmo.axisTranslationStarted(GizmoEnums.Axis.X)
+        scene.gizmo.axisTranslationDelta(GizmoEnums.Axis.X, GizmoEnums.TransformMode.World, 30, false)
+        scene.gizmo.axisTranslationEnded(GizmoEnums.Axis.X)
+        compareVector(scene.a.position, Qt.vector3d(-50, 0, 0), "not moved")
+    }
+}
@@ -0,0 +1,108 @@
+import QtQuick
+import QtTest
+import Gizmo3D
+
+// GlobalGizmo.deltas: every child gizmo delta arrives as one gizmoTransformDelta, with
+// the target's resulting transform, straight from the child gizmo.
+TransformTestCase {
+    id: testCase
+    name: "TransformDelta"
+
+    sceneComponent: Component {
+        TransformTestScene {
+            gizmo.targetNode: child
+            gizmo.deltas.enabled: true
+        }
+    }
+
+    function createSpy(scene) {
+        return createTemporaryObject(signalSpyComponent, testCase, {
+            target: scene.gizmo.deltas, signalName: "transformDelta"
+        })
+    }
+
+    function test_axis_translation() {
+        var scene = createTransformScene()
+        var spy = createSpy(scene)
+        var relaySpy = createTemporaryObject(signalSpyComponent, testCase, {
+            target: scene.gizmo, signalName: "axisTranslationDelta"
+        })
+
+        var source = scene.gizmo.translationGizmo
+        source.axisTranslationStarted(GizmoEnums.Axis.X)
+        source.axisTranslationDelta(GizmoEnums.Axis.X, GizmoEnums.TransformMode.World, 40, true)
+        source.axisTranslationEnded(GizmoEnums.Axis.X)
+
+        compare(spy.count, 1)
+        compare(relaySpy.count, 1, "the per-kind signals still fire")
+        var delta = spy.signalArguments[0][0]
+        compare(delta.mode, GizmoEnums.Mode.Translate)
+        compare(delta.axis, GizmoEnums.Axis.X)
+        compare(delta.plane, GizmoEnums.Plane.None)
+        compare(delta.snapActive, true)
+        compare(delta.value, 40)
+        compareVector(delta.translation, Qt.vector3d(40, 0, 0), "translation")
+
+        // Scene +40 X under the parent's quarter turn and 2x scale is local -20 Y
+        compareVector(delta.targetPosition, Qt.vector3d(10, -20, 0), "target position")
+        compareVector(scene.child.position, Qt.vector3d(10, 0, 0), "nothing is written")
+    }
+
+    function test_target_is_from_drag_start() {
+        var scene = createTransformScene()
+        var spy = createSpy(scene)
+
+        var source = scene.gizmo.translationGizmo
+        source.planeTranslationStarted(GizmoEnums.Plane.XY)
+        source.planeTranslationDelta(GizmoEnums.Plane.XY, GizmoEnums.TransformMode.World,
+                                     Qt.vector3d(10, 20, 0), false)
+        // A controller writes the result; the next delta still starts from the drag start
+        scene.child.position = spy.signalArguments[0][0].targetPosition
+        source.planeTranslationDelta(GizmoEnums.Plane.XY, GizmoEnums.TransformMode.World,
+                                     Qt.vector3d(20, 40, 0), false)
+        source.planeTranslationEnded(GizmoEnums.Plane.XY)
+
+        compare(spy.count, 2)
+        var delta = spy.signalArguments[1][0]
+        compare(delta.plane, GizmoEnums.Plane.XY)
+        compare(delta.axis, GizmoEnums.Axis.None)
+        scene.child.position = delta.targetPosition
+        compareVector(scene.child.scenePosition, Qt.vector3d(20, 160, 0), "scene position")
+    }
+
+    function test_rotation_and_scale() {
+        var scene = createTransformScene()
+        var spy = createSpy(scene)
+
+        scene.gizmo.rotationGizmo.rotationStarted(GizmoEnums.Axis.Z)
+        scene.gizmo.rotationGizmo.rotationDelta(GizmoEnums.Axis.Z, GizmoEnums.TransformMode.World, 90, false)
+        scene.gizmo.rotationGizmo.rotationEnded(GizmoEnums.Axis.Z)
+        scene.gizmo.scaleGizmo.scaleStarted(GizmoEnums.Axis.Y)
+        scene.gizmo.scaleGizmo.scaleDelta(GizmoEnums.Axis.Y, GizmoEnums.TransformMode.World, 3, false)
+        scene.gizmo.scaleGizmo.scaleEnded(GizmoEnums.Axis.Y)
+
+        compare(spy.count, 2)
+        var rotation = spy.signalArguments[0][0]
+        compare(rotation.mode, GizmoEnums.Mode.Rotate)
+        compare(rotation.value, 90)
+        verify(GizmoMath.quaternionEquals(rotation.rotation,
+                                          GizmoMath.quaternionFromAxisAngle(Qt.vector3d(0, 0, 1), 90)),
+               "scene rotation payload")
+        compareVector(rotation.targetPosition, scene.child.position, "rotated in place")
+
+        var scale = spy.signalArguments[1][0]
+        compare(scale.mode, GizmoEnums.Mode.Scale)
+        compareVector(scale.scale, Qt.vector3d(1, 3, 1), "scale payload")
+        compareVector(scale.targetScale, Qt.vector3d(1, 3, 1), "target scale")
+    }
+
+    function test_disabled() {
+        var scene = createTransformScene()
+        scene.gizmo.deltas.enabled = false
+        var spy = createSpy(scene)
+
+        scene.gizmo.translationGizmo.axisTranslationStarted(GizmoEnums.Axis.X)
+        scene.gizmo.translationGizmo.axisTranslationDelta(GizmoEnums.Axis.X, GizmoEnums.TransformMode.World, 5, false)
+        compare(spy.count, 0)
+    }
+}
@@ -0,0 +1,207 @@
+#include <QtTest/QtTest>
+#include <QMatrix4x4>
+#include <QQuaternion>
+
+#include <cstring>
+#include <vector>
+
+#include "core/transformbatch.h"
+
+using namespace gizmo3d::core;
+
+class TestTransformBatch : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Test cases
+    void testQuatMatchesQt();
+    void testTranslateUnparented();
+    void testTranslateUnderTransformedParent();
+    void testRotateAboutPivot();
+    void testRotateAboutOrigins();
+    void testScaleAboutPivot();
+    void testDeltasAreCumulative();
+
+private:
+    static Quat toQuat(const QQuaternion &q) { return {q.scalar(), q.x(), q.y(), q.z()}; }
+
+    static Mat4 toMat4(const QMatrix4x4 &matrix)
+    {
+        Mat4 m;
+        std::memcpy(m.m, matrix.constData(), sizeof(m.m));
+        return m;
+    }
+
+    // Child of a parent at parentPosition, rotated by parentRotation and uniformly scaled
+    static NodeSnapshot childOf(QVector3D parentPosition, QQuaternion parentRotation,
+                                float parentScale, QVector3D localPosition)
+    {
+        QMatrix4x4 parent;
+        parent.translate(parentPosition);
+        parent.rotate(parentRotation);
+        parent.scale(parentScale);
+
+        NodeSnapshot node;
+        node.position = {localPosition.x(), localPosition.y(), localPosition.z()};
+        const QVector3D scene = parent.map(localPosition);
+        node.scenePosition = {scene.x(), scene.y(), scene.z()};
+        node.sceneRotation = toQuat(parentRotation);
+        node.parentSceneTransform = toMat4(parent);
+        node.parentSceneRotation = toQuat(parentRotation);
+        return node;
+    }
+
+    static void compareVec(Vec3 actual, Vec3 expected, float tolerance = 1e-4f)
+    {
+        QVERIFY2(std::abs(actual.x - expected.x) <= tolerance &&
+                 std::abs(actual.y - expected.y) <= tolerance &&
+                 std::abs(actual.z - expected.z) <= tolerance,
+                 qPrintable(QStringLiteral("(%1, %2, %3) != (%4, %5, %6)")
+                                .arg(actual.x).arg(actual.y).arg(actual.z)
+                                .arg(expected.x).arg(expected.y).arg(expected.z)));
+    }
+
+    static void compareQuat(Quat actual, const QQuaternion &expected, float tolerance = 1e-4f)
+    {
+        // q and -q are the same rotation
+        const float sign = actual.w * expected.scalar() + actual.x * expected.x()
+                         + actual.y * expected.y() + actual.z * expected.z() < 0.0f ? -1.0f : 1.0f;
+        QVERIFY2(std::abs(sign * actual.w - expected.scalar()) <= tolerance &&
+                 std::abs(sign * actual.x - expected.x()) <= tolerance &&
+                 std::abs(sign * actual.y - expected.y()) <= tolerance &&
+                 std::abs(sign * actual.z - expected.z()) <= tolerance,
+                 qPrintable(QStringLiteral("(%1, %2, %3, %4) != (%5, %6, %7, %8)")
+                                .arg(actual.w).arg(actual.x).arg(actual.y).arg(actual.z)
+                                .arg(expected.scalar()).arg(expected.x())
+                                .arg(expected.y()).arg(expected.z())));
+    }
+};
+
+void TestTransformBatch::testQuatMatchesQt()
+{
+    const QQuaternion a = QQuaternion::fromAxisAndAngle(QVector3D(1, 2, 3).normalized(), 40);
+    const QQuaternion b = QQuaternion::fromAxisAndAngle(QVector3D(0, 1, 0), -75);
+
+    compareQuat(fromAxisAngle({0, 1, 0}, -75), b);
+    compareQuat(toQuat(a) * toQuat(b), a * b);
+
+    const QVector3D rotated = a.rotatedVector(QVector3D(4, -1, 2));
+    compareVec(rotate(toQuat(a), {4, -1, 2}), {rotated.x(), rotated.y(), rotated.z()});
+}
+
+void TestTransformBatch::testTranslateUnparented()
+{
+    NodeSnapshot node;
+    node.position = node.scenePosition = {1, 2, 3};
+
+    TransformBatch batch;
+    batch.assign(&node, 1);
+    batch.translate({10, 0, -1});
+    compareVec(batch.positions()[0], {11, 2, 2});
+    compareVec(batch.scales()[0], {1, 1, 1});
+}
+
+void TestTransformBatch::testTranslateUnderTransformedParent()
+{
+    // A world-X drag must move the child along world X, not its parent's rotated,
+    // scaled X
+    const QQuaternion parentRotation = QQuaternion::fromAxisAndAngle(0, 0, 1, 90);
+    const NodeSnapshot node = childOf({10, 0, 0}, parentRotation, 2.0f, {1, 0, 0});
+
+    TransformBatch batch;
+    batch.assign(&node, 1);
+    batch.translate({4, 0, 0});
+
+    QMatrix4x4 parent;
+    parent.translate(10, 0, 0);
+    parent.rotate(parentRotation);
+    parent.scale(2.0f);
+    const Vec3 local = batch.positions()[0];
+    const QVector3D scene = parent.map(QVector3D(local.x, local.y, local.z));
+    compareVec({scene.x(), scene.y(), scene.z()},
+               {node.scenePosition.x + 4, node.scenePosition.y, node.scenePosition.z});
+}
+
+void TestTransformBatch::testRotateAboutPivot()
+{
+    const QQuaternion parentRotation = QQuaternion::fromAxisAndAngle(0, 1, 0, 30);
+    const NodeSnapshot nodes[] = {
+        childOf({0, 0, 0}, QQuaternion(), 1.0f, {5, 0, 0}),
+        childOf({0, 0, 0}, parentRotation, 1.0f, {0, 0, 5}),
+    };
+
+    TransformBatch batch;
+    batch.assign(nodes, 2);
+    const QQuaternion spin = QQuaternion::fromAxisAndAngle(0, 0, 1, 90);
+    batch.rotate(toQuat(spin), {0, 0, 0}, false);
+
+    // Unparented: swings around the pivot and turns with it
+    compareVec(batch.positions()[0], {0, 5, 0});
+    compareQuat(batch.rotations()[0], spin);
+
+    // Parented: the scene rotation becomes spin * start; the local one is relative to the parent
+    const QVector3D scene = spin.rotatedVector(parentRotation.rotatedVector(QVector3D(0, 0, 5)));
+    const QVector3D local = parentRotation.inverted().rotatedVector(scene);
+    compareVec(batch.positions()[1], {local.x(), local.y(), local.z()});
+    compareQuat(batch.rotations()[1], parentRotation.inverted() * spin * parentRotation);
+}
+
+void TestTransformBatch::testRotateAboutOrigins()
+{
+    NodeSnapshot node;
+    node.position = node.scenePosition = {5, 0, 0};
+
+    TransformBatch batch;
+    batch.assign(&node, 1);
+    batch.rotate(fromAxisAngle({0, 0, 1}, 90), {0, 0, 0}, true);
+    compareVec(batch.positions()[0], {5, 0, 0});
+    compareQuat(batch.rotations()[0], QQuaternion::fromAxisAndAngle(0, 0, 1, 90));
+}
+
+void TestTransformBatch::testScaleAboutPivot()
+{
+    NodeSnapshot nodes[2];
+    nodes[0].position = nodes[0].scenePosition = {2, 2, 0};
+    nodes[1].position = nodes[1].scenePosition = {-2, 0, 0};
+    nodes[1].scale = {1, 3, 1};
+
+    TransformBatch batch;
+    batch.assign(nodes, 2);
+
+    batch.scale(0, {1, 0, 0}, 2.0f, {0, 0, 0}, false);
+    compareVec(batch.positions()[0], {4, 2, 0});
+    compareVec(batch.positions()[1], {-4, 0, 0});
+    compareVec(batch.scales()[0], {2, 1, 1});
+    compareVec(batch.scales()[1], {2, 3, 1});
+
+    batch.scale(-1, {}, 0.5f, {0, 0, 0}, false);
+    compareVec(batch.positions()[0], {1, 1, 0});
+    compareVec(batch.scales()[1], {0.5f, 1.5f, 0.5f});
+
+    // Individual origins: nodes scale in place
+    batch.scale(1, {0, 1, 0}, 4.0f, {0, 0, 0}, true);
+    compareVec(batch.positions()[0], {2, 2, 0});
+    compareVec(batch.scales()[0], {1, 4, 1});
+}
+
+void TestTransformBatch::testDeltasAreCumulative()
+{
+    std::vector<NodeSnapshot> nodes(100);
+    for (size_t i = 0; i < nodes.size(); ++i)
+        nodes[i].position = nodes[i].scenePosition = {float(i), 0, 0};
+
+    TransformBatch batch;
+    batch.assign(nodes.data(), nodes.size());
+
+    // Each delta is measured from the drag start, so the last one wins
+    for (int step = 1; step <= 60; ++step)
+        batch.translate({0, 0.5f * float(step), 0});
+    compareVec(batch.positions()[42], {42, 30, 0});
+
+    batch.reset();
+    compareVec(batch.positions()[42], {42, 0, 0});
+}
+
+QTEST_MAIN(TestTransformBatch)
+#include "tst_transformbatch.moc"
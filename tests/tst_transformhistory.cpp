@@ -0,0 +1,239 @@
+#include <QtTest/QtTest>
+
+#include <numeric>
+#include <vector>
+
+#include "core/transformhistory.h"
+
+using namespace gizmo3d::core;
+
+class TestTransformHistory : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Test cases
+    void testUnchangedEditIsDropped();
+    void testOnlyChangedFieldsStored();
+    void testSharedDeltaIsCompact();
+    void testIrregularEditRoundTrips();
+    void testNodeIds();
+    void testUndoRedo();
+    void testPushDiscardsRedo();
+    void testLimit();
+    void testDropHandler();
+
+private:
+    static std::vector<uint32_t> sequentialIds(size_t count)
+    {
+        std::vector<uint32_t> ids(count);
+        std::iota(ids.begin(), ids.end(), 0u);
+        return ids;
+    }
+
+    static std::vector<NodeTransform> grid(size_t count)
+    {
+        std::vector<NodeTransform> nodes(count);
+        for (size_t i = 0; i < count; ++i) {
+            nodes[i].position = {float(i % 100), float(i / 100), 0.0f};
+            nodes[i].rotation = fromAxisAngle({0, 0, 1}, float(i % 360));
+            nodes[i].scale = {1.0f + float(i % 3), 1.0f, 1.0f};
+        }
+        return nodes;
+    }
+
+    static std::unique_ptr<TransformCommand> translated(size_t count, Vec3 delta)
+    {
+        const std::vector<uint32_t> ids = sequentialIds(count);
+        const std::vector<NodeTransform> before = grid(count);
+        std::vector<NodeTransform> after = before;
+        for (NodeTransform &node : after)
+            node.position = node.position + delta;
+        return TransformCommand::create(ids.data(), before.data(), after.data(), count);
+    }
+
+    static void compareVec(Vec3 actual, Vec3 expected, float tolerance = 1e-4f)
+    {
+        QVERIFY2(std::abs(actual.x - expected.x) <= tolerance &&
+                 std::abs(actual.y - expected.y) <= tolerance &&
+                 std::abs(actual.z - expected.z) <= tolerance,
+                 qPrintable(QStringLiteral("(%1, %2, %3) != (%4, %5, %6)")
+                                .arg(actual.x).arg(actual.y).arg(actual.z)
+                                .arg(expected.x).arg(expected.y).arg(expected.z)));
+    }
+};
+
+void TestTransformHistory::testUnchangedEditIsDropped()
+{
+    const std::vector<uint32_t> ids = sequentialIds(10);
+    const std::vector<NodeTransform> nodes = grid(10);
+    QVERIFY(!TransformCommand::create(ids.data(), nodes.data(), nodes.data(), nodes.size()));
+
+    TransformHistory history;
+    history.push(nullptr);
+    QCOMPARE(history.size(), size_t(0));
+}
+
+void TestTransformHistory::testOnlyChangedFieldsStored()
+{
+    const auto command = translated(10, {1, 0, 0});
+    QVERIFY(command);
+    QCOMPARE(command->fields(), uint8_t(PositionField));
+
+    // Fields the command does not change are left alone on decode
+    std::vector<NodeTransform> out(10);
+    out[3].scale = {7, 7, 7};
+    command->decode(true, out.data());
+    compareVec(out[3].position, {4, 0, 0});
+    compareVec(out[3].scale, {7, 7, 7});
+}
+
+void TestTransformHistory::testSharedDeltaIsCompact()
+{
+    // A 10k-node group move keeps the start positions and one offset
+    const size_t count = 10000;
+    const auto command = translated(count, {2.5f, -1, 0.25f});
+    QVERIFY(command->memoryUsage() < count * sizeof(Vec3) + 1024);
+
+    std::vector<NodeTransform> out(count);
+    command->decode(true, out.data());
+    const std::vector<NodeTransform> before = grid(count);
+    compareVec(out[9876].position, before[9876].position + Vec3{2.5f, -1, 0.25f});
+    command->decode(false, out.data());
+    compareVec(out[9876].position, before[9876].position, 0.0f);
+
+    // A group rotation shares one left-applied rotation
+    const std::vector<uint32_t> ids = sequentialIds(count);
+    std::vector<NodeTransform> after = before;
+    const Quat spin = fromAxisAngle({0, 1, 0}, 30);
+    for (NodeTransform &node : after)
+        node.rotation = spin * node.rotation;
+    const auto rotated = TransformCommand::create(ids.data(), before.data(), after.data(), count);
+    QCOMPARE(rotated->fields(), uint8_t(RotationField));
+    QVERIFY(rotated->memoryUsage() < count * sizeof(Quat) + 1024);
+}
+
+void TestTransformHistory::testIrregularEditRoundTrips()
+{
+    // Different offsets per node: both arrays are kept and both directions are exact
+    const size_t count = 100;
+    const std::vector<uint32_t> ids = sequentialIds(count);
+    const std::vector<NodeTransform> before = grid(count);
+    std::vector<NodeTransform> after = before;
+    for (size_t i = 0; i < count; ++i)
+        after[i].scale = {float(i), 2.0f, 0.5f};
+
+    const auto command = TransformCommand::create(ids.data(), before.data(), after.data(), count);
+    QCOMPARE(command->fields(), uint8_t(ScaleField));
+
+    std::vector<NodeTransform> out(count);
+    command->decode(true, out.data());
+    for (size_t i = 0; i < count; ++i)
+        compareVec(out[i].scale, after[i].scale, 0.0f);
+    command->decode(false, out.data());
+    for (size_t i = 0; i < count; ++i)
+        compareVec(out[i].scale, before[i].scale, 0.0f);
+}
+
+void TestTransformHistory::testNodeIds()
+{
+    const std::vector<NodeTransform> before = grid(3);
+    std::vector<NodeTransform> after = before;
+    for (NodeTransform &node : after)
+        node.position = node.position + Vec3{1, 0, 0};
+
+    const uint32_t consecutive[] = {5, 6, 7};
+    const auto range = TransformCommand::create(consecutive, before.data(), after.data(), 3);
+    QCOMPARE(range->node(2), 7u);
+
+    const uint32_t scattered[] = {9, 2, 40};
+    const auto listed = TransformCommand::create(scattered, before.data(), after.data(), 3);
+    QCOMPARE(listed->node(0), 9u);
+    QCOMPARE(listed->node(2), 40u);
+    QVERIFY(listed->memoryUsage() > range->memoryUsage());
+}
+
+void TestTransformHistory::testUndoRedo()
+{
+    TransformHistory history;
+    QVERIFY(!history.canUndo());
+    QVERIFY(!history.undo());
+
+    history.push(translated(4, {1, 0, 0}));
+    history.push(translated(4, {0, 1, 0}));
+    QCOMPARE(history.size(), size_t(2));
+    QCOMPARE(history.index(), size_t(2));
+    QVERIFY(history.memoryUsage() > 0);
+
+    const TransformCommand *undone = history.undo();
+    QVERIFY(undone);
+    std::vector<NodeTransform> out(4);
+    undone->decode(true, out.data());
+    compareVec(out[1].position, {1, 1, 0});
+    QVERIFY(history.canRedo());
+
+    QCOMPARE(history.redo(), undone);
+    QVERIFY(!history.canRedo());
+    QVERIFY(!history.redo());
+}
+
+void TestTransformHistory::testPushDiscardsRedo()
+{
+    TransformHistory history;
+    history.push(translated(4, {1, 0, 0}));
+    history.push(translated(4, {0, 1, 0}));
+    const size_t oneCommand = history.memoryUsage() / 2;
+    history.undo();
+    history.undo();
+
+    history.push(translated(4, {0, 0, 1}));
+    QCOMPARE(history.size(), size_t(1));
+    QCOMPARE(history.index(), size_t(1));
+    QVERIFY(!history.canRedo());
+    QCOMPARE(history.memoryUsage(), oneCommand);
+}
+
+void TestTransformHistory::testLimit()
+{
+    TransformHistory history;
+    history.setLimit(3);
+    for (int i = 0; i < 5; ++i)
+        history.push(translated(4, {float(i), 0, 0}));
+    QCOMPARE(history.size(), size_t(3));
+    QCOMPARE(history.index(), size_t(3));
+
+    // Lowering the limit after undoing drops applied commands first, then the
+    // newest undone ones, so the remaining redo chain is contiguous
+    history.undo();
+    history.setLimit(1);
+    QCOMPARE(history.size(), size_t(1));
+    QCOMPARE(history.index(), size_t(0));
+    QVERIFY(history.canRedo());
+}
+
+void TestTransformHistory::testDropHandler()
+{
+    TransformHistory history;
+    size_t droppedNodes = 0;
+    history.setDropHandler([&droppedNodes](const TransformCommand &command) {
+        droppedNodes += command.size();
+    });
+
+    history.setLimit(2);
+    history.push(translated(4, {1, 0, 0}));
+    history.push(translated(5, {0, 1, 0}));
+    history.push(translated(6, {0, 0, 1}));
+    QCOMPARE(droppedNodes, size_t(4));
+
+    // Undone commands replaced by a push
+    history.undo();
+    history.push(translated(7, {1, 1, 0}));
+    QCOMPARE(droppedNodes, size_t(10));
+
+    history.clear();
+    QCOMPARE(droppedNodes, size_t(22));
+    QCOMPARE(history.memoryUsage(), size_t(0));
+}
+
+QTEST_MAIN(TestTransformHistory)
+#include "tst_transformhistory.moc"
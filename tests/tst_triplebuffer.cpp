@@ -0,0 +1,151 @@
+#include <QtTest/QtTest>
+
+#include <atomic>
+#include <thread>
+
+#include "core/gizmogeometry.h"
+#include "core/triplebuffer.h"
+
+using namespace gizmo3d::core;
+
+class TestTripleBuffer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Test cases
+    void testInitiallyEmpty();
+    void testPublishFetch();
+    void testLatestWins();
+    void testReadBufferStable();
+    void testNoTearingUnderStress();
+};
+
+namespace {
+
+// One gizmo's result: every coordinate of the arrows and the planes carries the
+// sequence number, so a mix of two publishes is detectable
+struct Frame
+{
+    quint64 sequence = 0;
+    ArrowGeometry geometry;
+};
+
+void fill(Frame &frame, quint64 sequence)
+{
+    const float v = float(sequence % 100000);
+    frame.sequence = sequence;
+    frame.geometry.center = {v, v, v};
+    for (size_t i = 0; i < 3; ++i) {
+        frame.geometry.start[i] = {v, v};
+        frame.geometry.end[i] = {v, v};
+        for (Vec3 &corner : frame.geometry.planes[i])
+            corner = {v, v, v};
+    }
+}
+
+bool consistent(const Frame &frame)
+{
+    const float v = float(frame.sequence % 100000);
+    if (frame.geometry.center.x != v || frame.geometry.center.z != v)
+        return false;
+    for (size_t i = 0; i < 3; ++i) {
+        if (frame.geometry.start[i].x != v || frame.geometry.end[i].y != v)
+            return false;
+        for (const Vec3 &corner : frame.geometry.planes[i]) {
+            if (corner.x != v || corner.y != v || corner.z != v)
+                return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+void TestTripleBuffer::testInitiallyEmpty()
+{
+    TripleBuffer<int> buffer;
+    QVERIFY(!buffer.hasFresh());
+    QVERIFY(!buffer.fetch());
+    QCOMPARE(buffer.readBuffer(), 0);
+}
+
+void TestTripleBuffer::testPublishFetch()
+{
+    TripleBuffer<int> buffer;
+    buffer.writeBuffer() = 42;
+    buffer.publish();
+
+    QVERIFY(buffer.hasFresh());
+    QVERIFY(buffer.fetch());
+    QCOMPARE(buffer.readBuffer(), 42);
+
+    // Nothing new: the current value stays
+    QVERIFY(!buffer.fetch());
+    QCOMPARE(buffer.readBuffer(), 42);
+}
+
+void TestTripleBuffer::testLatestWins()
+{
+    TripleBuffer<int> buffer;
+    for (int i = 1; i <= 5; ++i) {
+        buffer.writeBuffer() = i;
+        buffer.publish();
+    }
+
+    QVERIFY(buffer.fetch());
+    QCOMPARE(buffer.readBuffer(), 5);
+}
+
+void TestTripleBuffer::testReadBufferStable()
+{
+    TripleBuffer<int> buffer;
+    buffer.writeBuffer() = 1;
+    buffer.publish();
+    QVERIFY(buffer.fetch());
+
+    // The producer keeps writing without ever touching the slot being read
+    for (int i = 2; i < 10; ++i) {
+        buffer.writeBuffer() = i;
+        buffer.publish();
+        QCOMPARE(buffer.readBuffer(), 1);
+    }
+}
+
+void TestTripleBuffer::testNoTearingUnderStress()
+{
+    constexpr quint64 publishes = 500000;
+    TripleBuffer<Frame> buffer;
+    std::atomic<bool> done{false};
+
+    std::thread producer([&]() {
+        for (quint64 sequence = 1; sequence <= publishes; ++sequence) {
+            fill(buffer.writeBuffer(), sequence);
+            buffer.publish();
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    quint64 last = 0;
+    int torn = 0;
+    int reordered = 0;
+    while (!done.load(std::memory_order_acquire) || buffer.hasFresh()) {
+        if (!buffer.fetch())
+            continue;
+        const Frame &frame = buffer.readBuffer();
+        if (!consistent(frame))
+            ++torn;
+        if (frame.sequence <= last)
+            ++reordered;
+        last = frame.sequence;
+    }
+    producer.join();
+
+    QCOMPARE(torn, 0);
+    QCOMPARE(reordered, 0);
+    // The consumer always ends on the newest publish
+    QCOMPARE(last, publishes);
+}
+
+QTEST_MAIN(TestTripleBuffer)
+#include "tst_triplebuffer.moc"
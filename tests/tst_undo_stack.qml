@@ -0,0 +1,125 @@
+import QtQuick
+import QtQuick3D
+import QtTest
+import Gizmo3D
+
+// GizmoUndoStack: every drag becomes one command, whatever the number of deltas,
+// and undo/redo restore the whole group.
+SceneTestCase {
+    id: testCase
+    name: "GizmoUndoStack"
+    sceneComponent: undoSceneComponent
+
+    Component {
+        id: undoSceneComponent
+        Item {
+            width: 800
+            height: 600
+
+            property alias gizmo: globalGizmo
+            property alias history: undoStack
+            property alias a: nodeA
+            property alias b: nodeB
+
+            View3D {
+                id: view3d
+                anchors.fill: parent
+                camera: camera
+
+                PerspectiveCamera {
+                    id: camera
+                    position: Qt.vector3d(0, 0, 600)
+                }
+
+                Node { id: nodeA; position: Qt.vector3d(-50, 0, 0) }
+                Node { id: nodeB; position: Qt.vector3d(50, 0, 0) }
+            }
+
+            GlobalGizmo {
+                id: globalGizmo
+                anchors.fill: parent
+                view3d: view3d
+                mode: GizmoEnums.Mode.All
+                targetNodes: [nodeA, nodeB]
+            }
+
+            GizmoTransformController {
+                gizmo: globalGizmo
+                selection: globalGizmo.selection
+            }
+
+            GizmoUndoStack {
+                id: undoStack
+                gizmo: globalGizmo
+                selection: globalGizmo.selection
+            }
+        }
+    }
+
+    function drag(scene, distance) {
+        scene.gizmo.axisTranslationStarted(GizmoEnums.Axis.Y)
+        for (var i = 1; i <= 30; i++) {
+            scene.gizmo.axisTranslationDelta(GizmoEnums.Axis.Y, GizmoEnums.TransformMode.World,
+                                             distance * i / 30, false)
+        }
+        scene.gizmo.axisTranslationEnded(GizmoEnums.Axis.Y)
+    }
+
+    function test_drag_is_one_command() {
+        var scene = createScene()
+        drag(scene, 60)
+
+        compare(scene.history.count, 1, "30 deltas coalesced")
+        verify(scene.history.canUndo)
+        verify(!scene.history.canRedo)
+        verify(scene.history.memoryUsage > 0)
+        fuzzyCompare(scene.a.position.y, 60, 0.001)
+    }
+
+    function test_undo_redo() {
+        var scene = createScene()
+        drag(scene, 60)
+        drag(scene, 20)
+        compare(scene.history.count, 2)
+
+        scene.history.undo()
+        fuzzyCompare(scene.a.position.y, 60, 0.001, "second drag undone")
+        scene.history.undo()
+        fuzzyCompare(scene.a.position.y, 0, 0.001, "first drag undone")
+        fuzzyCompare(scene.b.position.y, 0, 0.001, "for every node")
+        verify(!scene.history.canUndo)
+
+        scene.history.redo()
+        scene.history.redo()
+        fuzzyCompare(scene.a.position.y, 80, 0.001, "both redone")
+        fuzzyCompare(scene.b.position.x, 50, 0.001, "other fields untouched")
+    }
+
+    function test_new_edit_discards_redo() {
+        var scene = createScene()
+        drag(scene, 60)
+        scene.history.undo()
+        drag(scene, -10)
+        compare(scene.history.count, 1)
+        verify(!scene.history.canRedo)
+    }
+
+    function test_click_without_change_is_not_recorded() {
+        var scene = createScene()
+        scene.gizmo.rotationStarted(GizmoEnums.Axis.Z)
+        scene.gizmo.rotationEnded(GizmoEnums.Axis.Z)
+        compare(scene.history.count, 0)
+    }
+
+    function test_manual_edit() {
+        var scene = createScene()
+        scene.history.beginEdit()
+        verify(scene.history.recording)
+        scene.a.scale = Qt.vector3d(3, 3, 3)
+        scene.history.endEdit()
+        compare(scene.history.count, 1)
+
+        scene.history.undo()
+        fuzzyCompare(scene.a.scale.x, 1, 0.001)
+    }
+}